@@ -0,0 +1,615 @@
+/// @file hash_benchmark.cpp
+/// @brief Throughput and latency of every scl::hash hasher.
+///
+/// Benchmark families (filter with `--benchmark_filter=<regex>`):
+///   - `<hasher>/<view>/<alignment>/<size>` — one input of 1 B .. 16 MiB as a
+///     `std::string_view` or `std::span<unsigned char const>`, starting on a
+///     64-byte boundary (`aligned`) or one byte past it (`misaligned`);
+///   - `<hasher>/deque/<size>` — the same bytes in a non-contiguous `std::deque`;
+///   - `key/<hasher>/<length>` — `key<Hasher>` construction from one short string;
+///   - `batch/<hasher>/<length>` — `key<Hasher>` over 1024 distinct strings,
+///     plus `batch/siphash_batch/<length>` for the SIMD batch kernel;
+///   - `simd/<kernel>/<level>/<size>` — dispatched kernels at each supported
+///     @ref scl::hash::simd_level;
+///   - `dispatch/<method>` — routing 1024 random `key<>` values among 256
+///     labels: @ref scl::hash::key_switch against the binary search a
+///     `switch` over sparse digests compiles to;
+///   - `map/<container>/<size>` — looking up 4096 random present `key<>`
+///     values in a table of 1 Ki .. 4 Mi entries: @ref scl::hash::key_map
+///     against `std::unordered_map`;
+///   - `intern/<pool>/threads:<n>` — 1..16 threads each interning 4096
+///     metric labels drawn from 1024 distinct ones: @ref scl::hash::intern_pool
+///     with SipHash and XXH3 against a `std::unordered_set<std::string>`
+///     behind one mutex;
+///   - `lookup/<argument>` — finding 40-byte paths in a
+///     `std::unordered_map<std::string, int>` by a `std::string_view`: through
+///     a temporary `std::string`, through @ref scl::hash::transparent_hash, and
+///     by a @ref scl::hash::key_view hashed in advance;
+///   - `string/<op>/<type>` — `equal` compares 1024 pairs of 24-byte join
+///     keys, half of them equal and the rest differing only in the last
+///     byte; `hash` re-hashes 1024 such keys: `std::string` against
+///     @ref scl::hash::hashed_string.
+///
+/// Every benchmark reports bytes/s and the counters `ns/hash` and
+/// `cycles/byte`: plain averages over all iterations of the wall-clock time
+/// of the timing loop. Cycles are derived from that time and the nominal clock
+/// reported by the benchmark library, so they are reference (TSC) cycles;
+/// under frequency scaling or turbo they differ from core cycles.
+///
+/// Machine-readable output: `--benchmark_format=json` or
+/// `--benchmark_out=hash.json --benchmark_out_format=json`.
+///
+/// A new hasher is covered by adding one line to `register_all()`.
+
+#include <benchmark/benchmark.h>
+
+#include <scl/utility/hash.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace ::scl::hash;
+
+namespace
+{
+    /// Largest input of the size sweep: 16 MiB.
+    constexpr ::std::size_t max_size = ::std::size_t{16} << 20;
+
+    /// Alignment of the `aligned` inputs.
+    constexpr ::std::size_t alignment = 64;
+
+    /// Number of distinct strings of a `batch/` benchmark.
+    constexpr ::std::size_t batch_size = 1024;
+
+    /// Short-key lengths of the `key/` and `batch/` benchmarks.
+    constexpr ::std::int64_t key_lengths[] = {1, 4, 8, 12, 16, 24, 32, 64};
+
+    /// Pseudo-random bytes: @ref max_size plus slack, starting on an @ref alignment boundary.
+    unsigned char const * buffer()
+    {
+        static ::std::vector<unsigned char> const storage = [] {
+            ::std::vector<unsigned char> bytes(max_size + 2 * alignment);
+            ::std::uint64_t x = 0x9e3779b97f4a7c15ull;
+            for (auto & b : bytes)
+            {
+                x ^= x << 13;
+                x ^= x >> 7;
+                x ^= x << 17;
+                b = static_cast<unsigned char>(x);
+            }
+            return bytes;
+        }();
+        auto const address = reinterpret_cast<::std::uintptr_t>(storage.data());
+        return storage.data() + (alignment - address % alignment) % alignment;
+    }
+
+    /// Wall-clock time since construction; started just before a timing loop.
+    struct loop_timer
+    {
+        ::std::chrono::steady_clock::time_point start = ::std::chrono::steady_clock::now();
+
+        double elapsed_ns() const
+        {
+            auto const elapsed = ::std::chrono::steady_clock::now() - start;
+            return ::std::chrono::duration<double, ::std::nano>(elapsed).count();
+        }
+    };
+
+    /// Average nanoseconds per item over all iterations of @p state.
+    double ns_per_item(::benchmark::State const & state,
+        loop_timer const & timer,
+        ::std::size_t const items_per_iteration)
+    {
+        double const items =
+            static_cast<double>(state.iterations()) * static_cast<double>(items_per_iteration);
+        return timer.elapsed_ns() / items;
+    }
+
+    /// Sets bytes/s and the `ns/hash` and `cycles/byte` counters.
+    void set_counters(::benchmark::State & state,
+        loop_timer const & timer,
+        ::std::size_t const bytes_per_hash,
+        ::std::size_t const hashes_per_iteration)
+    {
+        double const ns_per_hash = ns_per_item(state, timer, hashes_per_iteration);
+        double const bytes = static_cast<double>(hashes_per_iteration * bytes_per_hash);
+        double const cycles_per_ns = ::benchmark::CPUInfo::Get().cycles_per_second * 1e-9;
+
+        state.SetBytesProcessed(
+            static_cast<::std::int64_t>(static_cast<double>(state.iterations()) * bytes));
+        state.counters["ns/hash"] = ns_per_hash;
+        state.counters["cycles/byte"] =
+            ns_per_hash * cycles_per_ns / static_cast<double>(bytes_per_hash);
+    }
+
+    /// One contiguous input viewed as `View`, starting @p offset bytes past an aligned address.
+    template <typename Hasher, typename View>
+    void bm_contiguous(::benchmark::State & state, ::std::size_t const offset)
+    {
+        auto const size = static_cast<::std::size_t>(state.range(0));
+        View const input{reinterpret_cast<typename View::const_pointer>(buffer() + offset), size};
+        loop_timer const timer;
+        for (auto _ : state)
+            ::benchmark::DoNotOptimize(Hasher{}(input));
+        set_counters(state, timer, size, 1);
+    }
+
+    /// One non-contiguous input: the generic element-by-element path.
+    template <typename Hasher>
+    void bm_deque(::benchmark::State & state)
+    {
+        auto const size = static_cast<::std::size_t>(state.range(0));
+        ::std::deque<unsigned char> const input(buffer(), buffer() + size);
+        loop_timer const timer;
+        for (auto _ : state)
+            ::benchmark::DoNotOptimize(Hasher{}(input));
+        set_counters(state, timer, size, 1);
+    }
+
+    /// `key<Hasher>` construction from one short string.
+    template <typename Hasher>
+    void bm_key(::benchmark::State & state)
+    {
+        auto const size = static_cast<::std::size_t>(state.range(0));
+        ::std::string_view const input{reinterpret_cast<char const *>(buffer()), size};
+        loop_timer const timer;
+        for (auto _ : state)
+            ::benchmark::DoNotOptimize(key<Hasher>{input});
+        set_counters(state, timer, size, 1);
+    }
+
+    /// @ref batch_size distinct strings of one length, at scattered offsets.
+    ::std::vector<::std::string_view> batch_inputs(::std::size_t const size)
+    {
+        ::std::vector<::std::string_view> inputs;
+        inputs.reserve(batch_size);
+        for (::std::size_t i = 0; i < batch_size; ++i)
+            inputs.emplace_back(reinterpret_cast<char const *>(buffer()) + i * 61 % 4096, size);
+        return inputs;
+    }
+
+    /// `key<Hasher>` over @ref batch_size distinct strings, one after another.
+    template <typename Hasher>
+    void bm_batch(::benchmark::State & state)
+    {
+        auto const size = static_cast<::std::size_t>(state.range(0));
+        auto const inputs = batch_inputs(size);
+        loop_timer const timer;
+        for (auto _ : state)
+        {
+            for (::std::string_view const input : inputs)
+                ::benchmark::DoNotOptimize(key<Hasher>{input});
+        }
+        set_counters(state, timer, size, batch_size);
+    }
+
+    /// @ref siphash_batch over @ref batch_size distinct strings.
+    void bm_siphash_batch(::benchmark::State & state)
+    {
+        auto const size = static_cast<::std::size_t>(state.range(0));
+        auto const inputs = batch_inputs(size);
+        ::std::vector<::std::uint64_t> out(inputs.size());
+        loop_timer const timer;
+        for (auto _ : state)
+        {
+            siphash_batch(inputs, out);
+            ::benchmark::DoNotOptimize(out.data());
+            ::benchmark::ClobberMemory();
+        }
+        set_counters(state, timer, size, batch_size);
+    }
+
+    /// One input hashed by `Hasher` with the runtime kernels limited to @p level.
+    template <typename Hasher>
+    void bm_simd(::benchmark::State & state, simd_level const level)
+    {
+        auto const size = static_cast<::std::size_t>(state.range(0));
+        ::std::span<unsigned char const> const input{buffer(), size};
+        force_simd_level(level);
+        loop_timer const timer;
+        for (auto _ : state)
+            ::benchmark::DoNotOptimize(Hasher{}(input));
+        reset_simd_level();
+        set_counters(state, timer, size, 1);
+    }
+
+    /// Number of labels of the `dispatch/` benchmarks.
+    constexpr ::std::size_t dispatch_labels = 256;
+
+    /// Label "cmd<i>" of the `dispatch/` benchmarks.
+    constexpr key<> dispatch_label(::std::size_t const i)
+    {
+        ::std::array<char, 6> const name{'c', 'm', 'd', static_cast<char>('0' + i / 100),
+            static_cast<char>('0' + i / 10 % 10), static_cast<char>('0' + i % 10)};
+        return key<>{name};
+    }
+
+    /// Handler of label @p I.
+    template <int I>
+    struct dispatch_handler
+    {
+        int operator()() const noexcept { return I; }
+    };
+
+    /// @ref batch_size labels in pseudo-random order, so the branch predictor cannot learn them.
+    ::std::vector<key<>> dispatch_inputs()
+    {
+        ::std::vector<key<>> inputs;
+        ::std::uint64_t x = 0x9e3779b97f4a7c15ull;
+        for (::std::size_t i = 0; i < batch_size; ++i)
+        {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            inputs.push_back(dispatch_label(x % dispatch_labels));
+        }
+        return inputs;
+    }
+
+    template <::std::size_t... I>
+    int route_key_switch(key<> const k, ::std::index_sequence<I...>)
+    {
+        return key_switch<dispatch_label(I)...>(
+            k, dispatch_handler<static_cast<int>(I)>{}..., dispatch_handler<-1>{});
+    }
+
+    /// Sorted digests and their handlers: what a `switch` over the labels compiles to.
+    template <::std::size_t... I>
+    int route_binary_search(key<> const k, ::std::index_sequence<I...>)
+    {
+        using handler = int (*)();
+        struct label_case
+        {
+            ::std::uint64_t digest;
+            handler call;
+        };
+        static auto const cases = [] {
+            ::std::array<label_case, dispatch_labels> sorted{label_case{dispatch_label(I).value,
+                [] { return dispatch_handler<static_cast<int>(I)>{}(); }}...};
+            ::std::sort(sorted.begin(), sorted.end(),
+                [](auto const & a, auto const & b) { return a.digest < b.digest; });
+            return sorted;
+        }();
+        auto const it = ::std::lower_bound(cases.begin(), cases.end(), k.value,
+            [](label_case const & c, ::std::uint64_t const d) { return c.digest < d; });
+        return it != cases.end() && it->digest == k.value ? it->call() : -1;
+    }
+
+    /// Routes @ref batch_size random labels with @p route.
+    template <int (*Route)(key<>, ::std::make_index_sequence<dispatch_labels>)>
+    void bm_dispatch(::benchmark::State & state)
+    {
+        auto const inputs = dispatch_inputs();
+        loop_timer const timer;
+        for (auto _ : state)
+        {
+            for (auto const k : inputs)
+                ::benchmark::DoNotOptimize(Route(k, {}));
+        }
+        state.SetItemsProcessed(static_cast<::std::int64_t>(state.iterations() * batch_size));
+        state.counters["ns/dispatch"] = ns_per_item(state, timer, batch_size);
+    }
+
+    /// Number of lookups per iteration of the `map/` benchmarks.
+    constexpr ::std::size_t map_lookups = 4096;
+
+    /// Fills a @p Map with `state.range(0)` keys and looks up random ones.
+    template <typename Map>
+    void bm_map_find(::benchmark::State & state)
+    {
+        auto const size = static_cast<::std::size_t>(state.range(0));
+        ::std::vector<key<>> keys;
+        keys.reserve(size);
+        for (::std::size_t i = 0; i < size; ++i)
+            keys.emplace_back(::std::to_string(i));
+
+        Map map;
+        map.reserve(size);
+        for (::std::size_t i = 0; i < size; ++i)
+            map[keys[i]] = i;
+
+        ::std::vector<key<>> lookups;
+        ::std::uint64_t x = 0x9e3779b97f4a7c15ull;
+        for (::std::size_t i = 0; i < map_lookups; ++i)
+        {
+            x = splitmix64_mixer{}(x);
+            lookups.push_back(keys[fast_range(x, size)]);
+        }
+
+        loop_timer const timer;
+        for (auto _ : state)
+        {
+            for (auto const k : lookups)
+                ::benchmark::DoNotOptimize(map.find(k)->second);
+        }
+        state.SetItemsProcessed(static_cast<::std::int64_t>(state.iterations() * map_lookups));
+        state.counters["ns/lookup"] = ns_per_item(state, timer, map_lookups);
+    }
+
+    /// Number of labels interned per thread and iteration of the `intern/` benchmarks.
+    constexpr ::std::size_t intern_lookups = 4096;
+
+    /// Labels of the `intern/` benchmarks, each repeated several times.
+    ::std::vector<::std::string> const & intern_inputs()
+    {
+        static ::std::vector<::std::string> const inputs = [] {
+            ::std::vector<::std::string> labels;
+            ::std::uint64_t x = 0x9e3779b97f4a7c15ull;
+            for (::std::size_t i = 0; i < intern_lookups; ++i)
+            {
+                x = splitmix64_mixer{}(x);
+                labels.push_back(
+                    "service.requests.latency.p" + ::std::to_string(fast_range(x, batch_size)));
+            }
+            return labels;
+        }();
+        return inputs;
+    }
+
+    /// `std::unordered_set<std::string>` shared through one mutex: the usual baseline.
+    struct locked_string_set
+    {
+        ::std::string_view intern(::std::string const & text)
+        {
+            ::std::lock_guard const lock{mutex};
+            return *set.insert(text).first;
+        }
+
+        ::std::mutex mutex;
+        ::std::unordered_set<::std::string> set;
+    };
+
+    /// Interns @ref intern_lookups labels per thread into one shared @p Pool.
+    template <typename Pool>
+    void bm_intern(::benchmark::State & state)
+    {
+        static Pool * pool = nullptr;
+        if (state.thread_index() == 0)
+            pool = new Pool;
+        auto const & inputs = intern_inputs();
+
+        loop_timer const timer;
+        for (auto _ : state)
+        {
+            for (auto const & label : inputs)
+                ::benchmark::DoNotOptimize(pool->intern(label));
+        }
+        state.SetItemsProcessed(static_cast<::std::int64_t>(state.iterations() * intern_lookups));
+        state.counters["ns/intern"] = ::benchmark::Counter(
+            ns_per_item(state, timer, intern_lookups), ::benchmark::Counter::kAvgThreads);
+        if (state.thread_index() == 0)
+            delete pool;
+    }
+
+    /// Paths of the `lookup/` benchmarks: longer than the short-string buffer.
+    ::std::vector<::std::string> const & lookup_paths()
+    {
+        static ::std::vector<::std::string> const paths = [] {
+            ::std::vector<::std::string> out;
+            for (::std::size_t i = 0; i < batch_size; ++i)
+                out.push_back(
+                    "/api/v1/tenants/" + ::std::to_string(1000000 + i) + "/resources/items");
+            return out;
+        }();
+        return paths;
+    }
+
+    /// `std::unordered_map<std::string, int>` with the default hash: a lookup by view builds a `std::string`.
+    void bm_lookup_string(::benchmark::State & state)
+    {
+        ::std::unordered_map<::std::string, int> map;
+        for (auto const & p : lookup_paths())
+            map.emplace(p, 1);
+        ::std::vector<::std::string_view> const views(lookup_paths().begin(), lookup_paths().end());
+        for (auto _ : state)
+        {
+            for (auto const v : views)
+                ::benchmark::DoNotOptimize(map.find(::std::string{v}));
+        }
+        state.SetItemsProcessed(static_cast<::std::int64_t>(state.iterations() * batch_size));
+    }
+
+    /// Transparent hash over @p Hasher; with @p Prehashed, the lookups use @ref key_view values built in advance.
+    template <typename Hasher, bool Prehashed>
+    void bm_lookup_transparent(::benchmark::State & state)
+    {
+        ::std::unordered_map<::std::string, int, transparent_hash<Hasher>, transparent_equal> map;
+        for (auto const & p : lookup_paths())
+            map.emplace(p, 1);
+        ::std::vector<::std::string_view> const views(lookup_paths().begin(), lookup_paths().end());
+        ::std::vector<key_view<Hasher>> keyed;
+        for (auto const v : views)
+            keyed.emplace_back(v);
+        for (auto _ : state)
+        {
+            if constexpr (Prehashed)
+            {
+                for (auto const & k : keyed)
+                    ::benchmark::DoNotOptimize(map.find(k));
+            }
+            else
+            {
+                for (auto const v : views)
+                    ::benchmark::DoNotOptimize(map.find(v));
+            }
+        }
+        state.SetItemsProcessed(static_cast<::std::int64_t>(state.iterations() * batch_size));
+    }
+
+    /// Join keys of the `string/` benchmarks: a shared prefix, so only the last bytes differ.
+    ::std::vector<::std::string> string_keys(char const last)
+    {
+        ::std::vector<::std::string> out;
+        for (::std::size_t i = 0; i < batch_size; ++i)
+        {
+            auto k = "customer/" + ::std::to_string(100000000 + i) + "/eu-west";
+            if (i % 2 == 1)
+                k.back() = last;
+            out.push_back(::std::move(k));
+        }
+        return out;
+    }
+
+    /// Compares @ref batch_size pairs of @p String.
+    template <typename String>
+    void bm_string_equal(::benchmark::State & state)
+    {
+        auto const left = string_keys('t');
+        auto const right = string_keys('x');
+        ::std::vector<String> a;
+        ::std::vector<String> b;
+        for (::std::size_t i = 0; i < batch_size; ++i)
+        {
+            a.emplace_back(::std::string_view{left[i]});
+            b.emplace_back(::std::string_view{right[i]});
+        }
+        for (auto _ : state)
+        {
+            for (::std::size_t i = 0; i < batch_size; ++i)
+                ::benchmark::DoNotOptimize(a[i] == b[i]);
+        }
+        state.SetItemsProcessed(static_cast<::std::int64_t>(state.iterations() * batch_size));
+    }
+
+    /// Hashes @ref batch_size values of @p String with `std::hash`.
+    template <typename String>
+    void bm_string_hash(::benchmark::State & state)
+    {
+        auto const keys = string_keys('t');
+        ::std::vector<String> values;
+        for (auto const & k : keys)
+            values.emplace_back(::std::string_view{k});
+        for (auto _ : state)
+        {
+            for (auto const & v : values)
+                ::benchmark::DoNotOptimize(::std::hash<String>{}(v));
+        }
+        state.SetItemsProcessed(static_cast<::std::int64_t>(state.iterations() * batch_size));
+    }
+
+    /// Registers every benchmark family for one hasher.
+    template <typename Hasher>
+    void register_hasher(::std::string const & name)
+    {
+        using bytes_view = ::std::span<unsigned char const>;
+        auto const sweep = [](::benchmark::internal::Benchmark * b) {
+            b->RangeMultiplier(4)->Range(1, static_cast<::std::int64_t>(max_size));
+        };
+
+        sweep(::benchmark::RegisterBenchmark((name + "/string_view/aligned").c_str(),
+            bm_contiguous<Hasher, ::std::string_view>,
+            ::std::size_t{0}));
+        sweep(::benchmark::RegisterBenchmark((name + "/string_view/misaligned").c_str(),
+            bm_contiguous<Hasher, ::std::string_view>,
+            ::std::size_t{1}));
+        sweep(::benchmark::RegisterBenchmark((name + "/span/aligned").c_str(),
+            bm_contiguous<Hasher, bytes_view>,
+            ::std::size_t{0}));
+        sweep(::benchmark::RegisterBenchmark((name + "/span/misaligned").c_str(),
+            bm_contiguous<Hasher, bytes_view>,
+            ::std::size_t{1}));
+        sweep(::benchmark::RegisterBenchmark((name + "/deque").c_str(), bm_deque<Hasher>));
+
+        auto * const key_bm =
+            ::benchmark::RegisterBenchmark(("key/" + name).c_str(), bm_key<Hasher>);
+        auto * const batch_bm =
+            ::benchmark::RegisterBenchmark(("batch/" + name).c_str(), bm_batch<Hasher>);
+        for (::std::int64_t const length : key_lengths)
+        {
+            key_bm->Arg(length);
+            batch_bm->Arg(length);
+        }
+    }
+
+    /// Registers one dispatched kernel at every level up to the detected one.
+    template <typename Hasher>
+    void register_simd(::std::string const & name)
+    {
+        static constexpr char const * level_names[] = {
+            "scalar", "sse2", "sse42", "avx2", "avx512"};
+        for (auto level = simd_level::scalar; level <= detected_simd_level();
+             level = static_cast<simd_level>(static_cast<int>(level) + 1))
+        {
+            ::benchmark::RegisterBenchmark(
+                ("simd/" + name + "/" + level_names[static_cast<int>(level)]).c_str(),
+                bm_simd<Hasher>,
+                level)
+                ->RangeMultiplier(16)
+                ->Range(1 << 10, static_cast<::std::int64_t>(max_size));
+        }
+    }
+
+    int register_all()
+    {
+        register_hasher<fnv1a_hasher>("fnv1a");
+        register_hasher<djb2_hasher>("djb2");
+        register_hasher<sdbm_hasher>("sdbm");
+        register_hasher<jenkins_ota_hasher>("jenkins_ota");
+        register_hasher<siphash_hasher<>>("siphash");
+        register_hasher<siphash13_hasher<>>("siphash13");
+        register_hasher<halfsiphash_hasher<>>("halfsiphash");
+        register_hasher<xxh64_hasher<>>("xxh64");
+        register_hasher<xxh3_hasher<>>("xxh3_64");
+        register_hasher<rapidhash_hasher<>>("rapidhash");
+        register_hasher<crc32c_hasher>("crc32c");
+        register_hasher<siphash128_hasher<>>("siphash128");
+        register_hasher<xxh3_128_hasher<>>("xxh3_128");
+        register_hasher<murmur3_x64_128_hasher<>>("murmur3_x64_128");
+
+        auto * const siphash_batch_bm =
+            ::benchmark::RegisterBenchmark("batch/siphash_batch", bm_siphash_batch);
+        for (::std::int64_t const length : key_lengths)
+            siphash_batch_bm->Arg(length);
+
+        register_simd<xxh3_hasher<>>("xxh3_64");
+        register_simd<xxh3_128_hasher<>>("xxh3_128");
+        register_simd<crc32c_hasher>("crc32c");
+
+        ::benchmark::RegisterBenchmark("dispatch/binary_search", bm_dispatch<route_binary_search>);
+        ::benchmark::RegisterBenchmark("dispatch/key_switch", bm_dispatch<route_key_switch>);
+
+        for (auto * const b : {
+                 ::benchmark::RegisterBenchmark("map/unordered_map",
+                     bm_map_find<::std::unordered_map<key<>, ::std::size_t>>),
+                 ::benchmark::RegisterBenchmark(
+                     "map/key_map", bm_map_find<key_map<::std::size_t>>)})
+            b->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+        for (auto * const b : {
+                 ::benchmark::RegisterBenchmark(
+                     "intern/locked_unordered_set", bm_intern<locked_string_set>),
+                 ::benchmark::RegisterBenchmark(
+                     "intern/intern_pool/siphash", bm_intern<intern_pool<>>),
+                 ::benchmark::RegisterBenchmark(
+                     "intern/intern_pool/xxh3_64", bm_intern<intern_pool<xxh3_hasher<>>>)})
+            b->ThreadRange(1, 16)->UseRealTime();
+
+        ::benchmark::RegisterBenchmark("lookup/std_string", bm_lookup_string);
+        ::benchmark::RegisterBenchmark("lookup/transparent_hash/xxh3_64",
+            bm_lookup_transparent<xxh3_hasher<>, false>);
+        ::benchmark::RegisterBenchmark(
+            "lookup/key_view/xxh3_64", bm_lookup_transparent<xxh3_hasher<>, true>);
+
+        ::benchmark::RegisterBenchmark("string/equal/std_string", bm_string_equal<::std::string>);
+        ::benchmark::RegisterBenchmark(
+            "string/equal/hashed_string", bm_string_equal<hashed_string<xxh3_hasher<>>>);
+        ::benchmark::RegisterBenchmark("string/hash/std_string", bm_string_hash<::std::string>);
+        ::benchmark::RegisterBenchmark(
+            "string/hash/hashed_string", bm_string_hash<hashed_string<xxh3_hasher<>>>);
+        return 0;
+    }
+
+    [[maybe_unused]] int const registered = register_all();
+} // namespace
@@ -0,0 +1,485 @@
+/// @file hash_quality_benchmark.cpp
+/// @brief SMHasher-style distribution quality and short-key latency of every scl::hash hasher.
+///
+/// Quality families run once each (one iteration) on a fixed pseudo-random
+/// seed, so the numbers are the same on every run and every machine:
+///   - `avalanche/<hasher>/<length>` — flipping one input bit must flip each
+///     output bit with probability 1/2 (strict avalanche criterion);
+///   - `bic/<hasher>/<length>` — flips of any two output bits caused by one
+///     input bit must be independent (bit independence criterion);
+///   - `sparse/<hasher>/<length>/<bits>` — every key of `<length>` bytes with
+///     at most `<bits>` bits set; digest collisions;
+///   - `cyclic/<hasher>/<cycle>` — keys made of a distinct `<cycle>`-byte block
+///     repeated 8 times; digest collisions;
+///   - `buckets/<hasher>/<set>/<log2>` — keys indexed into 2^`<log2>` buckets by
+///     the low bits of `std::hash<key<Hasher>>`, as a power-of-two table does;
+///     `<set>` is `text` (`"id<n>"`) or `highbit` (bytes 0x00 / 0x80 only).
+///
+/// Each quality benchmark reports its statistic, the limit an ideal random
+/// function stays under, and `pass` (1 or 0); the label reads `pass` or `FAIL`.
+///   - Avalanche and BIC report `worst_bias`, the largest |2p - 1| over all
+///     cells. The limit is the largest deviation an ideal function shows at
+///     this sample count, plus two standard deviations.
+///   - Collision tests report `collisions` and `expected` on the full digest
+///     and on its low 32 bits (`*_low32`); the limit is `2 * expected + 2`.
+///   - Bucket tests report `chi2_z`, the chi-square statistic of the bucket
+///     loads as standard deviations above its mean; the limit is 5.
+///
+/// `latency/<hasher>/<length>` feeds each digest into the next key, so it
+/// measures the latency of one short-key hash rather than throughput (see
+/// `key/` in hash_benchmark.cpp); it reports `ns/hash`.
+///
+/// List the failures with
+/// `--benchmark_filter='^(avalanche|bic|sparse|cyclic|buckets)/' --benchmark_format=json`
+/// and look for `"pass": 0`. A new hasher is covered by adding one line to `register_all()`.
+
+#include <benchmark/benchmark.h>
+
+#include <scl/utility/hash.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ::scl::hash;
+
+namespace
+{
+    /// Random keys per input bit of the avalanche test.
+    constexpr ::std::size_t avalanche_samples = 10000;
+
+    /// Random keys per input bit of the bit independence test.
+    constexpr ::std::size_t bic_samples = 2000;
+
+    /// Keys of the cyclic test.
+    constexpr ::std::size_t cyclic_keys = 100000;
+
+    /// Repetitions of the block in a cyclic key.
+    constexpr ::std::size_t cyclic_repeats = 8;
+
+    /// Keys per bucket of the bucket test.
+    constexpr ::std::size_t bucket_load = 4;
+
+    /// Largest chi-square excess, in standard deviations, of a passing bucket test.
+    constexpr double bucket_z_limit = 5.0;
+
+    /// Deterministic xorshift64 generator.
+    struct xorshift
+    {
+        ::std::uint64_t x = 0x9e3779b97f4a7c15ull;
+
+        ::std::uint64_t operator()() noexcept
+        {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            return x;
+        }
+
+        void fill(::std::span<unsigned char> const bytes) noexcept
+        {
+            for (auto & b : bytes)
+                b = static_cast<unsigned char>((*this)() >> 56);
+        }
+    };
+
+    /// Width of digest type `D` in bits.
+    template <typename D>
+    constexpr ::std::size_t digest_bits = ::std::same_as<D, uint128> ? 128 : sizeof(D) * 8;
+
+    /// Bit @p i of a digest.
+    template <typename D>
+    unsigned digest_bit(D const d, ::std::size_t const i) noexcept
+    {
+        if constexpr (::std::same_as<D, uint128>)
+            return static_cast<unsigned>(((i < 64 ? d.lo : d.hi) >> (i % 64)) & 1);
+        else
+            return static_cast<unsigned>((static_cast<::std::uint64_t>(d) >> i) & 1);
+    }
+
+    /// Bitwise XOR of two digests.
+    template <typename D>
+    D digest_xor(D const a, D const b) noexcept
+    {
+        if constexpr (::std::same_as<D, uint128>)
+            return uint128{.lo = a.lo ^ b.lo, .hi = a.hi ^ b.hi};
+        else
+            return static_cast<D>(a ^ b);
+    }
+
+    /// Low 32 bits of a digest.
+    template <typename D>
+    ::std::uint32_t digest_low32(D const d) noexcept
+    {
+        if constexpr (::std::same_as<D, uint128>)
+            return static_cast<::std::uint32_t>(d.lo);
+        else
+            return static_cast<::std::uint32_t>(d);
+    }
+
+    /// One contiguous key hashed by `Hasher`.
+    template <typename Hasher>
+    typename Hasher::result_type hash_bytes(::std::span<unsigned char const> const bytes)
+    {
+        return Hasher{}(bytes);
+    }
+
+    /// Largest |2p - 1| an ideal random function is expected to reach over
+    /// @p cells independent cells of @p samples trials each, plus two standard deviations.
+    double bias_limit(double const cells, double const samples)
+    {
+        return (::std::sqrt(2.0 * ::std::log(2.0 * cells)) + 2.0) / ::std::sqrt(samples);
+    }
+
+    /// Expected number of colliding pairs among @p keys uniform @p bits-bit values.
+    double expected_collisions(double const keys, ::std::size_t const bits)
+    {
+        return keys * (keys - 1.0) / 2.0 / ::std::ldexp(1.0, static_cast<int>(bits));
+    }
+
+    /// Largest collision count of a passing test.
+    double collision_limit(double const expected) { return 2.0 * expected + 2.0; }
+
+    /// Number of values equal to their predecessor after sorting.
+    template <typename T>
+    ::std::size_t count_collisions(::std::vector<T> values)
+    {
+        ::std::sort(values.begin(), values.end());
+        ::std::size_t collisions = 0;
+        for (::std::size_t i = 1; i < values.size(); ++i)
+            collisions += values[i] == values[i - 1] ? 1 : 0;
+        return collisions;
+    }
+
+    /// Records the verdict of one quality test as the `pass` counter and the label.
+    void set_verdict(::benchmark::State & state, bool const pass)
+    {
+        state.counters["pass"] = pass ? 1 : 0;
+        state.SetLabel(pass ? "pass" : "FAIL");
+    }
+
+    /// Strict avalanche criterion over random keys of `state.range(0)` bytes.
+    template <typename Hasher>
+    void bm_avalanche(::benchmark::State & state)
+    {
+        using digest = typename Hasher::result_type;
+        constexpr ::std::size_t out_bits = digest_bits<digest>;
+        auto const length = static_cast<::std::size_t>(state.range(0));
+        auto const in_bits = length * 8;
+
+        ::std::vector<::std::uint32_t> flips(in_bits * out_bits);
+        for (auto _ : state)
+        {
+            ::std::fill(flips.begin(), flips.end(), 0);
+            xorshift rng;
+            ::std::vector<unsigned char> bytes(length);
+            for (::std::size_t n = 0; n < avalanche_samples; ++n)
+            {
+                rng.fill(bytes);
+                digest const base = hash_bytes<Hasher>(bytes);
+                for (::std::size_t i = 0; i < in_bits; ++i)
+                {
+                    bytes[i / 8] ^= static_cast<unsigned char>(1u << (i % 8));
+                    digest const d = digest_xor(base, hash_bytes<Hasher>(bytes));
+                    bytes[i / 8] ^= static_cast<unsigned char>(1u << (i % 8));
+                    auto * const row = flips.data() + i * out_bits;
+                    for (::std::size_t k = 0; k < out_bits; ++k)
+                        row[k] += digest_bit(d, k);
+                }
+            }
+        }
+
+        double worst = 0;
+        for (auto const count : flips)
+            worst = ::std::max(worst,
+                ::std::abs(2.0 * count / static_cast<double>(avalanche_samples) - 1.0));
+        double const limit = bias_limit(static_cast<double>(flips.size()), avalanche_samples);
+        state.counters["worst_bias"] = worst;
+        state.counters["limit"] = limit;
+        set_verdict(state, worst <= limit);
+    }
+
+    /// Bit independence criterion over random keys of `state.range(0)` bytes.
+    template <typename Hasher>
+    void bm_bic(::benchmark::State & state)
+    {
+        using digest = typename Hasher::result_type;
+        constexpr ::std::size_t out_bits = digest_bits<digest>;
+        auto const length = static_cast<::std::size_t>(state.range(0));
+        auto const in_bits = length * 8;
+
+        // For input bit i: single[i][j] counts flips of output bit j and
+        // both[i][j][k] counts joint flips of output bits j and k.
+        ::std::vector<::std::uint32_t> single(in_bits * out_bits);
+        ::std::vector<::std::uint32_t> both(in_bits * out_bits * out_bits);
+        for (auto _ : state)
+        {
+            ::std::fill(single.begin(), single.end(), 0);
+            ::std::fill(both.begin(), both.end(), 0);
+            xorshift rng;
+            ::std::vector<unsigned char> bytes(length);
+            ::std::array<::std::uint32_t, out_bits> bits{};
+            for (::std::size_t n = 0; n < bic_samples; ++n)
+            {
+                rng.fill(bytes);
+                digest const base = hash_bytes<Hasher>(bytes);
+                for (::std::size_t i = 0; i < in_bits; ++i)
+                {
+                    bytes[i / 8] ^= static_cast<unsigned char>(1u << (i % 8));
+                    digest const d = digest_xor(base, hash_bytes<Hasher>(bytes));
+                    bytes[i / 8] ^= static_cast<unsigned char>(1u << (i % 8));
+                    for (::std::size_t k = 0; k < out_bits; ++k)
+                        bits[k] = digest_bit(d, k);
+                    auto * const row = single.data() + i * out_bits;
+                    for (::std::size_t j = 0; j < out_bits; ++j)
+                    {
+                        row[j] += bits[j];
+                        if (bits[j] == 0)
+                            continue;
+                        auto * const pair = both.data() + (i * out_bits + j) * out_bits;
+                        for (::std::size_t k = 0; k < out_bits; ++k)
+                            pair[k] += bits[k];
+                    }
+                }
+            }
+        }
+
+        // Bias of "bit j flipped XOR bit k flipped", which is 1/2 when the
+        // two flips are independent and each happens half of the time.
+        double worst = 0;
+        for (::std::size_t i = 0; i < in_bits; ++i)
+        {
+            auto const * const row = single.data() + i * out_bits;
+            for (::std::size_t j = 0; j < out_bits; ++j)
+            {
+                auto const * const pair = both.data() + (i * out_bits + j) * out_bits;
+                for (::std::size_t k = j + 1; k < out_bits; ++k)
+                {
+                    double const differ = double(row[j]) + double(row[k]) - 2.0 * pair[k];
+                    worst = ::std::max(worst,
+                        ::std::abs(2.0 * differ / static_cast<double>(bic_samples) - 1.0));
+                }
+            }
+        }
+        double const cells = double(in_bits) * out_bits * (out_bits - 1) / 2;
+        double const limit = bias_limit(cells, bic_samples);
+        state.counters["worst_bias"] = worst;
+        state.counters["limit"] = limit;
+        set_verdict(state, worst <= limit);
+    }
+
+    /// Reports full-digest and low-32-bit collisions of @p digests.
+    template <typename D>
+    void report_collisions(::benchmark::State & state, ::std::vector<D> const & digests)
+    {
+        auto const keys = static_cast<double>(digests.size());
+        ::std::vector<::std::uint32_t> low(digests.size());
+        ::std::transform(digests.begin(), digests.end(), low.begin(), digest_low32<D>);
+
+        auto const collisions = static_cast<double>(count_collisions(digests));
+        auto const collisions_low32 = static_cast<double>(count_collisions(::std::move(low)));
+        double const expected = expected_collisions(keys, digest_bits<D>);
+        double const expected_low32 = expected_collisions(keys, 32);
+
+        state.counters["keys"] = keys;
+        state.counters["collisions"] = collisions;
+        state.counters["expected"] = expected;
+        state.counters["collisions_low32"] = collisions_low32;
+        state.counters["expected_low32"] = expected_low32;
+        set_verdict(state,
+            collisions <= collision_limit(expected)
+                && collisions_low32 <= collision_limit(expected_low32));
+    }
+
+    /// Calls @p emit for every bit pattern of @p bytes with at most @p bits bits set.
+    void for_each_sparse(::std::vector<unsigned char> & bytes,
+        ::std::size_t const first,
+        ::std::size_t const bits,
+        ::std::function<void()> const & emit)
+    {
+        emit();
+        if (bits == 0)
+            return;
+        for (::std::size_t i = first; i < bytes.size() * 8; ++i)
+        {
+            bytes[i / 8] ^= static_cast<unsigned char>(1u << (i % 8));
+            for_each_sparse(bytes, i + 1, bits - 1, emit);
+            bytes[i / 8] ^= static_cast<unsigned char>(1u << (i % 8));
+        }
+    }
+
+    /// Every `state.range(0)`-byte key with at most `state.range(1)` bits set.
+    template <typename Hasher>
+    void bm_sparse(::benchmark::State & state)
+    {
+        using digest = typename Hasher::result_type;
+        auto const length = static_cast<::std::size_t>(state.range(0));
+        auto const bits = static_cast<::std::size_t>(state.range(1));
+
+        ::std::vector<digest> digests;
+        for (auto _ : state)
+        {
+            digests.clear();
+            ::std::vector<unsigned char> bytes(length);
+            for_each_sparse(bytes, 0, bits, [&] { digests.push_back(hash_bytes<Hasher>(bytes)); });
+        }
+        report_collisions(state, digests);
+    }
+
+    /// @ref cyclic_keys keys, each a distinct `state.range(0)`-byte block repeated @ref cyclic_repeats times.
+    template <typename Hasher>
+    void bm_cyclic(::benchmark::State & state)
+    {
+        using digest = typename Hasher::result_type;
+        auto const cycle = static_cast<::std::size_t>(state.range(0));
+
+        ::std::vector<digest> digests(cyclic_keys);
+        for (auto _ : state)
+        {
+            xorshift rng;
+            ::std::vector<unsigned char> block(cycle);
+            ::std::vector<unsigned char> bytes(cycle * cyclic_repeats);
+            for (::std::size_t n = 0; n < cyclic_keys; ++n)
+            {
+                // The first four bytes are a bijection of n, so the blocks are distinct.
+                rng.fill(block);
+                auto const id = static_cast<::std::uint32_t>(n * 0x9e3779b1u);
+                for (::std::size_t b = 0; b < 4; ++b)
+                    block[b] = static_cast<unsigned char>(id >> (8 * b));
+                for (::std::size_t r = 0; r < cyclic_repeats; ++r)
+                    ::std::copy(block.begin(), block.end(), bytes.begin() + r * cycle);
+                digests[n] = hash_bytes<Hasher>(bytes);
+            }
+        }
+        report_collisions(state, digests);
+    }
+
+    /// Key sets of the bucket test.
+    enum class bucket_keys
+    {
+        text,    ///< `"id0"`, `"id1"`, ...
+        highbit, ///< 24 bytes, byte j is 0x80 when bit j of the key number is set, else 0.
+    };
+
+    /// Keys of the @p set indexed into `2^state.range(0)` buckets.
+    template <typename Hasher>
+    void bm_buckets(::benchmark::State & state, bucket_keys const set)
+    {
+        auto const buckets = ::std::size_t{1} << state.range(0);
+        auto const keys = buckets * bucket_load;
+
+        ::std::vector<::std::uint32_t> load(buckets);
+        for (auto _ : state)
+        {
+            ::std::fill(load.begin(), load.end(), 0);
+            ::std::string text;
+            ::std::vector<unsigned char> bytes(24);
+            for (::std::size_t n = 0; n < keys; ++n)
+            {
+                ::std::size_t h = 0;
+                if (set == bucket_keys::text)
+                {
+                    text = "id" + ::std::to_string(n);
+                    h = ::std::hash<key<Hasher>>{}(key<Hasher>{text});
+                }
+                else
+                {
+                    for (::std::size_t j = 0; j < bytes.size(); ++j)
+                        bytes[j] = static_cast<unsigned char>(((n >> j) & 1) << 7);
+                    h = ::std::hash<key<Hasher>>{}(key<Hasher>{bytes});
+                }
+                ++load[h & (buckets - 1)];
+            }
+        }
+
+        double chi2 = 0;
+        for (auto const l : load)
+            chi2 += (l - double(bucket_load)) * (l - double(bucket_load)) / bucket_load;
+        double const dof = static_cast<double>(buckets - 1);
+        double const z = (chi2 - dof) / ::std::sqrt(2.0 * dof);
+        state.counters["chi2_z"] = z;
+        state.counters["limit"] = bucket_z_limit;
+        set_verdict(state, z <= bucket_z_limit);
+    }
+
+    /// One `state.range(0)`-byte key whose first byte depends on the previous digest.
+    template <typename Hasher>
+    void bm_latency(::benchmark::State & state)
+    {
+        auto const length = static_cast<::std::size_t>(state.range(0));
+        ::std::vector<unsigned char> bytes(length);
+        xorshift{}.fill(bytes);
+        for (auto _ : state)
+        {
+            auto const d = hash_bytes<Hasher>(bytes);
+            bytes[0] ^= static_cast<unsigned char>(digest_low32(d));
+        }
+        ::benchmark::DoNotOptimize(bytes.data());
+        state.counters["ns/hash"] = ::benchmark::Counter(1e-9,
+            ::benchmark::Counter::kIsIterationInvariantRate | ::benchmark::Counter::kInvert);
+    }
+
+    /// Registers every quality and latency family for one hasher.
+    template <typename Hasher>
+    void register_hasher(::std::string const & name)
+    {
+        auto const once = [](::benchmark::internal::Benchmark * b) {
+            b->Iterations(1)->Unit(::benchmark::kMillisecond);
+        };
+
+        once(::benchmark::RegisterBenchmark(("avalanche/" + name).c_str(), bm_avalanche<Hasher>)
+                ->Arg(4)
+                ->Arg(8)
+                ->Arg(16)
+                ->Arg(32));
+        once(::benchmark::RegisterBenchmark(("bic/" + name).c_str(), bm_bic<Hasher>)->Arg(8));
+        once(::benchmark::RegisterBenchmark(("sparse/" + name).c_str(), bm_sparse<Hasher>)
+                ->Args({4, 5})
+                ->Args({8, 4})
+                ->Args({16, 3}));
+        once(::benchmark::RegisterBenchmark(("cyclic/" + name).c_str(), bm_cyclic<Hasher>)
+                ->Arg(4)
+                ->Arg(8)
+                ->Arg(16));
+        for (auto const & [set, set_name] : {::std::pair{bucket_keys::text, "text"},
+                 ::std::pair{bucket_keys::highbit, "highbit"}})
+        {
+            once(::benchmark::RegisterBenchmark(
+                ("buckets/" + name + "/" + set_name).c_str(), bm_buckets<Hasher>, set)
+                    ->DenseRange(8, 20, 4));
+        }
+        ::benchmark::RegisterBenchmark(("latency/" + name).c_str(), bm_latency<Hasher>)
+            ->DenseRange(1, 16, 1)
+            ->Arg(24)
+            ->Arg(32)
+            ->Arg(64);
+    }
+
+    int register_all()
+    {
+        register_hasher<fnv1a_hasher>("fnv1a");
+        register_hasher<djb2_hasher>("djb2");
+        register_hasher<sdbm_hasher>("sdbm");
+        register_hasher<jenkins_ota_hasher>("jenkins_ota");
+        register_hasher<siphash_hasher<>>("siphash");
+        register_hasher<siphash13_hasher<>>("siphash13");
+        register_hasher<halfsiphash_hasher<>>("halfsiphash");
+        register_hasher<xxh64_hasher<>>("xxh64");
+        register_hasher<xxh3_hasher<>>("xxh3_64");
+        register_hasher<rapidhash_hasher<>>("rapidhash");
+        register_hasher<crc32c_hasher>("crc32c");
+        register_hasher<siphash128_hasher<>>("siphash128");
+        register_hasher<xxh3_128_hasher<>>("xxh3_128");
+        register_hasher<murmur3_x64_128_hasher<>>("murmur3_x64_128");
+        return 0;
+    }
+
+    [[maybe_unused]] int const registered = register_all();
+} // namespace
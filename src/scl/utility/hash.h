@@ -12,11 +12,33 @@
  * @{
  */
 
+#include <scl/utility/hash/case_fold.h>
+#include <scl/utility/hash/crc32c.h>
+#include <scl/utility/hash/dispatch.h>
 #include <scl/utility/hash/djb2.h>
 #include <scl/utility/hash/fnv1a.h>
+#include <scl/utility/hash/halfsiphash.h>
+#include <scl/utility/hash/hash_append.h>
+#include <scl/utility/hash/hash_file.h>
+#include <scl/utility/hash/hashed_string.h>
+#include <scl/utility/hash/intern_pool.h>
 #include <scl/utility/hash/jenkins_ota.h>
 #include <scl/utility/hash/key.h>
+#include <scl/utility/hash/key_map.h>
+#include <scl/utility/hash/key_registry.h>
+#include <scl/utility/hash/key_switch.h>
+#include <scl/utility/hash/mix.h>
+#include <scl/utility/hash/murmur3.h>
+#include <scl/utility/hash/rapidhash.h>
 #include <scl/utility/hash/sdbm.h>
 #include <scl/utility/hash/siphash.h>
+#include <scl/utility/hash/siphash_batch.h>
+#include <scl/utility/hash/siphash_runtime.h>
+#include <scl/utility/hash/static_map.h>
+#include <scl/utility/hash/transparent.h>
+#include <scl/utility/hash/tree_hash.h>
+#include <scl/utility/hash/uint128.h>
+#include <scl/utility/hash/xxh3.h>
+#include <scl/utility/hash/xxh64.h>
 
 /** @} */ // end of group scl_utility_hash
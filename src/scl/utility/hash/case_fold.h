@@ -0,0 +1,339 @@
+#pragma once
+
+/// @file case_fold.h
+/// @brief ASCII case-insensitive hashing: states and hashers that fold `A`–`Z` to `a`–`z` while hashing.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/detail/load.h>
+#include <scl/utility/hash/detail/segments.h>
+#include <scl/utility/hash/dispatch.h>
+#include <scl/utility/hash/fnv1a.h>
+#include <scl/utility/hash/key.h>
+#include <scl/utility/hash/siphash.h>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace scl::hash
+{
+    namespace detail
+    {
+        /// @brief Maps `A`–`Z` to `a`–`z`; every other byte, including non-ASCII ones, is unchanged.
+        constexpr unsigned char ascii_lower(unsigned char const c) noexcept
+        {
+            return static_cast<unsigned char>(c - 'A') < 26u
+                ? static_cast<unsigned char>(c | 0x20u)
+                : c;
+        }
+
+        /// @brief Function object applying @ref ascii_lower to a byte-convertible element.
+        struct ascii_lower_fn
+        {
+            template <typename C>
+            constexpr unsigned char operator()(C const c) const noexcept
+            {
+                return detail::ascii_lower(
+                    static_cast<unsigned char>(static_cast<::std::uint8_t>(c)));
+            }
+        };
+
+        /// @brief Portable kernel: folds eight bytes per step with SWAR arithmetic.
+        ///
+        /// Adding `0x3f` to a 7-bit byte sets its top bit from `A` upwards,
+        /// adding `0x25` from `[` upwards; bytes where exactly one of the two
+        /// is set, and which were ASCII to begin with, get bit 5 (`0x20`).
+        inline void ascii_fold_swar(
+            unsigned char const * src, ::std::size_t n, unsigned char * dst) noexcept
+        {
+            constexpr ::std::uint64_t ones = 0x0101010101010101ull;
+            for (; n >= 8; src += 8, dst += 8, n -= 8)
+            {
+                ::std::uint64_t w;
+                ::std::memcpy(&w, src, sizeof(w));
+                ::std::uint64_t const low7 = w & (0x7f * ones);
+                ::std::uint64_t const upper =
+                    ((low7 + 0x3f * ones) ^ (low7 + 0x25 * ones)) & ~w & (0x80 * ones);
+                w |= upper >> 2;
+                ::std::memcpy(dst, &w, sizeof(w));
+            }
+            for (; n > 0; --n)
+                *dst++ = detail::ascii_lower(*src++);
+        }
+
+#if SCL_HASH_X86_64
+        /// @brief SSE2 kernel: 16 bytes per step.
+        ///
+        /// `c + (0x80 - 'A')` maps `A`–`Z` onto the 26 smallest signed bytes,
+        /// so a single signed compare selects the upper-case letters.
+        SCL_HASH_TARGET("sse2")
+        inline void ascii_fold_sse2(
+            unsigned char const * src, ::std::size_t n, unsigned char * dst) noexcept
+        {
+            __m128i const shift = _mm_set1_epi8(static_cast<char>(0x80 - 'A'));
+            __m128i const limit = _mm_set1_epi8(static_cast<char>(-128 + 26));
+            __m128i const bit = _mm_set1_epi8(0x20);
+            for (; n >= 16; src += 16, dst += 16, n -= 16)
+            {
+                __m128i const c = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src));
+                __m128i const upper = _mm_cmplt_epi8(_mm_add_epi8(c, shift), limit);
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i *>(dst), _mm_or_si128(c, _mm_and_si128(upper, bit)));
+            }
+            detail::ascii_fold_swar(src, n, dst);
+        }
+
+        /// @brief AVX2 kernel: 32 bytes per step.
+        SCL_HASH_TARGET("avx2")
+        inline void ascii_fold_avx2(
+            unsigned char const * src, ::std::size_t n, unsigned char * dst) noexcept
+        {
+            __m256i const shift = _mm256_set1_epi8(static_cast<char>(0x80 - 'A'));
+            __m256i const limit = _mm256_set1_epi8(static_cast<char>(-128 + 26));
+            __m256i const bit = _mm256_set1_epi8(0x20);
+            for (; n >= 32; src += 32, dst += 32, n -= 32)
+            {
+                __m256i const c = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src));
+                // No unsigned byte compare: `limit > c + shift` is the signed `c + shift < limit`.
+                __m256i const upper = _mm256_cmpgt_epi8(limit, _mm256_add_epi8(c, shift));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst),
+                    _mm256_or_si256(c, _mm256_and_si256(upper, bit)));
+            }
+            detail::ascii_fold_sse2(src, n, dst);
+        }
+#endif
+
+        /// @brief Runtime path: writes the ASCII-lower-cased copy of `src[0 .. n)` to @p dst.
+        ///
+        /// Runs the widest kernel allowed by @ref active_simd_level: AVX2,
+        /// SSE2, or eight bytes at a time on other targets.
+        inline void ascii_fold(
+            unsigned char const * src, ::std::size_t n, unsigned char * dst) noexcept
+        {
+#if SCL_HASH_X86_64
+            switch (::scl::hash::active_simd_level())
+            {
+            case simd_level::avx512:
+            case simd_level::avx2:
+                return detail::ascii_fold_avx2(src, n, dst);
+            case simd_level::sse42:
+            case simd_level::sse2:
+                return detail::ascii_fold_sse2(src, n, dst);
+            case simd_level::scalar:
+                break;
+            }
+#endif
+            detail::ascii_fold_swar(src, n, dst);
+        }
+
+        /// @brief Calls @p fn with the bytes of @p range, ASCII-lower-cased, in
+        ///        spans of at most @ref gather_buffer_size bytes. Run time only.
+        template <typename Range, typename Fn>
+        void for_each_folded(Range && range, Fn && fn)
+        {
+            unsigned char buffer[gather_buffer_size];
+            detail::for_each_segment(range, [&](::std::span<unsigned char const> bytes) {
+                while (!bytes.empty())
+                {
+                    auto const n = (::std::min)(bytes.size(), gather_buffer_size);
+                    detail::ascii_fold(bytes.data(), n, buffer);
+                    fn(::std::span<unsigned char const>{buffer, n});
+                    bytes = bytes.subspan(n);
+                }
+            });
+        }
+
+        /// @brief Lazily ASCII-lower-cased view of @p range, for constant evaluation.
+        template <typename Range>
+        constexpr auto ascii_lower_view(Range & range) noexcept
+        {
+            return ::std::ranges::transform_view{::std::ranges::ref_view{range}, ascii_lower_fn{}};
+        }
+    } // namespace detail
+
+    /// @brief Streaming state adaptor that hashes its input ASCII-case-insensitively.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Every byte in `A`–`Z` is passed to the wrapped @p State as `a`–`z`;
+    /// all other bytes, UTF-8 sequences included, are passed unchanged. The
+    /// digest therefore equals that of @p State over the lower-cased input,
+    /// without building the lower-cased copy: at run time each piece of the
+    /// input is folded with SSE2/AVX2 into a 4 KiB stack buffer that is fed
+    /// to the state, and in constant expressions through a transform view.
+    ///
+    /// @tparam State  Any streaming state, e.g. @ref fnv1a_state or @ref siphash_state.
+    ///
+    /// @code
+    /// auto h = scl::hash::ci_state{scl::hash::siphash13_state{key}}
+    ///     .update(name)
+    ///     .update(std::string_view{":"})
+    ///     .finalize();
+    /// @endcode
+    template <typename State>
+    struct ci_state
+    {
+        /// @brief Digest type of the wrapped state.
+        using result_type = typename State::result_type;
+
+        /// @brief Wraps a default-constructed @p State.
+        constexpr ci_state() noexcept(::std::is_nothrow_default_constructible_v<State>)
+            requires ::std::default_initializable<State>
+            : m_state{}
+        {}
+
+        /// @brief Wraps a copy of @p state — e.g. a keyed or seeded one.
+        constexpr explicit ci_state(State const & state) noexcept(
+            ::std::is_nothrow_copy_constructible_v<State>)
+            : m_state{state}
+        {}
+
+        /// @brief Appends @p range to the message, with `A`–`Z` folded to `a`–`z`.
+        template <::std::ranges::input_range Range>
+        constexpr ci_state & update(Range && range) noexcept
+            requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+        {
+            if (!::std::is_constant_evaluated())
+            {
+                detail::for_each_folded(range, [this](auto const bytes) { m_state.update(bytes); });
+                return *this;
+            }
+
+            m_state.update(detail::ascii_lower_view(range));
+            return *this;
+        }
+
+        /// @brief Returns the digest of all bytes appended so far.
+        constexpr result_type finalize() const noexcept { return m_state.finalize(); }
+
+    private:
+        State m_state;
+    };
+
+    namespace detail
+    {
+        /// @brief Provides `state_type` and `make_state()` for @ref ci_hasher when @p Hasher has a state.
+        template <typename Hasher>
+        struct ci_hasher_state
+        {};
+
+        template <typename Hasher>
+            requires requires(Hasher const & h) {
+                typename Hasher::state_type;
+                h.make_state();
+            }
+        struct ci_hasher_state<Hasher>
+        {
+            /// @brief Case-insensitive streaming state producing the same digests.
+            using state_type = ci_state<typename Hasher::state_type>;
+
+            /// @brief Returns a fresh case-insensitive state wrapping `Hasher{}.make_state()`.
+            constexpr state_type make_state() const noexcept
+            {
+                return state_type{Hasher{}.make_state()};
+            }
+        };
+    } // namespace detail
+
+    /// @brief Case-insensitive wrapper around any hasher, for use with @ref scl::hash::key.
+    /// @ingroup scl_utility_hash
+    ///
+    /// `ci_hasher<H>{}(x)` equals `H{}(ascii_lower(x))`, so keys of
+    /// differently-cased spellings of an ASCII name compare equal — as
+    /// HTTP header names, SMTP commands and SQL identifiers require — and
+    /// case labels may be spelled in any case:
+    /// @code
+    /// using header = scl::hash::key<scl::hash::ci_hasher<scl::hash::fnv1a_hasher>>;
+    /// switch (header{name}) {
+    ///     case header{"Content-Length"}: ...
+    ///     case header{"content-type"}: ...
+    /// }
+    /// @endcode
+    ///
+    /// At run time an input of up to 4 KiB is folded with SSE2/AVX2 into a
+    /// stack buffer and hashed in one call; longer inputs stream through
+    /// @ref ci_state, or — for hashers without a state, such as
+    /// @ref rapidhash_hasher — are folded into a heap buffer. Nothing is
+    /// allocated for the short names this is meant for.
+    ///
+    /// @tparam Hasher  A @ref concepts::byte_hasher.
+    template <concepts::byte_hasher Hasher>
+    struct ci_hasher : detail::ci_hasher_state<Hasher>
+    {
+        using result_type = typename Hasher::result_type;
+        /// @brief The mixer `std::hash<key<Hasher>>` applies, if any.
+        using mixer = typename detail::key_mixer<Hasher>::type;
+
+        template <::std::ranges::input_range Range>
+        constexpr result_type operator()(Range && range) const
+            noexcept(::std::is_nothrow_invocable_v<Hasher const &, ::std::span<unsigned char const>>
+                && requires { typename Hasher::state_type; })
+            requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+        {
+            if (::std::is_constant_evaluated())
+                return Hasher{}(detail::ascii_lower_view(range));
+
+            if constexpr (detail::contiguous_byte_range<Range>)
+            {
+                auto const n = static_cast<::std::size_t>(::std::ranges::size(range));
+                if (n <= detail::gather_buffer_size)
+                {
+                    unsigned char buffer[detail::gather_buffer_size];
+                    detail::ascii_fold(detail::byte_data(range), n, buffer);
+                    return Hasher{}(::std::span<unsigned char const>{buffer, n});
+                }
+            }
+
+            if constexpr (requires { typename Hasher::state_type; })
+            {
+                return this->make_state().update(range).finalize();
+            }
+            else
+            {
+                ::std::vector<unsigned char> folded;
+                detail::for_each_folded(range, [&folded](auto const bytes) {
+                    folded.insert(folded.end(), bytes.begin(), bytes.end());
+                });
+                return Hasher{}(folded);
+            }
+        }
+    };
+
+    /// @brief FNV-1a 64-bit hash of @p range with ASCII letters folded to lower case.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Equals `fnv1a(lower-cased range, h)` without building the lower-cased copy.
+    ///
+    /// @par Compile-time example
+    /// @code
+    /// static_assert(scl::hash::fnv1a_ci(std::string_view{"Content-Length"})
+    ///     == scl::hash::fnv1a(std::string_view{"content-length"}));
+    /// @endcode
+    template <::std::ranges::input_range Range>
+    constexpr ::std::uint64_t fnv1a_ci(
+        Range && range, ::std::uint64_t const h = 14695981039346656037ull) noexcept
+        requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+    {
+        return ci_state<fnv1a_state>{fnv1a_state{h}}.update(range).finalize();
+    }
+
+    /// @brief SipHash-C-D 64-bit keyed hash of @p range with ASCII letters folded to lower case.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Equals `siphash<C, D>(lower-cased range, key)` without building the
+    /// lower-cased copy. Hash-flooding resistance is preserved: an attacker
+    /// can only produce the collisions that case-insensitive equality implies.
+    template <::std::size_t C = 2, ::std::size_t D = 4, ::std::ranges::input_range Range>
+    constexpr ::std::uint64_t siphash_ci(
+        Range && range, siphash_key const key = siphash_default_key) noexcept
+        requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+    {
+        return ci_state<siphash_state<C, D>>{siphash_state<C, D>{key}}.update(range).finalize();
+    }
+
+} // namespace scl::hash
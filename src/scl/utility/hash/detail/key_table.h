@@ -0,0 +1,495 @@
+#pragma once
+
+/// @file key_table.h
+/// @brief Open-addressing table of pre-hashed @ref scl::hash::key values, probed 15 slots at a time.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/dispatch.h>
+#include <scl/utility/hash/key.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace scl::hash::detail
+{
+    /// @brief Bit @c i set for each matching slot @c i of a @ref key_table_group.
+    using key_table_mask = ::std::uint32_t;
+
+    /// @brief Fifteen control bytes and an overflow counter, compared with one SSE2 instruction.
+    ///
+    /// A control byte is `0x80` for an empty slot, or the 7-bit tag (H2) of
+    /// the key stored there. The last byte counts the keys whose probe
+    /// sequence passed this group because it was full. A lookup stops at
+    /// the first group with a zero count, so erasing just clears the slot
+    /// and decrements the counts on the erased key's path: no tombstones.
+    struct alignas(16) key_table_group
+    {
+        static constexpr ::std::size_t width = 15;
+        static constexpr ::std::uint8_t empty = 0x80;
+        static constexpr key_table_mask all = (key_table_mask{1} << width) - 1;
+
+        ::std::uint8_t ctrl[16];
+
+        static constexpr key_table_group make_empty() noexcept
+        {
+            key_table_group g{};
+            for (::std::size_t i = 0; i < width; ++i)
+                g.ctrl[i] = empty;
+            g.ctrl[width] = 0;
+            return g;
+        }
+
+        /// @brief Slots whose tag is @p tag.
+        key_table_mask match(::std::uint8_t const tag) const noexcept
+        {
+#if SCL_HASH_X86_64
+            auto const bytes = _mm_load_si128(reinterpret_cast<__m128i const *>(ctrl));
+            auto const eq = _mm_cmpeq_epi8(bytes, _mm_set1_epi8(static_cast<char>(tag)));
+            return static_cast<key_table_mask>(_mm_movemask_epi8(eq)) & all;
+#else
+            key_table_mask m = 0;
+            for (::std::size_t i = 0; i < width; ++i)
+                m |= key_table_mask{ctrl[i] == tag} << i;
+            return m;
+#endif
+        }
+
+        /// @brief Empty slots.
+        key_table_mask match_empty() const noexcept
+        {
+#if SCL_HASH_X86_64
+            auto const bytes = _mm_load_si128(reinterpret_cast<__m128i const *>(ctrl));
+            return static_cast<key_table_mask>(_mm_movemask_epi8(bytes)) & all;
+#else
+            key_table_mask m = 0;
+            for (::std::size_t i = 0; i < width; ++i)
+                m |= key_table_mask{(ctrl[i] & empty) != 0} << i;
+            return m;
+#endif
+        }
+
+        /// @brief Occupied slots.
+        key_table_mask match_full() const noexcept { return ~match_empty() & all; }
+
+        ::std::uint8_t overflow() const noexcept { return ctrl[width]; }
+
+        /// @brief Counts one more key probing past; saturates, and a saturated count stays.
+        void add_overflow() noexcept
+        {
+            if (ctrl[width] != 0xff)
+                ++ctrl[width];
+        }
+
+        void remove_overflow() noexcept
+        {
+            if (ctrl[width] != 0xff)
+                --ctrl[width];
+        }
+    };
+
+    /// @brief Control bytes of a table without storage: one empty group with a zero count.
+    inline constinit key_table_group key_table_no_groups = key_table_group::make_empty();
+
+    /// @brief Open-addressing table of slots holding @ref key values.
+    ///
+    /// The key's digest is the hash: its low bits select the home group
+    /// (H1), its top seven bits are the tag (H2), after the
+    /// `std::hash<key<Hasher>>` mixer for hashers that declare one. Groups
+    /// are probed triangularly — home, +1, +3, +6, … — which visits every
+    /// group of a power-of-two count.
+    ///
+    /// @tparam Policy  Provides `key_type`, `slot_type` and `static key_type const & key(slot_type const &)`.
+    template <typename Policy>
+    struct key_table
+    {
+        using key_type = typename Policy::key_type;
+        using value_type = typename Policy::slot_type;
+        using size_type = ::std::size_t;
+        using difference_type = ::std::ptrdiff_t;
+
+        /// @brief Largest fraction of the slots in use before the table grows.
+        static constexpr double max_load_factor() noexcept { return 7.0 / 8.0; }
+
+        template <bool Const>
+        struct basic_iterator
+        {
+            using iterator_category = ::std::forward_iterator_tag;
+            using value_type = typename key_table::value_type;
+            using difference_type = ::std::ptrdiff_t;
+            using pointer = ::std::conditional_t<Const, value_type const *, value_type *>;
+            using reference = ::std::conditional_t<Const, value_type const &, value_type &>;
+
+            basic_iterator() noexcept = default;
+
+            /// @brief Mutable to constant conversion.
+            template <bool C = Const>
+                requires C
+            basic_iterator(basic_iterator<false> const & other) noexcept
+                : m_groups{other.m_groups}
+                , m_slots{other.m_slots}
+                , m_index{other.m_index}
+                , m_end{other.m_end}
+            {}
+
+            reference operator*() const noexcept { return m_slots[m_index]; }
+            pointer operator->() const noexcept { return m_slots + m_index; }
+
+            basic_iterator & operator++() noexcept
+            {
+                ++m_index;
+                skip_empty();
+                return *this;
+            }
+
+            basic_iterator operator++(int) noexcept
+            {
+                auto const copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            friend bool operator==(basic_iterator const & a, basic_iterator const & b) noexcept
+            {
+                return a.m_index == b.m_index;
+            }
+
+        private:
+            friend key_table;
+            friend basic_iterator<!Const>;
+
+            basic_iterator(key_table_group const * groups,
+                pointer slots,
+                size_type const index,
+                size_type const end) noexcept
+                : m_groups{groups}
+                , m_slots{slots}
+                , m_index{index}
+                , m_end{end}
+            {}
+
+            void skip_empty() noexcept
+            {
+                constexpr auto w = key_table_group::width;
+                while (m_index < m_end
+                    && (m_groups[m_index / w].ctrl[m_index % w] & key_table_group::empty))
+                    ++m_index;
+            }
+
+            key_table_group const * m_groups = nullptr;
+            pointer m_slots = nullptr;
+            size_type m_index = 0;
+            size_type m_end = 0;
+        };
+
+        using iterator = basic_iterator<false>;
+        using const_iterator = basic_iterator<true>;
+
+        key_table() noexcept = default;
+
+        key_table(key_table const & other)
+        {
+            reserve(other.m_size);
+            for (auto const & v : other)
+                emplace_new(Policy::key(v), v);
+        }
+
+        key_table(key_table && other) noexcept { swap(other); }
+
+        key_table & operator=(key_table const & other)
+        {
+            if (this != &other)
+            {
+                key_table copy{other};
+                swap(copy);
+            }
+            return *this;
+        }
+
+        key_table & operator=(key_table && other) noexcept
+        {
+            key_table moved{::std::move(other)};
+            swap(moved);
+            return *this;
+        }
+
+        ~key_table() { release(); }
+
+        void swap(key_table & other) noexcept
+        {
+            ::std::swap(m_groups, other.m_groups);
+            ::std::swap(m_slots, other.m_slots);
+            ::std::swap(m_group_mask, other.m_group_mask);
+            ::std::swap(m_size, other.m_size);
+            ::std::swap(m_max_size, other.m_max_size);
+        }
+
+        friend void swap(key_table & a, key_table & b) noexcept { a.swap(b); }
+
+        iterator begin() noexcept { return make_begin<iterator>(m_slots); }
+        const_iterator begin() const noexcept { return make_begin<const_iterator>(m_slots); }
+        const_iterator cbegin() const noexcept { return begin(); }
+        iterator end() noexcept { return iterator{m_groups, m_slots, slot_count(), slot_count()}; }
+        const_iterator end() const noexcept
+        {
+            return const_iterator{m_groups, m_slots, slot_count(), slot_count()};
+        }
+        const_iterator cend() const noexcept { return end(); }
+
+        bool empty() const noexcept { return m_size == 0; }
+        size_type size() const noexcept { return m_size; }
+
+        /// @brief Number of slots; the table grows when @ref size would exceed 7/8 of it.
+        size_type capacity() const noexcept { return slot_count(); }
+
+        double load_factor() const noexcept
+        {
+            if (m_max_size == 0)
+                return 0.0;
+            return static_cast<double>(m_size) / static_cast<double>(slot_count());
+        }
+
+        iterator find(key_type const k) noexcept { return to_iterator(locate(k)); }
+
+        const_iterator find(key_type const k) const noexcept
+        {
+            auto const index = locate(k);
+            return index == npos ? end() : const_iterator{m_groups, m_slots, index, slot_count()};
+        }
+
+        bool contains(key_type const k) const noexcept { return locate(k) != npos; }
+        size_type count(key_type const k) const noexcept { return contains(k) ? 1 : 0; }
+
+        /// @brief Removes the entry with key @p k; returns the number removed.
+        size_type erase(key_type const k) noexcept
+        {
+            auto const index = locate(k);
+            if (index == npos)
+                return 0;
+            erase_at(index);
+            return 1;
+        }
+
+        /// @brief Removes the entry at @p pos; returns the iterator following it.
+        iterator erase(const_iterator const pos) noexcept
+        {
+            auto const index = pos.m_index;
+            erase_at(index);
+            auto next = iterator{m_groups, m_slots, index + 1, slot_count()};
+            next.skip_empty();
+            return next;
+        }
+
+        /// @brief Destroys all entries; keeps the storage.
+        void clear() noexcept
+        {
+            if (m_size == 0)
+                return;
+            for (size_type g = 0; g <= m_group_mask; ++g)
+            {
+                for_each_bit(m_groups[g].match_full(), [&](size_type const i) {
+                    ::std::destroy_at(m_slots + g * key_table_group::width + i);
+                });
+                m_groups[g] = key_table_group::make_empty();
+            }
+            m_size = 0;
+        }
+
+        /// @brief Makes room for @p n entries without further growth.
+        void reserve(size_type const n)
+        {
+            if (n > m_max_size)
+                rehash_groups(group_count_for(n));
+        }
+
+        /// @brief Rebuilds the table with room for at least `max(n, size())` entries; `rehash(0)` shrinks to fit.
+        void rehash(size_type const n)
+        {
+            auto const groups = group_count_for(::std::max(n, m_size));
+            if (groups != group_count())
+                rehash_groups(groups);
+        }
+
+    protected:
+        static constexpr size_type npos = ~size_type{0};
+
+        /// @brief Mixed digest of @p k: home group from the low bits, tag from the top seven.
+        static ::std::uint64_t hash_of(key_type const k) noexcept
+        {
+            using mixer = typename key_mixer<typename key_type::hasher_type>::type;
+            return mixer{}(detail::digest_word(k.value));
+        }
+
+        static ::std::uint8_t tag_of(::std::uint64_t const h) noexcept
+        {
+            return static_cast<::std::uint8_t>(h >> 57);
+        }
+
+        /// @brief Slot index of @p k, or @ref npos.
+        ///
+        /// Stops at the first group with a zero overflow count, or after
+        /// visiting every group once: erasures and saturated counts can leave
+        /// all counts non-zero.
+        size_type locate(key_type const k) const noexcept
+        {
+            auto const h = hash_of(k);
+            auto const tag = tag_of(h);
+            auto const groups = m_group_mask + 1;
+            auto g = static_cast<size_type>(h) & m_group_mask;
+            for (size_type step = 1; step <= groups; ++step)
+            {
+                auto const & group = m_groups[g];
+                for (auto m = group.match(tag); m != 0; m &= m - 1)
+                {
+                    auto const i = static_cast<size_type>(::std::countr_zero(m));
+                    auto const index = g * key_table_group::width + i;
+                    if (Policy::key(m_slots[index]) == k)
+                        return index;
+                }
+                if (group.overflow() == 0)
+                    return npos;
+                g = (g + step) & m_group_mask;
+            }
+            return npos;
+        }
+
+        iterator to_iterator(size_type const index) noexcept
+        {
+            return index == npos ? end() : iterator{m_groups, m_slots, index, slot_count()};
+        }
+
+        /// @brief Constructs a slot for @p k, which must be absent, from @p args; returns its index.
+        ///
+        /// The element is constructed before any control byte changes, so a
+        /// throwing constructor leaves the table as it was.
+        template <typename... Args>
+        size_type emplace_new(key_type const k, Args &&... args)
+        {
+            if (m_size == m_max_size)
+                rehash_groups(group_count_for(m_size + 1));
+            auto const h = hash_of(k);
+            auto const home = static_cast<size_type>(h) & m_group_mask;
+            auto g = home;
+            size_type step = 1;
+            key_table_mask free;
+            while ((free = m_groups[g].match_empty()) == 0)
+                g = (g + step++) & m_group_mask;
+            auto const i = static_cast<size_type>(::std::countr_zero(free));
+            auto const index = g * key_table_group::width + i;
+            ::std::construct_at(m_slots + index, ::std::forward<Args>(args)...);
+
+            for (size_type s = 1, p = home; p != g; p = (p + s++) & m_group_mask)
+                m_groups[p].add_overflow();
+            m_groups[g].ctrl[i] = tag_of(h);
+            ++m_size;
+            return index;
+        }
+
+        void erase_at(size_type const index) noexcept
+        {
+            auto const g = index / key_table_group::width;
+            auto const h = hash_of(Policy::key(m_slots[index]));
+            auto const groups = m_group_mask + 1;
+            auto p = static_cast<size_type>(h) & m_group_mask;
+            for (size_type step = 1; p != g && step <= groups; ++step)
+            {
+                m_groups[p].remove_overflow();
+                p = (p + step) & m_group_mask;
+            }
+            m_groups[g].ctrl[index % key_table_group::width] = key_table_group::empty;
+            ::std::destroy_at(m_slots + index);
+            --m_size;
+        }
+
+        value_type & slot(size_type const index) noexcept { return m_slots[index]; }
+
+    private:
+        using group_allocator = ::std::allocator<key_table_group>;
+        using slot_allocator = ::std::allocator<value_type>;
+
+        size_type group_count() const noexcept { return m_max_size == 0 ? 0 : m_group_mask + 1; }
+        size_type slot_count() const noexcept { return group_count() * key_table_group::width; }
+
+        /// @brief Smallest power-of-two group count holding @p n entries at the maximum load.
+        static size_type group_count_for(size_type const n) noexcept
+        {
+            if (n == 0)
+                return 0;
+            auto const slots = (n * 8 + 6) / 7;
+            return ::std::bit_ceil((slots + key_table_group::width - 1) / key_table_group::width);
+        }
+
+        static size_type max_size_for(size_type const groups) noexcept
+        {
+            return groups * key_table_group::width * 7 / 8;
+        }
+
+        template <typename Iterator, typename Slots>
+        Iterator make_begin(Slots slots) const noexcept
+        {
+            Iterator it{m_groups, slots, 0, slot_count()};
+            it.skip_empty();
+            return it;
+        }
+
+        template <typename F>
+        static void for_each_bit(key_table_mask m, F && f)
+        {
+            for (; m != 0; m &= m - 1)
+                f(static_cast<size_type>(::std::countr_zero(m)));
+        }
+
+        /// @brief Moves every entry into @p groups fresh groups; no per-entry allocation, no re-hashing of names.
+        void rehash_groups(size_type const groups)
+        {
+            key_table next;
+            if (groups != 0)
+            {
+                next.m_groups = group_allocator{}.allocate(groups);
+                ::std::uninitialized_fill_n(next.m_groups, groups, key_table_group::make_empty());
+                try
+                {
+                    next.m_slots = slot_allocator{}.allocate(groups * key_table_group::width);
+                }
+                catch (...)
+                {
+                    group_allocator{}.deallocate(next.m_groups, groups);
+                    throw;
+                }
+                next.m_group_mask = groups - 1;
+                next.m_max_size = max_size_for(groups);
+            }
+            for (size_type g = 0; g < group_count(); ++g)
+                for_each_bit(m_groups[g].match_full(), [&](size_type const i) {
+                    auto & v = m_slots[g * key_table_group::width + i];
+                    next.emplace_new(Policy::key(v), ::std::move_if_noexcept(v));
+                });
+            swap(next);
+        }
+
+        void release() noexcept
+        {
+            if (m_max_size == 0)
+                return;
+            clear();
+            group_allocator{}.deallocate(m_groups, group_count());
+            slot_allocator{}.deallocate(m_slots, slot_count());
+            m_groups = &key_table_no_groups;
+            m_slots = nullptr;
+            m_group_mask = 0;
+            m_max_size = 0;
+        }
+
+        key_table_group * m_groups = &key_table_no_groups;
+        value_type * m_slots = nullptr;
+        size_type m_group_mask = 0;
+        size_type m_size = 0;
+        size_type m_max_size = 0;
+    };
+
+} // namespace scl::hash::detail
@@ -0,0 +1,126 @@
+#pragma once
+
+/// @file load.h
+/// @brief Unaligned little-endian word loads used by the runtime hash kernels.
+/// @ingroup scl_utility_hash
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+
+namespace scl::hash::detail
+{
+    /// @brief Range whose elements are single bytes laid out contiguously in memory.
+    ///
+    /// Such ranges may be hashed by reading machine words directly from
+    /// `std::ranges::data(range)` instead of converting element by element.
+    // clang-format off
+    template <typename Range>
+    concept contiguous_byte_range = ::std::ranges::contiguous_range<Range>
+            && ::std::ranges::sized_range<Range>
+            && sizeof(::std::ranges::range_value_t<Range>) == 1
+            && ::std::is_trivially_copyable_v<::std::ranges::range_value_t<Range>>;
+    // clang-format on
+
+    /// @brief Returns a pointer to the first byte of a @ref contiguous_byte_range.
+    template <contiguous_byte_range Range>
+    inline unsigned char const * byte_data(Range const & range) noexcept
+    {
+        return reinterpret_cast<unsigned char const *>(::std::ranges::data(range));
+    }
+
+    /// @brief Reverses the byte order of an unsigned integer (C++23 `std::byteswap`).
+    template <::std::unsigned_integral Word>
+    constexpr Word byteswap(Word w) noexcept
+    {
+        Word r = 0;
+        for (::std::size_t i = 0; i < sizeof(Word); ++i)
+        {
+            r = static_cast<Word>((r << 8) | (w & 0xffu));
+            w = static_cast<Word>(w >> 8);
+        }
+        return r;
+    }
+
+    /// @brief Loads a little-endian word from possibly unaligned memory.
+    template <::std::unsigned_integral Word>
+    inline Word load_le(unsigned char const * p) noexcept
+    {
+        Word w;
+        ::std::memcpy(&w, p, sizeof(w));
+        if constexpr (::std::endian::native == ::std::endian::big)
+            w = detail::byteswap(w);
+        return w;
+    }
+
+    /// @brief Iterator over byte-sized elements laid out contiguously in memory.
+    // clang-format off
+    template <typename It>
+    concept contiguous_byte_iterator = ::std::contiguous_iterator<It>
+            && sizeof(::std::iter_value_t<It>) == 1
+            && ::std::is_trivially_copyable_v<::std::iter_value_t<It>>;
+    // clang-format on
+
+    /// @brief Reads a little-endian word from the elements `it[0] .. it[sizeof(Word) - 1]`.
+    ///
+    /// Usable in constant expressions over any random-access iterator whose
+    /// elements convert to `std::uint8_t`. At run time, iterators over
+    /// contiguous bytes are read with a single @ref load_le.
+    template <::std::unsigned_integral Word, ::std::random_access_iterator It>
+    constexpr Word read_le(It const it) noexcept
+    {
+        if constexpr (contiguous_byte_iterator<It>)
+        {
+            if (!::std::is_constant_evaluated())
+                return detail::load_le<Word>(
+                    reinterpret_cast<unsigned char const *>(::std::to_address(it)));
+        }
+
+        Word w = 0;
+        for (::std::size_t i = 0; i < sizeof(Word); ++i)
+            w |= static_cast<Word>(static_cast<::std::uint8_t>(it[i])) << (i * 8);
+        return w;
+    }
+
+    /// @brief Loads `n < 8` trailing bytes as a zero-padded little-endian word.
+    ///
+    /// Never reads outside `[p, p + n)`. Inputs of 4–7 bytes are assembled from
+    /// two overlapping 32-bit loads, shorter ones from individual bytes.
+    inline ::std::uint64_t load_le64_partial(unsigned char const * p, ::std::size_t n) noexcept
+    {
+        if (n >= 4)
+        {
+            ::std::uint64_t const lo = detail::load_le<::std::uint32_t>(p);
+            ::std::uint64_t const hi = detail::load_le<::std::uint32_t>(p + n - 4);
+            return lo | ((hi >> ((8 - n) * 8)) << 32);
+        }
+
+        ::std::uint64_t w = 0;
+        if (n > 0)
+            w = p[0];
+        if (n > 1)
+            w |= static_cast<::std::uint64_t>(p[1]) << 8;
+        if (n > 2)
+            w |= static_cast<::std::uint64_t>(p[2]) << 16;
+        return w;
+    }
+
+    /// @brief Loads `n < 4` trailing bytes as a zero-padded little-endian word.
+    inline ::std::uint32_t load_le32_partial(unsigned char const * p, ::std::size_t n) noexcept
+    {
+        ::std::uint32_t w = 0;
+        if (n > 0)
+            w = p[0];
+        if (n > 1)
+            w |= static_cast<::std::uint32_t>(p[1]) << 8;
+        if (n > 2)
+            w |= static_cast<::std::uint32_t>(p[2]) << 16;
+        return w;
+    }
+} // namespace scl::hash::detail
@@ -0,0 +1,52 @@
+#pragma once
+
+/// @file mul128.h
+/// @brief Full 64×64→128-bit multiplication used by the multiply-mix hash kernels.
+/// @ingroup scl_utility_hash
+
+#include <cstdint>
+#include <type_traits>
+
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__SIZEOF_INT128__)
+#include <intrin.h>
+#endif
+
+namespace scl::hash::detail
+{
+    /// @brief Multiplies @p a by @p b; returns the low 64 bits and stores the high ones in @p hi.
+    ///
+    /// Uses the compiler's native 128-bit integer where available, `_umul128`
+    /// at run time on MSVC x64, and a portable schoolbook product otherwise
+    /// (including during constant evaluation).
+    constexpr ::std::uint64_t mul128(
+        ::std::uint64_t const a, ::std::uint64_t const b, ::std::uint64_t & hi) noexcept
+    {
+#if defined(__SIZEOF_INT128__)
+        __extension__ using uint128_type = unsigned __int128;
+        uint128_type const product = static_cast<uint128_type>(a) * b;
+        hi = static_cast<::std::uint64_t>(product >> 64);
+        return static_cast<::std::uint64_t>(product);
+#else
+#if defined(_MSC_VER) && defined(_M_X64)
+        if (!::std::is_constant_evaluated())
+            return _umul128(a, b, &hi);
+#endif
+        ::std::uint64_t const lo_lo = (a & 0xffffffffull) * (b & 0xffffffffull);
+        ::std::uint64_t const hi_lo = (a >> 32) * (b & 0xffffffffull);
+        ::std::uint64_t const lo_hi = (a & 0xffffffffull) * (b >> 32);
+        ::std::uint64_t const hi_hi = (a >> 32) * (b >> 32);
+        ::std::uint64_t const cross = (lo_lo >> 32) + (hi_lo & 0xffffffffull) + lo_hi;
+        hi = hi_hi + (hi_lo >> 32) + (cross >> 32);
+        return (cross << 32) | (lo_lo & 0xffffffffull);
+#endif
+    }
+
+    /// @brief Folds the 128-bit product of @p a and @p b into 64 bits (`lo ^ hi`).
+    constexpr ::std::uint64_t mul128_fold64(
+        ::std::uint64_t const a, ::std::uint64_t const b) noexcept
+    {
+        ::std::uint64_t hi = 0;
+        ::std::uint64_t const lo = detail::mul128(a, b, hi);
+        return lo ^ hi;
+    }
+} // namespace scl::hash::detail
@@ -0,0 +1,162 @@
+#pragma once
+
+/// @file perfect_hash.h
+/// @brief Compile-time hash-and-displace search for minimal perfect hashes of 64-bit words.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/key.h>
+#include <scl/utility/hash/mix.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace scl::hash::detail
+{
+    // Called only when the search fails; being non-constexpr, each turns the
+    // failure into a compile error that names it.
+
+    /// @brief Two input words are equal, so no perfect hash can separate them.
+    inline void perfect_hash_error_duplicate_word() noexcept {}
+
+    /// @brief No displacement separates a bucket; cannot happen for distinct words in practice.
+    inline void perfect_hash_error_no_displacement() noexcept {}
+
+    /// @brief The 64-bit word a perfect hash places: the digest, mixed as
+    ///        `std::hash<key<Hasher>>` mixes it.
+    template <concepts::byte_hasher Hasher>
+    constexpr ::std::uint64_t perfect_hash_word(typename Hasher::result_type const d) noexcept
+    {
+        return typename key_mixer<Hasher>::type{}(detail::digest_word(d));
+    }
+
+    /// @brief Minimal perfect hash of @p N distinct words onto `[0, N)`.
+    ///
+    /// A word's bucket is the SplitMix64 mix of the word xor-ed with a fixed
+    /// seed, reduced with @ref fast_range; its slot is the mix of the word
+    /// xor-ed with the bucket's displacement, reduced the same way. Both
+    /// mix the word themselves, so buckets stay balanced even for words
+    /// whose high bits are all zero, e.g. unmixed 32-bit digests.
+    /// Evaluating it costs two mixes, two multiply-reductions and one load.
+    template <::std::size_t N>
+    struct perfect_hash
+    {
+        /// @brief Number of displacement buckets: about two words per bucket.
+        static constexpr ::std::size_t bucket_count = N / 2 + 1;
+
+        /// @brief Xor-ed into a word before mixing it for its bucket; far from
+        ///        any displacement, so bucket and slot mixes are unrelated.
+        static constexpr ::std::uint64_t bucket_seed = 0x9e3779b97f4a7c15ull;
+
+        ::std::array<::std::uint32_t, bucket_count> displacements{};
+
+        /// @brief Slot of @p word under @p displacement.
+        static constexpr ::std::size_t
+        slot(::std::uint64_t const word, ::std::uint32_t const displacement) noexcept
+        {
+            auto const mixed = splitmix64_mixer{}(word ^ displacement);
+            return static_cast<::std::size_t>(scl::hash::fast_range(mixed, N));
+        }
+
+        static constexpr ::std::size_t bucket(::std::uint64_t const word) noexcept
+        {
+            auto const mixed = splitmix64_mixer{}(word ^ bucket_seed);
+            return static_cast<::std::size_t>(scl::hash::fast_range(mixed, bucket_count));
+        }
+
+        /// @brief Slot of @p word; any word maps somewhere, so callers compare the slot's key.
+        constexpr ::std::size_t operator()(::std::uint64_t const word) const noexcept
+        {
+            return slot(word, displacements[bucket(word)]);
+        }
+    };
+
+    /// @brief A @ref perfect_hash and where it places each input word.
+    template <::std::size_t N>
+    struct perfect_hash_layout
+    {
+        perfect_hash<N> hash;
+        /// @brief `order[slot]` is the index of the word placed there.
+        ::std::array<::std::size_t, N> order{};
+    };
+
+    /// @brief Hash-and-displace (CHD) search for a minimal perfect hash of @p words,
+    ///        which must be distinct.
+    ///
+    /// Words are grouped into buckets by @ref perfect_hash::bucket. Buckets
+    /// are placed largest first; for each, displacements 0, 1, 2, … are
+    /// tried until every member lands on a distinct free slot.
+    ///
+    /// @see D. Belazzougui, F. C. Botelho, M. Dietzfelbinger,
+    ///      "Hash, displace, and compress", ESA 2009.
+    template <::std::size_t N>
+    consteval perfect_hash_layout<N>
+    make_perfect_hash(::std::array<::std::uint64_t, N> const & words)
+    {
+        using hash_type = perfect_hash<N>;
+        constexpr ::std::size_t B = hash_type::bucket_count;
+        perfect_hash_layout<N> layout;
+        if constexpr (N > 0)
+        {
+            auto sorted = words;
+            ::std::sort(sorted.begin(), sorted.end());
+            if (::std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end())
+                detail::perfect_hash_error_duplicate_word();
+
+            // Bucket members, contiguous per bucket.
+            ::std::array<::std::size_t, B + 1> first{};
+            for (auto const w : words)
+                ++first[hash_type::bucket(w) + 1];
+            for (::std::size_t b = 0; b < B; ++b)
+                first[b + 1] += first[b];
+            ::std::array<::std::size_t, N> members{};
+            auto fill = first;
+            for (::std::size_t i = 0; i < N; ++i)
+                members[fill[hash_type::bucket(words[i])]++] = i;
+
+            ::std::array<::std::size_t, B> buckets{};
+            for (::std::size_t b = 0; b < B; ++b)
+                buckets[b] = b;
+            ::std::sort(buckets.begin(), buckets.end(), [&](auto const a, auto const b) {
+                auto const size_a = first[a + 1] - first[a];
+                auto const size_b = first[b + 1] - first[b];
+                return size_a != size_b ? size_a > size_b : a < b;
+            });
+
+            ::std::array<bool, N> taken{};
+            ::std::array<::std::size_t, N> slots{};
+            for (auto const b : buckets)
+            {
+                auto const begin = first[b];
+                auto const end = first[b + 1];
+                if (begin == end)
+                    break;
+                for (::std::uint32_t d = 0;; ++d)
+                {
+                    if (d == 0xffffffffu)
+                        detail::perfect_hash_error_no_displacement();
+                    bool fits = true;
+                    for (auto m = begin; m < end && fits; ++m)
+                    {
+                        slots[m] = hash_type::slot(words[members[m]], d);
+                        fits = !taken[slots[m]];
+                        for (auto o = begin; o < m && fits; ++o)
+                            fits = slots[o] != slots[m];
+                    }
+                    if (!fits)
+                        continue;
+                    for (auto m = begin; m < end; ++m)
+                    {
+                        taken[slots[m]] = true;
+                        layout.order[slots[m]] = members[m];
+                    }
+                    layout.hash.displacements[b] = d;
+                    break;
+                }
+            }
+        }
+        return layout;
+    }
+
+} // namespace scl::hash::detail
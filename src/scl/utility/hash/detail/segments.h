@@ -0,0 +1,123 @@
+#pragma once
+
+/// @file segments.h
+/// @brief Visiting non-contiguous byte ranges as a sequence of contiguous pieces.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/detail/load.h>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+namespace scl::hash::detail
+{
+    /// @brief Size of the stack buffer that non-contiguous ranges are gathered into: 4 KiB.
+    inline constexpr ::std::size_t gather_buffer_size = 4096;
+
+    /// @brief `std::ranges::join_view` specialisations.
+    template <typename T>
+    inline constexpr bool is_join_view = false;
+    template <typename V>
+    inline constexpr bool is_join_view<::std::ranges::join_view<V>> = true;
+
+    /// @brief Range whose elements are themselves @ref contiguous_byte_range "contiguous byte ranges".
+    // clang-format off
+    template <typename Range>
+    concept contiguous_segments = ::std::ranges::input_range<Range>
+            && contiguous_byte_range<::std::ranges::range_reference_t<Range>>;
+    // clang-format on
+
+    /// @brief Byte range that is made of contiguous pieces and can list them.
+    ///
+    /// Satisfied by
+    /// - types with a `segments()` member returning a range of contiguous
+    ///   byte ranges — the opt-in for ropes, chunked buffers and similar
+    ///   containers;
+    /// - `std::views::join` over contiguous byte ranges, e.g. over a
+    ///   `std::vector<std::string>`, whose pieces are its `base()`.
+    // clang-format off
+    template <typename Range>
+    concept segmented_byte_range
+            = requires(Range & range) { { range.segments() } -> contiguous_segments; }
+            || (is_join_view<::std::remove_cvref_t<Range>>
+                && requires(Range & range) { { range.base() } -> contiguous_segments; });
+    // clang-format on
+
+    /// @brief Calls @p fn with consecutive `std::span<unsigned char const>` pieces
+    ///        that together hold the bytes of @p range, in order.
+    ///
+    /// Lets a hash state run its contiguous kernel over any input range:
+    /// - a @ref contiguous_byte_range is passed as one span;
+    /// - a @ref segmented_byte_range is passed one segment at a time;
+    /// - anything else is gathered into a @ref gather_buffer_size stack buffer.
+    ///   Sized random-access ranges of bytes — e.g. `std::deque<char>` — are
+    ///   gathered with `std::copy`, which standard libraries implement as one
+    ///   `memmove` per deque block; other ranges are converted element by element.
+    ///
+    /// A state's `update` therefore makes one call for contiguous input and
+    /// one per segment or gathered block otherwise. Empty pieces may be
+    /// passed. Run time only: uses `reinterpret_cast`.
+    template <typename Range, typename Fn>
+    void for_each_segment(Range && range, Fn && fn)
+    {
+        using value_type = ::std::ranges::range_value_t<Range>;
+
+        if constexpr (contiguous_byte_range<Range>)
+        {
+            fn(::std::span<unsigned char const>{
+                detail::byte_data(range), static_cast<::std::size_t>(::std::ranges::size(range))});
+        }
+        else if constexpr (segmented_byte_range<Range>)
+        {
+            auto && segments = [&range]() -> decltype(auto) {
+                if constexpr (requires { range.segments(); })
+                    return range.segments();
+                else
+                    return range.base();
+            }();
+            for (auto && segment : segments)
+                fn(::std::span<unsigned char const>{detail::byte_data(segment),
+                    static_cast<::std::size_t>(::std::ranges::size(segment))});
+        }
+        else if constexpr (::std::ranges::random_access_range<Range>
+            && ::std::ranges::sized_range<Range> && sizeof(value_type) == 1
+            && ::std::is_trivially_copyable_v<value_type>)
+        {
+            value_type buffer[gather_buffer_size];
+            auto it = ::std::ranges::begin(range);
+            auto remaining = static_cast<::std::size_t>(::std::ranges::size(range));
+            while (remaining != 0)
+            {
+                auto const n = (::std::min)(remaining, gather_buffer_size);
+                auto const next = it + static_cast<::std::iter_difference_t<decltype(it)>>(n);
+                ::std::copy(it, next, buffer);
+                fn(::std::span<unsigned char const>{
+                    reinterpret_cast<unsigned char const *>(buffer), n});
+                it = next;
+                remaining -= n;
+            }
+        }
+        else
+        {
+            unsigned char buffer[gather_buffer_size];
+            ::std::size_t n = 0;
+            for (auto && c : range)
+            {
+                buffer[n++] = static_cast<unsigned char>(static_cast<::std::uint8_t>(c));
+                if (n == gather_buffer_size)
+                {
+                    fn(::std::span<unsigned char const>{buffer, n});
+                    n = 0;
+                }
+            }
+            if (n != 0)
+                fn(::std::span<unsigned char const>{buffer, n});
+        }
+    }
+} // namespace scl::hash::detail
@@ -0,0 +1,238 @@
+#pragma once
+
+/// @file dispatch.h
+/// @brief Runtime CPU-feature detection and SIMD level selection for hash kernels.
+/// @ingroup scl_utility_hash
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @def SCL_HASH_X86_64
+ * @brief `1` when targeting x86-64, where the hash kernels have SIMD variants.
+ * @ingroup scl_utility_hash
+ */
+#if defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64)
+#define SCL_HASH_X86_64 1
+#else
+#define SCL_HASH_X86_64 0
+#endif
+
+/**
+ * @def SCL_HASH_TARGET(features)
+ * @brief Compiles one function for the instruction sets in @p features.
+ * @ingroup scl_utility_hash
+ * @details
+ * Lets a translation unit built for baseline x86-64 contain AVX2 or AVX-512
+ * kernels; they are only called after @ref scl::hash::active_simd_level has
+ * confirmed support. Every function that touches the wider vector types —
+ * helpers included — needs the attribute, since GCC and Clang refuse to
+ * inline target-specific intrinsics into functions without it.
+ *
+ * Detection order:
+ *  1. GCC, Clang: @c __attribute__((target(features)))
+ *  2. MSVC: empty — intrinsics for every instruction set are always available.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define SCL_HASH_TARGET(features) __attribute__((target(features)))
+#else
+#define SCL_HASH_TARGET(features)
+#endif
+
+#if SCL_HASH_X86_64
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#include <immintrin.h>
+#endif
+
+namespace scl::hash
+{
+    /// @brief Instruction-set tiers of the runtime hash kernels, in increasing order.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Each level implies all lower ones. A kernel runs the widest variant at or
+    /// below the active level and falls back to portable scalar code otherwise:
+    ///
+    /// | Level    | Kernels                                                |
+    /// |----------|--------------------------------------------------------|
+    /// | `scalar` | portable C++ only                                      |
+    /// | `sse2`   | XXH3 stripe loop (x86-64 baseline), ASCII case folding |
+    /// | `sse42`  | CRC-32C `crc32` instruction                            |
+    /// | `avx2`   | XXH3 stripe loop, 4-lane `siphash_batch`, case folding |
+    /// | `avx512` | XXH3 stripe loop, 8-lane `siphash_batch` (AVX-512F)    |
+    enum class simd_level : ::std::uint8_t
+    {
+        scalar,
+        sse2,
+        sse42,
+        avx2,
+        avx512,
+    };
+
+    namespace detail
+    {
+#if SCL_HASH_X86_64
+        /// @brief Executes `cpuid` for @p leaf / @p subleaf; returns `{eax, ebx, ecx, edx}`.
+        inline void cpuid(unsigned const leaf, unsigned const subleaf, unsigned (&r)[4]) noexcept
+        {
+#if defined(_MSC_VER)
+            int regs[4];
+            __cpuidex(regs, static_cast<int>(leaf), static_cast<int>(subleaf));
+            for (int i = 0; i < 4; ++i)
+                r[i] = static_cast<unsigned>(regs[i]);
+#else
+            __cpuid_count(leaf, subleaf, r[0], r[1], r[2], r[3]);
+#endif
+        }
+
+        /// @brief Reads `XCR0`: the register state the operating system saves on context switch.
+        inline ::std::uint64_t xgetbv0() noexcept
+        {
+#if defined(_MSC_VER)
+            return _xgetbv(0);
+#else
+            unsigned lo = 0;
+            unsigned hi = 0;
+            __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+            return (::std::uint64_t{hi} << 32) | lo;
+#endif
+        }
+#endif
+
+        /// @brief Queries the processor and operating system for the highest usable level.
+        ///
+        /// AVX and AVX-512 additionally need the OS to save the wider
+        /// registers (`OSXSAVE` and the `XCR0` state bits); a CPU that
+        /// supports AVX2 under an OS that does not is reported as `sse42`.
+        inline simd_level detect_simd_level() noexcept
+        {
+#if SCL_HASH_X86_64
+            unsigned r[4];
+            detail::cpuid(0, 0, r);
+            unsigned const max_leaf = r[0];
+
+            detail::cpuid(1, 0, r);
+            unsigned const ecx1 = r[2];
+            bool const sse42 = (ecx1 & (1u << 20)) != 0;
+            bool const osxsave = (ecx1 & (1u << 27)) != 0;
+            bool const avx = (ecx1 & (1u << 28)) != 0;
+            if (!sse42)
+                return simd_level::sse2;
+            if (!osxsave || !avx || max_leaf < 7)
+                return simd_level::sse42;
+
+            ::std::uint64_t const xcr0 = detail::xgetbv0();
+            if ((xcr0 & 0x6) != 0x6) // XMM and YMM state
+                return simd_level::sse42;
+
+            detail::cpuid(7, 0, r);
+            bool const avx2 = (r[1] & (1u << 5)) != 0;
+            bool const avx512f = (r[1] & (1u << 16)) != 0;
+            if (!avx2)
+                return simd_level::sse42;
+            if (avx512f && (xcr0 & 0xe6) == 0xe6) // plus opmask and ZMM state
+                return simd_level::avx512;
+            return simd_level::avx2;
+#else
+            return simd_level::scalar;
+#endif
+        }
+
+        /// @brief Marks a level cell not yet filled by @ref publish_simd_level; not a real level.
+        inline constexpr simd_level undetected_simd_level = static_cast<simd_level>(0xff);
+
+        /// @brief Result of @ref detect_simd_level, or @ref undetected_simd_level before first use.
+        ///
+        /// Constant-initialised, so reading it needs no function-local static
+        /// and no `__cxa_guard` check, like the runtime SipHash key.
+        inline constinit ::std::atomic<simd_level> detected_level{undetected_simd_level};
+
+        /// @brief The level the kernels dispatch on; starts at the detected level.
+        inline constinit ::std::atomic<simd_level> active_level{undetected_simd_level};
+
+        /// @brief Cold path of the first query: detects the level and publishes it.
+        ///
+        /// Detection is idempotent, so racing threads may both run it and
+        /// store the same value. The active level is only filled if still
+        /// unset, keeping a concurrent @ref force_simd_level.
+        ///
+        /// @return The active level after publishing.
+        [[gnu::noinline]] inline simd_level publish_simd_level() noexcept
+        {
+            simd_level const level = detail::detect_simd_level();
+            detected_level.store(level, ::std::memory_order_relaxed);
+            simd_level active = undetected_simd_level;
+            if (active_level.compare_exchange_strong(active, level, ::std::memory_order_relaxed))
+                return level;
+            return active;
+        }
+    } // namespace detail
+
+    /// @brief Returns the highest SIMD level supported by this processor and OS.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Detected with `cpuid` on first use and cached for the lifetime of the
+    /// program. Always @ref simd_level::scalar on non-x86-64 targets.
+    inline simd_level detected_simd_level() noexcept
+    {
+        simd_level const level = detail::detected_level.load(::std::memory_order_relaxed);
+        if (level == detail::undetected_simd_level) [[unlikely]]
+        {
+            detail::publish_simd_level();
+            return detail::detected_level.load(::std::memory_order_relaxed);
+        }
+        return level;
+    }
+
+    /// @brief Returns the SIMD level the runtime hash kernels currently use.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Equals @ref detected_simd_level unless lowered by @ref force_simd_level.
+    /// Kernels read it with one relaxed atomic load and one compare per call;
+    /// only the first call runs `cpuid`.
+    inline simd_level active_simd_level() noexcept
+    {
+        simd_level const level = detail::active_level.load(::std::memory_order_relaxed);
+        if (level == detail::undetected_simd_level) [[unlikely]]
+            return detail::publish_simd_level();
+        return level;
+    }
+
+    /// @brief Restricts the runtime hash kernels to @p level or below.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Intended for tests and benchmarks that compare the kernel variants.
+    /// Requests above @ref detected_simd_level are clamped to it, so an
+    /// unsupported instruction is never executed. Affects all threads;
+    /// results are identical at every level, only speed changes.
+    ///
+    /// @param  level  Highest level to use.
+    /// @return The level now in effect.
+    ///
+    /// @code
+    /// for (auto level : {simd_level::scalar, simd_level::sse2, simd_level::avx2})
+    /// {
+    ///     scl::hash::force_simd_level(level);
+    ///     assert(scl::hash::xxh3_64(std::span{blob}) == expected);
+    /// }
+    /// scl::hash::reset_simd_level();
+    /// @endcode
+    inline simd_level force_simd_level(simd_level const level) noexcept
+    {
+        simd_level const detected = detected_simd_level();
+        simd_level const applied = level < detected ? level : detected;
+        detail::active_level.store(applied, ::std::memory_order_relaxed);
+        return applied;
+    }
+
+    /// @brief Restores the detected SIMD level after @ref force_simd_level.
+    /// @ingroup scl_utility_hash
+    inline void reset_simd_level() noexcept
+    {
+        detail::active_level.store(detected_simd_level(), ::std::memory_order_relaxed);
+    }
+
+} // namespace scl::hash
@@ -4,6 +4,8 @@
 /// @brief djb2a — Daniel J. Bernstein's hash (XOR variant), 64-bit.
 /// @ingroup scl_utility_hash
 
+#include <scl/utility/hash/mix.h>
+
 #include <concepts>
 #include <cstdint>
 #include <numeric>
@@ -32,7 +34,7 @@ namespace scl::hash
     ///       h     = scl::hash::djb2(second_range, h);
     ///       @endcode
     ///
-    /// @tparam Range  Any type satisfying `std::ranges::range` whose elements
+    /// @tparam Range  Any type satisfying `std::ranges::input_range` whose elements
     ///                are convertible to `std::uint8_t` — e.g. a string literal,
     ///                `std::string_view`, `std::string`, `std::span<std::byte>`.
     /// @param  range  Input range to hash.
@@ -47,8 +49,8 @@ namespace scl::hash
     /// constexpr auto h = scl::hash::djb2("hello");
     /// static_assert(h != 0);
     /// @endcode
-    template <::std::ranges::range Range>
-    constexpr ::std::uint64_t djb2(Range const & range, ::std::uint64_t h = 5381ull)
+    template <::std::ranges::input_range Range>
+    constexpr ::std::uint64_t djb2(Range && range, ::std::uint64_t h = 5381ull)
         requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
     {
         return ::std::accumulate(::std::ranges::begin(range), ::std::ranges::end(range), h,
@@ -57,18 +59,65 @@ namespace scl::hash
         });
     }
 
+    /// @brief Incremental djb2a state for hashing a message split into several ranges.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Feeding the pieces of a message through @ref update and calling
+    /// @ref finalize yields the same digest as @ref djb2 over the
+    /// concatenated bytes, however the message is split:
+    /// @code
+    /// constexpr auto h = scl::hash::djb2_state{}
+    ///     .update(std::string_view{"foo"})
+    ///     .update(std::string_view{"bar"})
+    ///     .finalize();
+    /// static_assert(h == scl::hash::djb2(std::string_view{"foobar"}));
+    /// @endcode
+    struct djb2_state
+    {
+        using result_type = ::std::uint64_t;
+
+        /// @brief Starts a new message with seed the traditional djb2 seed `5381`.
+        constexpr djb2_state() noexcept = default;
+
+        /// @brief Starts a new message with a custom seed @p h.
+        constexpr explicit djb2_state(::std::uint64_t const h) noexcept
+            : m_h{h}
+        {}
+
+        /// @brief Appends @p range to the message.
+        template <::std::ranges::input_range Range>
+        constexpr djb2_state & update(Range && range) noexcept
+            requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+        {
+            m_h = ::scl::hash::djb2(range, m_h);
+            return *this;
+        }
+
+        /// @brief Returns the digest of all bytes appended so far.
+        constexpr result_type finalize() const noexcept { return m_h; }
+
+    private:
+        ::std::uint64_t m_h{5381ull};
+    };
+
     /// @brief Callable wrapper around @ref djb2 for use with @ref scl::hash::key.
     /// @ingroup scl_utility_hash
     struct djb2_hasher
     {
         using result_type = ::std::uint64_t;
+        using state_type = djb2_state;
+        /// @brief Mixer applied by `std::hash<key<...>>`: low digest bits depend only on low input bits.
+        using mixer = fmix64_mixer;
 
-        template <::std::ranges::range Range>
-        constexpr result_type operator()(Range const & range) const noexcept
+        template <::std::ranges::input_range Range>
+        constexpr result_type operator()(Range && range) const noexcept
             requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
         {
             return ::scl::hash::djb2(range);
         }
+
+        /// @brief Returns a fresh streaming state producing the same digests.
+        constexpr state_type make_state() const noexcept { return state_type{}; }
     };
 
 } // namespace scl::hash
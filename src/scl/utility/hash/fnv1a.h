@@ -4,6 +4,8 @@
 /// @brief FNV-1a (Fowler-Noll-Vo, variant 1a) 64-bit hash algorithm.
 /// @ingroup scl_utility_hash
 
+#include <scl/utility/hash/mix.h>
+
 #include <concepts>
 #include <cstdint>
 #include <ranges>
@@ -31,7 +33,7 @@ namespace scl::hash
     ///       h     = scl::hash::fnv1a(second_range, h);
     ///       @endcode
     ///
-    /// @tparam Range  Any type satisfying `std::ranges::range` whose elements
+    /// @tparam Range  Any type satisfying `std::ranges::input_range` whose elements
     ///                are convertible to `std::uint8_t` — e.g. a string literal,
     ///                `std::string_view`, `std::string`, `std::span<std::byte>`.
     /// @param  range  Input range to hash.
@@ -48,8 +50,8 @@ namespace scl::hash
     /// constexpr auto h = scl::hash::fnv1a("hello");
     /// static_assert(h != 0);
     /// @endcode
-    template <::std::ranges::range Range>
-    constexpr ::std::uint64_t fnv1a(Range const & range, ::std::uint64_t h = 14695981039346656037ull)
+    template <::std::ranges::input_range Range>
+    constexpr ::std::uint64_t fnv1a(Range && range, ::std::uint64_t h = 14695981039346656037ull)
         requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
     {
         for (auto const c : range)
@@ -60,18 +62,65 @@ namespace scl::hash
         return h;
     }
 
+    /// @brief Incremental FNV-1a state for hashing a message split into several ranges.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Feeding the pieces of a message through @ref update and calling
+    /// @ref finalize yields the same digest as @ref fnv1a over the
+    /// concatenated bytes, however the message is split:
+    /// @code
+    /// constexpr auto h = scl::hash::fnv1a_state{}
+    ///     .update(std::string_view{"foo"})
+    ///     .update(std::string_view{"bar"})
+    ///     .finalize();
+    /// static_assert(h == scl::hash::fnv1a(std::string_view{"foobar"}));
+    /// @endcode
+    struct fnv1a_state
+    {
+        using result_type = ::std::uint64_t;
+
+        /// @brief Starts a new message with seed the FNV-1a 64-bit offset basis.
+        constexpr fnv1a_state() noexcept = default;
+
+        /// @brief Starts a new message with a custom seed @p h.
+        constexpr explicit fnv1a_state(::std::uint64_t const h) noexcept
+            : m_h{h}
+        {}
+
+        /// @brief Appends @p range to the message.
+        template <::std::ranges::input_range Range>
+        constexpr fnv1a_state & update(Range && range) noexcept
+            requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+        {
+            m_h = ::scl::hash::fnv1a(range, m_h);
+            return *this;
+        }
+
+        /// @brief Returns the digest of all bytes appended so far.
+        constexpr result_type finalize() const noexcept { return m_h; }
+
+    private:
+        ::std::uint64_t m_h{14695981039346656037ull};
+    };
+
     /// @brief Callable wrapper around @ref fnv1a for use with @ref scl::hash::key.
     /// @ingroup scl_utility_hash
     struct fnv1a_hasher
     {
         using result_type = ::std::uint64_t;
+        using state_type = fnv1a_state;
+        /// @brief Mixer applied by `std::hash<key<...>>`: low digest bits depend only on low input bits.
+        using mixer = fmix64_mixer;
 
-        template <::std::ranges::range Range>
-        constexpr result_type operator()(Range const & range) const noexcept
+        template <::std::ranges::input_range Range>
+        constexpr result_type operator()(Range && range) const noexcept
             requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
         {
             return ::scl::hash::fnv1a(range);
         }
+
+        /// @brief Returns a fresh streaming state producing the same digests.
+        constexpr state_type make_state() const noexcept { return state_type{}; }
     };
 
 } // namespace scl::hash
@@ -0,0 +1,251 @@
+#pragma once
+
+/// @file halfsiphash.h
+/// @brief HalfSipHash-2-4: 32-bit keyed SipHash variant for 32-bit digests.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/detail/load.h>
+#include <scl/utility/hash/detail/segments.h>
+#include <scl/utility/hash/mix.h>
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace scl::hash
+{
+    /// @brief 64-bit secret key for HalfSipHash.
+    /// @ingroup scl_utility_hash
+    ///
+    /// The same rules as for @ref siphash_key apply: use a random key for
+    /// hash-flooding protection, a fixed one for compile-time identifiers.
+    struct halfsiphash_key
+    {
+        ::std::uint32_t k0{};
+        ::std::uint32_t k1{};
+    };
+
+    namespace detail
+    {
+        /// @brief Single HalfSipHash mixing round (32-bit words).
+        constexpr void half_sip_round(::std::uint32_t & v0,
+            ::std::uint32_t & v1,
+            ::std::uint32_t & v2,
+            ::std::uint32_t & v3) noexcept
+        {
+            v0 += v1;
+            v1 = ::std::rotl(v1, 5);
+            v1 ^= v0;
+            v0 = ::std::rotl(v0, 16);
+            v2 += v3;
+            v3 = ::std::rotl(v3, 8);
+            v3 ^= v2;
+            v0 += v3;
+            v3 = ::std::rotl(v3, 7);
+            v3 ^= v0;
+            v2 += v1;
+            v1 = ::std::rotl(v1, 13);
+            v1 ^= v2;
+            v2 = ::std::rotl(v2, 16);
+        }
+    } // namespace detail
+
+    /// @brief Default key for non-security-sensitive use.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Reference-implementation test-vector key: bytes 0x00–0x07 in
+    /// little-endian order. **Do not use this key where hash-flooding resistance
+    /// is required.**
+    inline constexpr halfsiphash_key halfsiphash_default_key{
+        .k0 = 0x03020100u, // bytes 00..03
+        .k1 = 0x07060504u  // bytes 04..07
+    };
+
+    /// @brief Incremental HalfSipHash-c-d state for hashing a message split into several ranges.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Counterpart of @ref siphash_state working on 4-byte blocks of 32-bit
+    /// words. The digest returned by @ref finalize equals @ref halfsiphash over
+    /// the concatenated bytes, however the message is split.
+    ///
+    /// @tparam C  Compression rounds per 4-byte block.
+    /// @tparam D  Finalization rounds.
+    template <::std::size_t C = 2, ::std::size_t D = 4>
+    struct halfsiphash_state
+    {
+        static_assert(C > 0 && D > 0, "HalfSipHash requires at least one round of each kind");
+
+        using result_type = ::std::uint32_t;
+
+        /// @brief Starts a new message keyed with @p key.
+        constexpr explicit halfsiphash_state(
+            halfsiphash_key const key = halfsiphash_default_key) noexcept
+            : m_v0{key.k0}
+            , m_v1{key.k1}
+            , m_v2{key.k0 ^ 0x6c796765u}
+            , m_v3{key.k1 ^ 0x74656462u}
+        {}
+
+        /// @brief Appends @p range to the message.
+        template <::std::ranges::input_range Range>
+        constexpr halfsiphash_state & update(Range && range) noexcept
+            requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+        {
+            if (!::std::is_constant_evaluated())
+            {
+                detail::for_each_segment(range, [this](::std::span<unsigned char const> bytes) {
+                    update_bytes(bytes.data(), bytes.size());
+                });
+                return *this;
+            }
+
+            for (auto const c : range)
+            {
+                auto const byte = static_cast<::std::uint32_t>(static_cast<::std::uint8_t>(c));
+                m_tail |= byte << ((m_len & 3) * 8);
+                if ((++m_len & 3) == 0) // full 4-byte block ready
+                {
+                    compress(m_v0, m_v1, m_v2, m_v3, m_tail);
+                    m_tail = 0;
+                }
+            }
+            return *this;
+        }
+
+        /// @brief Returns the digest of all bytes appended so far.
+        constexpr result_type finalize() const noexcept
+        {
+            ::std::uint32_t v0 = m_v0;
+            ::std::uint32_t v1 = m_v1;
+            ::std::uint32_t v2 = m_v2;
+            ::std::uint32_t v3 = m_v3;
+
+            // Last (partial) block: high byte encodes message length mod 256.
+            ::std::uint32_t const last =
+                m_tail | (static_cast<::std::uint32_t>(m_len & 0xffu) << 24);
+            compress(v0, v1, v2, v3, last);
+
+            // Finalization: D rounds.
+            v2 ^= 0xffu;
+            for (::std::size_t i = 0; i < D; ++i)
+                detail::half_sip_round(v0, v1, v2, v3);
+
+            return v1 ^ v3;
+        }
+
+    private:
+        /// @brief Absorbs one 4-byte block with C compression rounds.
+        static constexpr void compress(::std::uint32_t & v0,
+            ::std::uint32_t & v1,
+            ::std::uint32_t & v2,
+            ::std::uint32_t & v3,
+            ::std::uint32_t const m) noexcept
+        {
+            v3 ^= m;
+            for (::std::size_t i = 0; i < C; ++i)
+                detail::half_sip_round(v0, v1, v2, v3);
+            v0 ^= m;
+        }
+
+        /// @brief Runtime path: word-at-a-time absorption of contiguous memory.
+        void update_bytes(unsigned char const * p, ::std::size_t n) noexcept
+        {
+            ::std::size_t const fill = m_len & 3;
+            m_len += n;
+
+            if (fill != 0) // complete the buffered partial block first
+            {
+                ::std::size_t const k = n < 4 - fill ? n : 4 - fill;
+                m_tail |= detail::load_le32_partial(p, k) << (fill * 8);
+                if (fill + k < 4)
+                    return;
+                compress(m_v0, m_v1, m_v2, m_v3, m_tail);
+                p += k;
+                n -= k;
+            }
+
+            for (; n >= 4; p += 4, n -= 4)
+                compress(m_v0, m_v1, m_v2, m_v3, detail::load_le<::std::uint32_t>(p));
+
+            m_tail = detail::load_le32_partial(p, n);
+        }
+
+        ::std::uint32_t m_v0;
+        ::std::uint32_t m_v1;
+        ::std::uint32_t m_v2;
+        ::std::uint32_t m_v3;
+        ::std::uint32_t m_tail{}; ///< Pending bytes of the current block (little-endian).
+        ::std::size_t m_len{};    ///< Total number of bytes appended.
+    };
+
+    /// @brief Computes a HalfSipHash-c-d 32-bit hash over an arbitrary byte range.
+    /// @ingroup scl_utility_hash
+    ///
+    /// HalfSipHash is the 32-bit-word variant of SipHash by Jean-Philippe
+    /// Aumasson: a 64-bit key, 4-byte blocks and a 32-bit digest. It suits
+    /// 32-bit platforms and tables that store 4-byte hashes (for example
+    /// `key<halfsiphash_hasher<>>`), where it is cheaper than truncating a
+    /// 64-bit SipHash digest. It is used by the Linux kernel for hash tables on
+    /// 32-bit targets.
+    ///
+    /// The function is `constexpr`, allowing compile-time hash computation.
+    ///
+    /// @tparam C      Compression rounds per block. Defaults to `2`.
+    /// @tparam D      Finalization rounds. Defaults to `4`.
+    /// @tparam Range  Any type satisfying `std::ranges::input_range` whose elements
+    ///                are convertible to `std::uint8_t`.
+    /// @param  range  Input range to hash.
+    /// @note   String literals (e.g. `"hello"`) include the null terminator in the
+    ///         hash. Use `std::string_view{"hello"}` to hash only the characters.
+    /// @param  key    64-bit secret key. Defaults to @ref halfsiphash_default_key.
+    /// @return 32-bit HalfSipHash-c-d digest (HalfSipHash-2-4 by default).
+    ///
+    /// @par Compile-time example
+    /// @code
+    /// constexpr auto h = scl::hash::halfsiphash("hello");
+    /// static_assert(h != 0);
+    /// @endcode
+    ///
+    /// @see https://github.com/veorq/SipHash — reference implementation and vectors
+    template <::std::size_t C = 2, ::std::size_t D = 4, ::std::ranges::input_range Range>
+    constexpr ::std::uint32_t halfsiphash(
+        Range && range, halfsiphash_key const key = halfsiphash_default_key)
+        requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+    {
+        return halfsiphash_state<C, D>{key}.update(range).finalize();
+    }
+
+    /// @brief Callable wrapper around @ref halfsiphash for use with @ref scl::hash::key.
+    /// @ingroup scl_utility_hash
+    /// @note `value_type` deduced as `std::uint32_t`.
+    ///
+    /// @tparam Key  64-bit HalfSipHash key. Defaults to @ref halfsiphash_default_key.
+    /// @tparam C    Compression rounds per block. Defaults to `2`.
+    /// @tparam D    Finalization rounds. Defaults to `4`.
+    template <halfsiphash_key Key = halfsiphash_default_key,
+        ::std::size_t C = 2,
+        ::std::size_t D = 4>
+    struct halfsiphash_hasher
+    {
+        using result_type = ::std::uint32_t;
+        using state_type = halfsiphash_state<C, D>;
+        /// @brief Mixer applied by `std::hash<key<...>>`: spreads the 32-bit digest over all 64 bits.
+        using mixer = fmix64_mixer;
+
+        template <::std::ranges::input_range Range>
+        constexpr result_type operator()(Range && range) const noexcept
+            requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+        {
+            return ::scl::hash::halfsiphash<C, D>(range, Key);
+        }
+
+        /// @brief Returns a fresh streaming state keyed with @p Key.
+        constexpr state_type make_state() const noexcept { return state_type{Key}; }
+    };
+
+} // namespace scl::hash
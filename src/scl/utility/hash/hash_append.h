@@ -0,0 +1,293 @@
+#pragma once
+
+/// @file hash_append.h
+/// @brief N3980-style `hash_append` protocol: hashing structured values through streaming states.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/key.h>
+#include <scl/utility/hash/siphash.h>
+#include <scl/utility/hash/uint128.h>
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace scl::hash::concepts
+{
+    /// @brief Concept satisfied by the streaming states, e.g. @ref scl::hash::fnv1a_state:
+    ///        `update(bytes)` appends bytes, `finalize()` returns a @ref digest.
+    /// @ingroup scl_utility_hash
+    // clang-format off
+    template <typename S>
+    concept hash_state = ::std::copy_constructible<S>
+            && requires(S & s, S const & cs, ::std::span<unsigned char const> bytes) {
+                   s.update(bytes);
+                   { cs.finalize() } -> digest;
+               };
+    // clang-format on
+} // namespace scl::hash::concepts
+
+namespace scl::hash
+{
+    namespace detail
+    {
+        /// @brief `std::pair` and `std::tuple` specialisations.
+        template <typename T>
+        inline constexpr bool is_tuple = false;
+        template <typename... T>
+        inline constexpr bool is_tuple<::std::tuple<T...>> = true;
+        template <typename T1, typename T2>
+        inline constexpr bool is_tuple<::std::pair<T1, T2>> = true;
+
+        /// @brief Integral types whose in-memory bytes are already the little-endian
+        ///        encoding written by @ref scl::hash::hash_append, so arrays of them
+        ///        may be appended in one `update`.
+        template <typename T>
+        inline constexpr bool is_le_bytes = ::std::integral<T> && !::std::same_as<T, bool>
+            && (sizeof(T) == 1 || ::std::endian::native == ::std::endian::little);
+
+        /// @brief Floating-point types encoded by @ref scl::hash::hash_append.
+        template <typename T>
+        concept hashable_float = ::std::floating_point<T> && ::std::numeric_limits<T>::is_iec559
+            && (sizeof(T) == sizeof(::std::uint32_t) || sizeof(T) == sizeof(::std::uint64_t));
+
+        /// @brief Appends @p v as @p Bytes little-endian bytes.
+        template <::std::size_t Bytes, concepts::hash_state State>
+        constexpr void append_le(State & state, ::std::uint64_t const v) noexcept
+        {
+            ::std::array<unsigned char, Bytes> bytes{};
+            for (::std::size_t i = 0; i < Bytes; ++i)
+                bytes[i] = static_cast<unsigned char>(v >> (8 * i));
+            state.update(::std::span<unsigned char const>{bytes});
+        }
+    } // namespace detail
+
+    // All built-in overloads are declared before any is defined, so that
+    // nested standard types — e.g. `std::vector<std::pair<int, std::string>>`,
+    // whose only associated namespace is `std` — find each other.
+
+    template <concepts::hash_state State, ::std::integral T>
+    constexpr void hash_append(State & state, T v) noexcept;
+
+    template <concepts::hash_state State, typename T>
+        requires ::std::is_enum_v<T>
+    constexpr void hash_append(State & state, T v) noexcept;
+
+    template <concepts::hash_state State, detail::hashable_float T>
+    constexpr void hash_append(State & state, T v) noexcept;
+
+    template <concepts::hash_state State>
+    constexpr void hash_append(State & state, uint128 v) noexcept;
+
+    template <concepts::hash_state State, concepts::byte_hasher Hasher>
+    constexpr void hash_append(State & state, key<Hasher> const & k) noexcept;
+
+    template <concepts::hash_state State, ::std::ranges::contiguous_range Range>
+        requires ::std::ranges::sized_range<Range const>
+    constexpr void hash_append(State & state, Range const & range);
+
+    template <concepts::hash_state State, typename Tuple>
+        requires detail::is_tuple<Tuple>
+    constexpr void hash_append(State & state, Tuple const & tuple);
+
+    template <concepts::hash_state State, typename T>
+    constexpr void hash_append(State & state, ::std::optional<T> const & value);
+
+    /// @brief Appends an integral value as its `sizeof(T)` little-endian bytes.
+    /// @ingroup scl_utility_hash
+    ///
+    /// The encoding does not depend on the platform's byte order, so digests
+    /// of structured values are portable. `bool` is one byte, 0 or 1.
+    /// Where the compiler treats `__int128` as integral, it is appended as
+    /// its low, then its high 8 bytes — the same 16 little-endian bytes.
+    template <concepts::hash_state State, ::std::integral T>
+    constexpr void hash_append(State & state, T const v) noexcept
+    {
+        if constexpr (sizeof(T) > sizeof(::std::uint64_t))
+        {
+            static_assert(sizeof(T) == 2 * sizeof(::std::uint64_t));
+            auto const u = static_cast<::std::make_unsigned_t<T>>(v);
+            detail::append_le<8>(state, static_cast<::std::uint64_t>(u));
+            detail::append_le<8>(state, static_cast<::std::uint64_t>(u >> 64));
+        }
+        else
+            detail::append_le<sizeof(T)>(state, static_cast<::std::uint64_t>(v));
+    }
+
+    /// @brief Appends an enumerator as its underlying integral value.
+    /// @ingroup scl_utility_hash
+    template <concepts::hash_state State, typename T>
+        requires ::std::is_enum_v<T>
+    constexpr void hash_append(State & state, T const v) noexcept
+    {
+        scl::hash::hash_append(state, static_cast<::std::underlying_type_t<T>>(v));
+    }
+
+    /// @brief Appends an IEEE-754 `float` or `double` as its bit pattern.
+    /// @ingroup scl_utility_hash
+    ///
+    /// `-0.0` is normalised to `+0.0`, so values that compare equal hash
+    /// equal. NaNs hash by their bit pattern; they never compare equal anyway.
+    template <concepts::hash_state State, detail::hashable_float T>
+    constexpr void hash_append(State & state, T v) noexcept
+    {
+        if (v == T{0})
+            v = T{0};
+        using bits_type = ::std::conditional_t<sizeof(T) == 4, ::std::uint32_t, ::std::uint64_t>;
+        scl::hash::hash_append(state, ::std::bit_cast<bits_type>(v));
+    }
+
+    /// @brief Appends a 128-bit digest: @ref uint128::lo, then @ref uint128::hi.
+    /// @ingroup scl_utility_hash
+    template <concepts::hash_state State>
+    constexpr void hash_append(State & state, uint128 const v) noexcept
+    {
+        scl::hash::hash_append(state, v.lo);
+        scl::hash::hash_append(state, v.hi);
+    }
+
+    /// @brief Appends the digest held by a @ref key.
+    /// @ingroup scl_utility_hash
+    template <concepts::hash_state State, concepts::byte_hasher Hasher>
+    constexpr void hash_append(State & state, key<Hasher> const & k) noexcept
+    {
+        scl::hash::hash_append(state, k.value);
+    }
+
+    /// @brief Appends every element of a contiguous range, then its size as 8 bytes.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Covers `std::string`, `std::string_view`, `std::vector`, `std::array`,
+    /// `std::span` and built-in arrays. The trailing size keeps
+    /// `{"ab", "c"}` and `{"a", "bc"}` apart. Elements that are integers
+    /// whose memory is their little-endian encoding (all byte-sized
+    /// elements, and every integer on little-endian targets) are appended
+    /// in one `update` at run time.
+    ///
+    /// @note A string literal is an array and includes its null terminator;
+    ///       wrap it in `std::string_view` to hash only the characters.
+    template <concepts::hash_state State, ::std::ranges::contiguous_range Range>
+        requires ::std::ranges::sized_range<Range const>
+    constexpr void hash_append(State & state, Range const & range)
+    {
+        using value_type = ::std::ranges::range_value_t<Range>;
+        auto const size = static_cast<::std::uint64_t>(::std::ranges::size(range));
+        if constexpr (detail::is_le_bytes<value_type>)
+        {
+            if (!::std::is_constant_evaluated())
+            {
+                state.update(::std::span<unsigned char const>{
+                    reinterpret_cast<unsigned char const *>(::std::ranges::data(range)),
+                    size * sizeof(value_type)});
+                scl::hash::hash_append(state, size);
+                return;
+            }
+        }
+        for (auto const & element : range)
+            hash_append(state, element);
+        scl::hash::hash_append(state, size);
+    }
+
+    /// @brief Appends every element of a `std::pair` or `std::tuple` in order.
+    /// @ingroup scl_utility_hash
+    template <concepts::hash_state State, typename Tuple>
+        requires detail::is_tuple<Tuple>
+    constexpr void hash_append(State & state, Tuple const & tuple)
+    {
+        ::std::apply(
+            [&state](auto const &... element) { (hash_append(state, element), ...); }, tuple);
+    }
+
+    /// @brief Appends whether a `std::optional` holds a value (one byte), then the value if any.
+    /// @ingroup scl_utility_hash
+    template <concepts::hash_state State, typename T>
+    constexpr void hash_append(State & state, ::std::optional<T> const & value)
+    {
+        scl::hash::hash_append(state, value.has_value());
+        if (value)
+            hash_append(state, *value);
+    }
+
+    /// @brief `std::unordered_map`-compatible hash function object over the `hash_append` protocol.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Hashes any value for which `hash_append(state, value)` is found — the
+    /// built-in overloads above, or user overloads found by argument-dependent
+    /// lookup — into a copy of a prototype @p State, and folds the digest into
+    /// `std::size_t`. Nothing is serialised into a buffer and nothing is allocated.
+    ///
+    /// User-defined types provide a `hash_append` overload in their own
+    /// namespace that appends the members that take part in `==`:
+    /// @code
+    /// namespace app {
+    ///     struct route { std::string host; std::uint16_t port; std::optional<std::string> path; };
+    ///     bool operator==(route const &, route const &) = default;
+    ///
+    ///     template <scl::hash::concepts::hash_state State>
+    ///     constexpr void hash_append(State & state, route const & r) {
+    ///         using scl::hash::hash_append;
+    ///         hash_append(state, r.host);
+    ///         hash_append(state, r.port);
+    ///         hash_append(state, r.path);
+    ///     }
+    /// }
+    ///
+    /// std::unordered_map<app::route, int, scl::hash::hasher<>> cache;
+    /// @endcode
+    ///
+    /// Keyed states take their key from the prototype:
+    /// @code
+    /// scl::hash::hasher<scl::hash::siphash13_state> const h{scl::hash::siphash13_state{runtime_key}};
+    /// std::unordered_set<app::route, decltype(h)> routes(0, h);
+    /// @endcode
+    ///
+    /// @tparam State  A @ref concepts::hash_state. Defaults to SipHash-1-3.
+    template <concepts::hash_state State = siphash13_state>
+    struct hasher
+    {
+        /// @brief Streaming state type.
+        using state_type = State;
+
+        /// @brief Uses a default-constructed @p State.
+        constexpr hasher() noexcept(::std::is_nothrow_default_constructible_v<State>)
+            requires ::std::default_initializable<State>
+            : m_state{}
+        {}
+
+        /// @brief Uses copies of @p state — e.g. a keyed or seeded one — for every value.
+        constexpr explicit hasher(State const & state) noexcept(
+            ::std::is_nothrow_copy_constructible_v<State>)
+            : m_state{state}
+        {}
+
+        /// @brief Returns the digest of @p value as `std::size_t`.
+        template <typename T>
+        constexpr ::std::size_t operator()(T const & value) const
+            requires requires(State & s) { hash_append(s, value); }
+        {
+            State state{m_state};
+            hash_append(state, value);
+            return detail::fold_to_size(digest(state.finalize()));
+        }
+
+    private:
+        /// @brief Widens integral digests so @ref detail::fold_to_size picks the 64-bit overload.
+        static constexpr ::std::uint64_t digest(::std::unsigned_integral auto const d) noexcept
+        {
+            return d;
+        }
+        static constexpr uint128 digest(uint128 const d) noexcept { return d; }
+
+        State m_state;
+    };
+
+} // namespace scl::hash
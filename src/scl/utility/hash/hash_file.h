@@ -0,0 +1,265 @@
+#pragma once
+
+/// @file hash_file.h
+/// @brief Hashing of files without copying them into memory first.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/key.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <system_error>
+#include <vector>
+
+/**
+ * @def SCL_HASH_FILE_POSIX
+ * @brief `1` when `mmap` and `read(2)` are available to @ref scl::hash::hash_file.
+ * @ingroup scl_utility_hash
+ */
+#if __has_include(<sys/mman.h>) && __has_include(<sys/stat.h>) && __has_include(<fcntl.h>) \
+    && __has_include(<unistd.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SCL_HASH_FILE_POSIX 1
+#else
+#include <fstream>
+#define SCL_HASH_FILE_POSIX 0
+#endif
+
+namespace scl::hash
+{
+    /// @brief Block size of the read loop used for files that cannot be mapped: 1 MiB.
+    /// @ingroup scl_utility_hash
+    inline constexpr ::std::size_t hash_file_block_size = ::std::size_t{1} << 20;
+
+    namespace detail
+    {
+        /// @brief Hands the contents of the file at @p path to one of two callbacks.
+        ///
+        /// A non-empty regular file is mapped read-only with `MADV_SEQUENTIAL`
+        /// and passed to @p whole once. Anything else — pipes, character
+        /// devices, procfs files that report size 0, or a failed `mmap` — is
+        /// read with `read(2)` in @ref hash_file_block_size blocks, each passed
+        /// to @p block in order. Without POSIX the file is always read in blocks.
+        ///
+        /// @return `true` if @p whole was called. On failure @p ec is set and
+        ///         the callbacks may have seen part of the file.
+        template <typename Whole, typename Block>
+        bool visit_file(::std::filesystem::path const & path,
+            Whole && whole,
+            Block && block,
+            ::std::error_code & ec)
+        {
+            ec.clear();
+#if SCL_HASH_FILE_POSIX
+            auto const last_error = [] {
+                return ::std::error_code{errno, ::std::generic_category()};
+            };
+
+            int fd;
+            do
+                fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            while (fd < 0 && errno == EINTR);
+            if (fd < 0)
+            {
+                ec = last_error();
+                return false;
+            }
+            struct closer
+            {
+                int fd;
+                ~closer() { ::close(fd); }
+            } const guard{fd};
+
+            struct ::stat st;
+            if (::fstat(fd, &st) != 0)
+            {
+                ec = last_error();
+                return false;
+            }
+
+            if (S_ISREG(st.st_mode) && st.st_size > 0
+                && static_cast<::std::uintmax_t>(st.st_size) <= SIZE_MAX)
+            {
+                auto const size = static_cast<::std::size_t>(st.st_size);
+                void * const map = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (map != MAP_FAILED)
+                {
+                    struct unmapper
+                    {
+                        void * map;
+                        ::std::size_t size;
+                        ~unmapper() { ::munmap(map, size); }
+                    } const unmap{map, size};
+#ifdef MADV_SEQUENTIAL
+                    ::madvise(map, size, MADV_SEQUENTIAL);
+#endif
+                    whole(::std::span<unsigned char const>{
+                        static_cast<unsigned char const *>(map), size});
+                    return true;
+                }
+            }
+
+            ::std::vector<unsigned char> buffer(hash_file_block_size);
+            for (;;)
+            {
+                ::ssize_t const n = ::read(fd, buffer.data(), buffer.size());
+                if (n < 0 && errno == EINTR)
+                    continue;
+                if (n < 0)
+                {
+                    ec = last_error();
+                    return false;
+                }
+                if (n == 0)
+                    return false;
+                block(::std::span<unsigned char const>{
+                    buffer.data(), static_cast<::std::size_t>(n)});
+            }
+#else
+            ::std::ifstream in{path, ::std::ios::binary};
+            if (!in)
+            {
+                ec = ::std::make_error_code(::std::errc::no_such_file_or_directory);
+                return false;
+            }
+            ::std::vector<unsigned char> buffer(hash_file_block_size);
+            while (in)
+            {
+                in.read(reinterpret_cast<char *>(buffer.data()),
+                    static_cast<::std::streamsize>(buffer.size()));
+                auto const n = static_cast<::std::size_t>(in.gcount());
+                if (n != 0)
+                    block(::std::span<unsigned char const>{buffer.data(), n});
+            }
+            if (!in.eof())
+                ec = ::std::make_error_code(::std::errc::io_error);
+            return false;
+#endif
+        }
+    } // namespace detail
+
+    /// @brief Appends the contents of the file at @p path to a streaming state.
+    /// @ingroup scl_utility_hash
+    ///
+    /// The file is memory-mapped when possible and read in large blocks
+    /// otherwise (see @ref hash_file); no copy of the whole file is made.
+    /// Several files may be fed into one state to hash their concatenation.
+    ///
+    /// @param  state  Any streaming state, e.g. `fnv1a_state` or `Hasher{}.make_state()`.
+    /// @param  path   File to read.
+    /// @param  ec     Cleared on success; set to the OS error otherwise. On
+    ///                error @p state may already hold part of the file.
+    /// @return @p state.
+    ///
+    /// @code
+    /// auto state = scl::hash::xxh3_hasher<>{}.make_state();
+    /// std::error_code ec;
+    /// for (auto const & part : parts)
+    ///     scl::hash::update_file(state, part, ec);
+    /// auto const digest = state.finalize();
+    /// @endcode
+    template <typename State>
+    State & update_file(State & state, ::std::filesystem::path const & path, ::std::error_code & ec)
+        requires requires(::std::span<unsigned char const> bytes) { state.update(bytes); }
+    {
+        auto const feed = [&](::std::span<unsigned char const> const bytes) {
+            state.update(bytes);
+        };
+        detail::visit_file(path, feed, feed, ec);
+        return state;
+    }
+
+    /// @brief Throwing overload of @ref update_file.
+    /// @ingroup scl_utility_hash
+    ///
+    /// @throws std::filesystem::filesystem_error if the file cannot be opened or read.
+    template <typename State>
+    State & update_file(State & state, ::std::filesystem::path const & path)
+        requires requires(::std::span<unsigned char const> bytes) { state.update(bytes); }
+    {
+        ::std::error_code ec;
+        scl::hash::update_file(state, path, ec);
+        if (ec)
+            throw ::std::filesystem::filesystem_error{"scl::hash::update_file", path, ec};
+        return state;
+    }
+
+    /// @brief Hashes the contents of the file at @p path with `Hasher`.
+    /// @ingroup scl_utility_hash
+    ///
+    /// The digest equals `Hasher{}(bytes)` over the file's bytes in memory.
+    ///
+    /// - A non-empty regular file is memory-mapped read-only with
+    ///   `MADV_SEQUENTIAL` and hashed in place by the one-shot hasher, so the
+    ///   kernel's page cache is read once and nothing is copied.
+    /// - Files that cannot be mapped — pipes, character devices, procfs files
+    ///   reporting size 0, or when `mmap` fails — are read with `read(2)` in
+    ///   @ref hash_file_block_size blocks through `Hasher::state_type`. Hashers
+    ///   without a streaming state (e.g. @ref rapidhash_hasher) collect such a
+    ///   file in memory first.
+    /// - Without POSIX the file is always read in blocks.
+    ///
+    /// A mapped file that is truncated by another process while it is being
+    /// hashed raises `SIGBUS`, as with any memory-mapped read.
+    ///
+    /// @tparam Hasher  A @ref concepts::byte_hasher.
+    /// @param  path    File to hash.
+    /// @param  ec      Cleared on success; set to the OS error otherwise, in
+    ///                 which case the result is unspecified.
+    /// @return Digest of the file's contents.
+    ///
+    /// @code
+    /// std::error_code ec;
+    /// auto const id = scl::hash::hash_file<scl::hash::xxh3_128_hasher<>>("blob.bin", ec);
+    /// @endcode
+    template <concepts::byte_hasher Hasher>
+    typename Hasher::result_type hash_file(
+        ::std::filesystem::path const & path, ::std::error_code & ec)
+    {
+        typename Hasher::result_type digest{};
+        auto const whole = [&](::std::span<unsigned char const> const bytes) {
+            digest = Hasher{}(bytes);
+        };
+
+        if constexpr (requires { typename Hasher::state_type; })
+        {
+            auto state = Hasher{}.make_state();
+            auto const block = [&](::std::span<unsigned char const> const bytes) {
+                state.update(bytes);
+            };
+            if (!detail::visit_file(path, whole, block, ec))
+                digest = state.finalize();
+        }
+        else
+        {
+            ::std::vector<unsigned char> contents;
+            auto const block = [&](::std::span<unsigned char const> const bytes) {
+                contents.insert(contents.end(), bytes.begin(), bytes.end());
+            };
+            if (!detail::visit_file(path, whole, block, ec))
+                digest = Hasher{}(contents);
+        }
+        return digest;
+    }
+
+    /// @brief Throwing overload of @ref hash_file.
+    /// @ingroup scl_utility_hash
+    ///
+    /// @throws std::filesystem::filesystem_error if the file cannot be opened or read.
+    template <concepts::byte_hasher Hasher>
+    typename Hasher::result_type hash_file(::std::filesystem::path const & path)
+    {
+        ::std::error_code ec;
+        auto const digest = scl::hash::hash_file<Hasher>(path, ec);
+        if (ec)
+            throw ::std::filesystem::filesystem_error{"scl::hash::hash_file", path, ec};
+        return digest;
+    }
+
+} // namespace scl::hash
@@ -0,0 +1,192 @@
+#pragma once
+
+/// @file hashed_string.h
+/// @brief Compact string handle with an inline prefix and a cached @ref scl::hash::key digest.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/key.h>
+#include <scl/utility/hash/transparent.h>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+namespace scl::hash
+{
+    /// @brief Umbra-style string handle: length, 4-byte prefix, inline tail or pointer, and a cached @ref key.
+    /// @ingroup scl_utility_hash
+    ///
+    /// The first 16 bytes hold the string in the layout of Umbra's German
+    /// strings: a 32-bit length, then the first four bytes, then either
+    /// the next eight bytes — strings of up to 12 bytes are stored whole,
+    /// zero-padded — or a pointer to all the bytes. The @ref key digest
+    /// follows, computed once on construction, so the handle is 24 bytes for
+    /// a 64-bit hasher.
+    ///
+    /// Equality compares the length and prefix as one 8-byte word, then the
+    /// digests, and only then the bytes: the inline tail as a second word,
+    /// or `memcmp` on the bytes after the prefix. Unequal strings are almost
+    /// always rejected before `memcmp`; equal long strings pay for one.
+    /// `std::hash` returns the hash of the cached digest and never reads the
+    /// bytes, so re-hashing a string in a join or group-by costs nothing.
+    ///
+    /// Like `std::string_view`, a handle to a string longer than
+    /// @ref max_inline bytes does not own it: the bytes must outlive the
+    /// handle — e.g. in an arena, a column buffer or an @ref intern_pool.
+    /// It satisfies @ref concepts::keyed_text, so @ref transparent_hash
+    /// reuses its digest.
+    ///
+    /// @code
+    /// std::vector<scl::hash::hashed_string<scl::hash::xxh3_hasher<>>> column;
+    /// for (std::string_view const v : input)
+    ///     column.emplace_back(v);                        // hashed once
+    /// std::unordered_map<scl::hash::hashed_string<scl::hash::xxh3_hasher<>>, std::size_t> groups;
+    /// for (auto const & s : column)
+    ///     ++groups[s];                                   // no re-hash, short-circuit compares
+    /// @endcode
+    ///
+    /// @tparam Hasher  A @ref concepts::byte_hasher. Defaults to `siphash_hasher<>`, as @ref key does.
+    template <concepts::byte_hasher Hasher = siphash_hasher<>>
+    struct hashed_string
+    {
+        using key_type = ::scl::hash::key<Hasher>;
+        using size_type = ::std::uint32_t;
+
+        /// @brief Strings up to this length are stored inside the handle.
+        static constexpr ::std::size_t max_inline = 12;
+
+        /// @brief Number of leading bytes kept inline for long strings.
+        static constexpr ::std::size_t prefix_size = 4;
+
+        /// @brief The empty string.
+        hashed_string() noexcept
+            : hashed_string{::std::string_view{}}
+        {}
+
+        /// @brief Hashes @p text; a text longer than @ref max_inline must outlive the handle.
+        explicit hashed_string(::std::string_view const text) noexcept
+            : hashed_string{key_type{text}, text}
+        {}
+
+        /// @brief Pairs @p text with its already computed digest @p k; `k` must equal `key_type{text}`.
+        hashed_string(key_type const k, ::std::string_view const text) noexcept
+            : m_key{k}
+        {
+            assert(text.size() <= ::std::numeric_limits<size_type>::max());
+            m_size = static_cast<size_type>(text.size());
+            if (text.size() <= max_inline)
+            {
+                if (!text.empty())
+                    ::std::memcpy(m_bytes, text.data(), text.size());
+            }
+            else
+            {
+                ::std::memcpy(m_bytes, text.data(), prefix_size);
+                auto const * const p = text.data();
+                ::std::memcpy(m_bytes + prefix_size, &p, sizeof(p));
+            }
+        }
+
+        /// @brief Takes the text and digest of @p text, e.g. an @ref interned handle or a @ref key_view.
+        template <concepts::keyed_text T>
+            requires ::std::same_as<detail::text_key_t<T>, key_type>
+        explicit hashed_string(T const & text) noexcept
+            : hashed_string{text.key(), ::std::string_view{text.view()}}
+        {}
+
+        /// @brief The digest computed on construction.
+        key_type key() const noexcept { return m_key; }
+
+        ::std::size_t size() const noexcept { return m_size; }
+        bool empty() const noexcept { return m_size == 0; }
+
+        /// @brief Whether the whole string is stored inside the handle.
+        bool is_inline() const noexcept { return m_size <= max_inline; }
+
+        /// @brief The bytes: inside the handle for short strings, else the referenced storage.
+        char const * data() const noexcept { return is_inline() ? m_bytes : pointer(); }
+
+        ::std::string_view view() const noexcept { return {data(), m_size}; }
+
+        /// @brief The first `min(size(), 4)` bytes, read without following the pointer.
+        ::std::string_view prefix() const noexcept
+        {
+            return {m_bytes, m_size < prefix_size ? m_size : prefix_size};
+        }
+
+        explicit operator ::std::string_view() const noexcept { return view(); }
+
+        /// @brief Length and prefix, then digest, then the remaining bytes.
+        friend bool operator==(hashed_string const & a, hashed_string const & b) noexcept
+        {
+            if (a.head() != b.head() || a.m_key != b.m_key)
+                return false;
+            if (a.is_inline())
+                return a.tail() == b.tail();
+            auto const * const pa = a.pointer();
+            auto const * const pb = b.pointer();
+            return pa == pb
+                || ::std::memcmp(pa + prefix_size, pb + prefix_size, a.m_size - prefix_size) == 0;
+        }
+
+        /// @brief Length, then prefix, then the remaining bytes; no hashing.
+        friend bool operator==(hashed_string const & a, ::std::string_view const b) noexcept
+        {
+            if (a.m_size != b.size())
+                return false;
+            if (b.empty())
+                return true;
+            auto const p = a.prefix();
+            if (::std::memcmp(p.data(), b.data(), p.size()) != 0)
+                return false;
+            return a.view().substr(p.size()) == b.substr(p.size());
+        }
+
+    private:
+        /// @brief Length and prefix as one word.
+        ::std::uint64_t head() const noexcept
+        {
+            ::std::uint32_t p;
+            ::std::memcpy(&p, m_bytes, sizeof(p));
+            return ::std::uint64_t{m_size} << 32 | p;
+        }
+
+        /// @brief Inline bytes 4..11, or the pointer bytes.
+        ::std::uint64_t tail() const noexcept
+        {
+            ::std::uint64_t t;
+            ::std::memcpy(&t, m_bytes + prefix_size, sizeof(t));
+            return t;
+        }
+
+        char const * pointer() const noexcept
+        {
+            char const * p;
+            ::std::memcpy(&p, m_bytes + prefix_size, sizeof(p));
+            return p;
+        }
+
+        size_type m_size = 0;
+        char m_bytes[max_inline]{};
+        key_type m_key;
+    };
+
+    static_assert(sizeof(hashed_string<>) == 24);
+
+} // namespace scl::hash
+
+/// @brief `std::hash` of an @ref scl::hash::hashed_string: the hash of its cached key; the bytes are not read.
+/// @ingroup scl_utility_hash
+template <typename Hasher>
+struct std::hash<::scl::hash::hashed_string<Hasher>>
+{
+    ::std::size_t operator()(::scl::hash::hashed_string<Hasher> const & s) const noexcept
+    {
+        return ::std::hash<::scl::hash::key<Hasher>>{}(s.key());
+    }
+};
@@ -0,0 +1,285 @@
+#pragma once
+
+/// @file intern_pool.h
+/// @brief Thread-safe string interning: each distinct string stored once, addressed by its @ref scl::hash::key.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/key.h>
+#include <scl/utility/hash/key_map.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace scl::hash
+{
+    template <concepts::byte_hasher Hasher>
+    struct intern_pool;
+
+    namespace detail
+    {
+        /// @brief Header of an interned string in the arena; the bytes and a NUL follow it.
+        template <typename Key>
+        struct intern_record
+        {
+            Key key;
+            ::std::size_t size;
+
+            char const * data() const noexcept { return reinterpret_cast<char const *>(this + 1); }
+        };
+    } // namespace detail
+
+    /// @brief Handle to a string interned in an @ref intern_pool: one pointer, O(1) key and text.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Handles from the same pool are equal exactly when their strings are.
+    /// A handle stays valid as long as its pool; a default-constructed one
+    /// is null and only `operator bool` and comparison may be used on it.
+    ///
+    /// @tparam Hasher  The pool's @ref concepts::byte_hasher.
+    template <concepts::byte_hasher Hasher = siphash_hasher<>>
+    struct interned
+    {
+        using key_type = ::scl::hash::key<Hasher>;
+
+        constexpr interned() noexcept = default;
+
+        /// @brief The digest of the string, computed once when it was interned.
+        key_type key() const noexcept { return m_record->key; }
+
+        /// @brief The interned bytes, stored in the pool's arena.
+        ::std::string_view view() const noexcept { return {m_record->data(), m_record->size}; }
+
+        /// @brief The interned bytes, NUL-terminated.
+        char const * c_str() const noexcept { return m_record->data(); }
+
+        ::std::size_t size() const noexcept { return m_record->size; }
+
+        operator ::std::string_view() const noexcept { return view(); }
+
+        explicit constexpr operator bool() const noexcept { return m_record != nullptr; }
+
+        friend constexpr bool operator==(interned const &, interned const &) noexcept = default;
+
+    private:
+        friend intern_pool<Hasher>;
+
+        using record = detail::intern_record<key_type>;
+
+        constexpr explicit interned(record const * const r) noexcept
+            : m_record{r}
+        {}
+
+        record const * m_record = nullptr;
+    };
+
+    /// @brief Concurrent string interning pool mapping each distinct string to a @ref key and a stable `string_view`.
+    /// @ingroup scl_utility_hash
+    ///
+    /// @ref intern hashes the string once with @p Hasher and returns an
+    /// @ref interned handle — a single pointer to an arena record holding
+    /// the digest, the length and the bytes. Interning the same string again
+    /// returns the same handle, so repeated labels share one copy.
+    ///
+    /// The bytes go into 64 KiB arena chunks with no allocation per string;
+    /// they never move, so every `string_view` stays valid for the pool's
+    /// lifetime. The index from @ref key to record is split into 64 shards,
+    /// each a @ref key_map with its own arena behind its own mutex, chosen
+    /// by digest bits that the shard's table does not use. The string is
+    /// hashed before any lock is taken, and the lock covers one table probe
+    /// — plus one copy on first occurrence — so threads seldom wait for
+    /// each other. A reader-writer lock would not help here: taking it
+    /// shared still writes to the lock's cache line.
+    ///
+    /// Per string the pool needs the bytes plus a terminating NUL, a header
+    /// of `sizeof(key_type) + 8` bytes, rounded up to 8, and one index slot
+    /// of `sizeof(key_type) + 8` bytes at a load factor of 7/16 to 7/8.
+    /// `std::unordered_set<std::string>` needs a node of about 48 bytes, a
+    /// bucket pointer and, for every string longer than the short-string
+    /// buffer, a second heap block — each with allocator overhead.
+    ///
+    /// Two different strings with the same digest cannot be told apart by
+    /// key; @ref intern throws `std::invalid_argument` when it meets one.
+    /// Across 10^6 distinct strings this happens with probability about
+    /// 3·10^-8 for a 64-bit hasher; use a 128-bit hasher such as
+    /// `xxh3_128_hasher<>` to rule it out in practice.
+    ///
+    /// @code
+    /// scl::hash::intern_pool<> labels;
+    /// auto const h = labels.intern(column_name);     // from any thread
+    /// counters[h.key()] += 1;                        // O(1) digest
+    /// std::cout << h.view();                         // O(1) text, no copy
+    /// @endcode
+    ///
+    /// @tparam Hasher  A @ref concepts::byte_hasher. Defaults to `siphash_hasher<>`, as @ref key does.
+    template <concepts::byte_hasher Hasher = siphash_hasher<>>
+    struct intern_pool
+    {
+        using key_type = key<Hasher>;
+        using handle = interned<Hasher>;
+        using size_type = ::std::size_t;
+
+        /// @brief Number of independently locked shards of the index.
+        static constexpr size_type shard_count = 64;
+
+        /// @brief Size of an arena chunk; longer strings get a block of their own.
+        static constexpr size_type chunk_size = size_type{64} << 10;
+
+        intern_pool() = default;
+        intern_pool(intern_pool const &) = delete;
+        intern_pool & operator=(intern_pool const &) = delete;
+
+        /// @brief Returns the handle of @p text, storing a copy on first occurrence.
+        /// @throws std::invalid_argument if a different string with the same digest is already interned.
+        handle intern(::std::string_view const text)
+        {
+            key_type const k{text};
+            auto & s = shard_of(k);
+            ::std::lock_guard const lock{s.mutex};
+            auto const [it, inserted] = s.index.try_emplace(k, nullptr);
+            if (!inserted)
+                return checked(it->second, text);
+            try
+            {
+                it->second = s.store(k, text);
+            }
+            catch (...)
+            {
+                s.index.erase(k);
+                throw;
+            }
+            return handle{it->second};
+        }
+
+        /// @brief Returns the handle of @p text if it is interned, else a null handle.
+        handle find(::std::string_view const text) const
+        {
+            auto const h = find(key_type{text});
+            return h && h.view() == text ? h : handle{};
+        }
+
+        /// @brief Returns the handle of the string with digest @p k if one is interned, else a null handle.
+        handle find(key_type const k) const
+        {
+            auto const & s = shard_of(k);
+            ::std::lock_guard const lock{s.mutex};
+            auto const it = s.index.find(k);
+            return it == s.index.end() ? handle{} : handle{it->second};
+        }
+
+        /// @brief Number of distinct strings interned.
+        size_type size() const
+        {
+            size_type n = 0;
+            for (auto const & s : m_shards)
+            {
+                ::std::lock_guard const lock{s.mutex};
+                n += s.index.size();
+            }
+            return n;
+        }
+
+        /// @brief Bytes held by the arena: string bytes, record headers and unused chunk tails.
+        size_type arena_bytes() const
+        {
+            size_type n = 0;
+            for (auto const & s : m_shards)
+            {
+                ::std::lock_guard const lock{s.mutex};
+                n += s.arena_bytes;
+            }
+            return n;
+        }
+
+    private:
+        using record = detail::intern_record<key_type>;
+
+        static constexpr size_type record_align = alignof(record);
+
+        /// @brief One slice of the index, with the arena its strings are stored in.
+        struct alignas(64) shard
+        {
+            mutable ::std::mutex mutex;
+            key_map<record const *, Hasher> index;
+            ::std::vector<::std::unique_ptr<::std::byte[]>> chunks;
+            ::std::byte * cursor = nullptr;
+            size_type left = 0;
+            size_type arena_bytes = 0;
+
+            /// @brief Copies @p text into the arena behind a header for @p k.
+            record const * store(key_type const k, ::std::string_view const text)
+            {
+                // Header, bytes and NUL, rounded up to a multiple of record_align.
+                auto const bytes =
+                    (sizeof(record) + text.size() + record_align) / record_align * record_align;
+                ::std::byte * p;
+                if (bytes > chunk_size / 4)
+                {
+                    chunks.push_back(::std::make_unique_for_overwrite<::std::byte[]>(bytes));
+                    p = chunks.back().get();
+                    arena_bytes += bytes;
+                }
+                else
+                {
+                    if (bytes > left)
+                    {
+                        chunks.push_back(
+                            ::std::make_unique_for_overwrite<::std::byte[]>(chunk_size));
+                        cursor = chunks.back().get();
+                        left = chunk_size;
+                        arena_bytes += chunk_size;
+                    }
+                    p = cursor;
+                    cursor += bytes;
+                    left -= bytes;
+                }
+                auto * const r = ::new (p) record{k, text.size()};
+                auto * const data = reinterpret_cast<char *>(r + 1);
+                if (!text.empty())
+                    ::std::memcpy(data, text.data(), text.size());
+                data[text.size()] = '\0';
+                return r;
+            }
+        };
+
+        /// @brief Shard of @p k: bits 51..56 of the mixed digest, which @ref key_map uses for neither group nor tag.
+        shard & shard_of(key_type const k) noexcept
+        {
+            using mixer = typename detail::key_mixer<Hasher>::type;
+            return m_shards[(mixer{}(detail::digest_word(k.value)) >> 51) % shard_count];
+        }
+
+        shard const & shard_of(key_type const k) const noexcept
+        {
+            return const_cast<intern_pool &>(*this).shard_of(k);
+        }
+
+        static handle checked(record const * const r, ::std::string_view const text)
+        {
+            if (::std::string_view{r->data(), r->size} != text)
+                throw ::std::invalid_argument{"scl::hash::intern_pool::intern: digest collision"};
+            return handle{r};
+        }
+
+        shard m_shards[shard_count];
+    };
+
+} // namespace scl::hash
+
+/// @brief `std::hash` of an @ref scl::hash::interned handle: the hash of its key.
+/// @ingroup scl_utility_hash
+template <typename Hasher>
+struct std::hash<::scl::hash::interned<Hasher>>
+{
+    ::std::size_t operator()(::scl::hash::interned<Hasher> const & h) const noexcept
+    {
+        return ::std::hash<::scl::hash::key<Hasher>>{}(h.key());
+    }
+};
@@ -4,6 +4,8 @@
 /// @brief Jenkins one-at-a-time (OTA) hash algorithm, 32-bit.
 /// @ingroup scl_utility_hash
 
+#include <scl/utility/hash/mix.h>
+
 #include <concepts>
 #include <cstdint>
 #include <ranges>
@@ -11,6 +13,53 @@
 
 namespace scl::hash
 {
+    /// @brief Incremental Jenkins OAT state for hashing a message split into several ranges.
+    /// @ingroup scl_utility_hash
+    ///
+    /// The per-byte mixing step is accumulated by @ref update; the
+    /// finalization avalanche is applied by @ref finalize to a copy of the
+    /// accumulator, so more bytes may still be appended afterwards. The digest
+    /// equals @ref jenkins_ota over the concatenated bytes, however the message
+    /// is split:
+    /// @code
+    /// constexpr auto h = scl::hash::jenkins_ota_state{}
+    ///     .update(std::string_view{"foo"})
+    ///     .update(std::string_view{"bar"})
+    ///     .finalize();
+    /// static_assert(h == scl::hash::jenkins_ota(std::string_view{"foobar"}));
+    /// @endcode
+    struct jenkins_ota_state
+    {
+        using result_type = ::std::uint32_t;
+
+        /// @brief Appends @p range to the message.
+        template <::std::ranges::input_range Range>
+        constexpr jenkins_ota_state & update(Range && range) noexcept
+            requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+        {
+            for (auto const c : range)
+            {
+                m_h += static_cast<::std::uint8_t>(c);
+                m_h += m_h << 10;
+                m_h ^= m_h >> 6;
+            }
+            return *this;
+        }
+
+        /// @brief Returns the digest of all bytes appended so far.
+        constexpr result_type finalize() const noexcept
+        {
+            ::std::uint32_t h = m_h;
+            h += h << 3;
+            h ^= h >> 11;
+            h += h << 15;
+            return h;
+        }
+
+    private:
+        ::std::uint32_t m_h{};
+    };
+
     /// @brief Computes a Jenkins one-at-a-time (OTA) 32-bit hash.
     /// @ingroup scl_utility_hash
     ///
@@ -36,7 +85,7 @@ namespace scl::hash
     ///
     /// The function is `constexpr`, allowing compile-time hash computation.
     ///
-    /// @tparam Range  Any type satisfying `std::ranges::range` whose elements
+    /// @tparam Range  Any type satisfying `std::ranges::input_range` whose elements
     ///                are convertible to `std::uint8_t` — e.g. a string literal,
     ///                `std::string_view`, `std::string`, `std::span<std::byte>`.
     /// @param  range  Input range to hash.
@@ -49,24 +98,11 @@ namespace scl::hash
     /// constexpr auto h = scl::hash::jenkins_ota("hello");
     /// static_assert(h != 0);
     /// @endcode
-    template <::std::ranges::range Range>
-    constexpr ::std::uint32_t jenkins_ota(Range const & range)
+    template <::std::ranges::input_range Range>
+    constexpr ::std::uint32_t jenkins_ota(Range && range)
         requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
     {
-        ::std::uint32_t h = 0;
-
-        for (auto const c : range)
-        {
-            h += static_cast<::std::uint8_t>(c);
-            h += h << 10;
-            h ^= h >> 6;
-        }
-
-        h += h << 3;
-        h ^= h >> 11;
-        h += h << 15;
-
-        return h;
+        return jenkins_ota_state{}.update(range).finalize();
     }
 
     /// @brief Callable wrapper around @ref jenkins_ota for use with @ref scl::hash::key.
@@ -75,13 +111,19 @@ namespace scl::hash
     struct jenkins_ota_hasher
     {
         using result_type = ::std::uint32_t;
+        using state_type = jenkins_ota_state;
+        /// @brief Mixer applied by `std::hash<key<...>>`: spreads the 32-bit digest over all 64 bits.
+        using mixer = fmix64_mixer;
 
-        template <::std::ranges::range Range>
-        constexpr result_type operator()(Range const & range) const noexcept
+        template <::std::ranges::input_range Range>
+        constexpr result_type operator()(Range && range) const noexcept
             requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
         {
             return ::scl::hash::jenkins_ota(range);
         }
+
+        /// @brief Returns a fresh streaming state producing the same digests.
+        constexpr state_type make_state() const noexcept { return state_type{}; }
     };
 
 } // namespace scl::hash
@@ -4,25 +4,43 @@
 /// @brief Strongly-typed hash digest parameterized by a hash function.
 /// @ingroup scl_utility_hash
 
+#include <scl/utility/hash/mix.h>
 #include <scl/utility/hash/siphash.h>
+#include <scl/utility/hash/uint128.h>
 
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <type_traits>
 #include <utility>
 
 namespace scl::hash::concepts
 {
+    /// @brief Concept satisfied by the digest types a hasher may produce: an
+    ///        integral type of at most 64 bits or @ref scl::hash::uint128.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Both are structural types, so a @ref scl::hash::key holding either
+    /// remains usable as a non-type template parameter.
+    // clang-format off
+    template <typename T>
+    concept digest = (::std::integral<T> && sizeof(T) <= sizeof(::std::uint64_t))
+            || ::std::same_as<T, uint128>;
+    // clang-format on
+
     /// @brief Concept satisfied by any default-constructible callable that maps
-    ///        a byte range to an integral digest and exposes a `result_type` typedef.
+    ///        a byte range to a @ref digest and exposes a `result_type` typedef.
     /// @ingroup scl_utility_hash
     ///
-    /// Used to constrain the `Hasher` parameter of @ref scl::hash::key.
+    /// Used to constrain the `Hasher` parameter of @ref scl::hash::key. A
+    /// hasher may also declare `using mixer = M;` with a @ref mixer that
+    /// `std::hash<key<Hasher>>` applies to the digest.
     // clang-format off
     template <typename H>
     concept byte_hasher = ::std::default_initializable<H>
             && requires { typename H::result_type; }
-            && ::std::integral<typename H::result_type>;
+            && digest<typename H::result_type>;
     // clang-format on
 } // namespace scl::hash::concepts
 
@@ -41,18 +59,31 @@ namespace scl::hash
     /// | `djb2_hasher`         | `std::uint64_t`     |
     /// | `sdbm_hasher`         | `std::uint64_t`     |
     /// | `siphash_hasher<Key>` | `std::uint64_t`     |
+    /// | `siphash13_hasher<Key>` | `std::uint64_t`   |
+    /// | `halfsiphash_hasher<Key>` | `std::uint32_t` |
+    /// | `xxh64_hasher<Seed>`  | `std::uint64_t`     |
+    /// | `xxh3_hasher<Seed>`   | `std::uint64_t`     |
+    /// | `rapidhash_hasher<Seed>` | `std::uint64_t`  |
     /// | `jenkins_ota_hasher`  | `std::uint32_t`     |
+    /// | `crc32c_hasher`       | `std::uint32_t`     |
+    /// | `siphash128_hasher<Key>` | `uint128`        |
+    /// | `xxh3_128_hasher<Seed>` | `uint128`         |
+    /// | `murmur3_x64_128_hasher<Seed>` | `uint128`  |
     ///
     /// Key properties:
     /// - **`constexpr`** — digest computed at compile time.
     /// - **Comparable** — `==`, `!=`, `<`, `<=`, `>`, `>=` via defaulted `<=>`.
     /// - **`switch`/`case` label** — implicit conversion to `value_type` enables
-    ///   string-dispatching without `if`-`else` chains.
+    ///   string-dispatching without `if`-`else` chains (integral digests only).
     /// - **STL-compatible** — `std::hash<key<Hasher>>` is specialised for use in
     ///   `std::unordered_map` / `std::unordered_set`.
     ///
-    /// @tparam Hasher  A type satisfying @ref scl::hash::byte_hasher.
-    ///                 Defaults to `fnv1a_hasher`.
+    /// 128-bit hashers produce a @ref uint128 digest. Across 10^9 distinct
+    /// inputs the chance of any 64-bit collision is about 3%; with 128 bits
+    /// it is below 10^-20, so such keys can identify content on their own.
+    ///
+    /// @tparam Hasher  A type satisfying @ref scl::hash::concepts::byte_hasher.
+    ///                 Defaults to `siphash_hasher<>`.
     ///
     /// @par Compile-time example (default FNV-1a hasher)
     /// @code
@@ -68,6 +99,12 @@ namespace scl::hash
     /// constexpr sip_key id{"my_event"};
     /// @endcode
     ///
+    /// @par 128-bit content identifier
+    /// @code
+    /// using content_id = scl::hash::key<scl::hash::xxh3_128_hasher<>>;
+    /// std::unordered_map<content_id, blob_ref> store; // no collision check needed
+    /// @endcode
+    ///
     /// @par Switch/case dispatching
     /// @code
     /// int handle(scl::hash::key<> cmd) {
@@ -84,7 +121,7 @@ namespace scl::hash
         /// @brief The hasher type used to produce this digest.
         using hasher_type = Hasher;
 
-        /// @brief Underlying integer type — deduced from the hasher's `result_type`.
+        /// @brief Digest type — deduced from the hasher's `result_type`.
         using value_type = typename Hasher::result_type;
 
         /// @brief Raw digest value.
@@ -92,31 +129,90 @@ namespace scl::hash
 
         /// @brief Constructs the digest by hashing @p range with @p Hasher.
         ///
-        /// @tparam Range  Any type satisfying `std::ranges::range` whose elements
+        /// @tparam Range  Any type satisfying `std::ranges::input_range` whose elements
         ///                are convertible to `std::uint8_t`.
         /// @param  range  Input range (e.g. `std::string`, `std::span<std::byte>`).
-        template <::std::ranges::range Range>
-        explicit constexpr key(Range const & range) noexcept
+        template <::std::ranges::input_range Range>
+        explicit constexpr key(Range && range) noexcept
             requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
             : value{Hasher{}(range)}
         {}
 
-        /// @brief Implicit conversion to the raw integer digest.
+        /// @brief Implicit conversion to the raw digest.
         constexpr operator value_type() const noexcept { return value; }
 
         /// @brief Three-way comparison (generates ==, !=, <, <=, >, >=).
         friend constexpr auto operator<=>(key const &, key const &) noexcept = default;
     };
 
+    namespace detail
+    {
+        /// @brief Reduces a digest to one 64-bit word; 128-bit digests as in @ref fold_to_size.
+        template <concepts::digest Digest>
+        constexpr ::std::uint64_t digest_word(Digest const d) noexcept
+        {
+            if constexpr (::std::same_as<Digest, uint128>)
+                return d.lo + d.hi * 0x9e3779b97f4a7c15ull;
+            else
+                return static_cast<::std::uint64_t>(d);
+        }
+
+        /// @brief Mixer used by `std::hash<key<Hasher>>`: `Hasher::mixer` if declared, else @ref identity_mixer.
+        template <typename Hasher>
+        struct key_mixer
+        {
+            using type = identity_mixer;
+        };
+
+        template <typename Hasher>
+            requires concepts::mixer<typename Hasher::mixer>
+        struct key_mixer<Hasher>
+        {
+            using type = typename Hasher::mixer;
+        };
+    } // namespace detail
+
+    /// @brief `std::unordered_map`-compatible hash of a @ref key that passes its digest through @p Mixer.
+    /// @ingroup scl_utility_hash
+    ///
+    /// `std::hash<key<Hasher>>` already mixes the digests of hashers whose
+    /// low bits are weak (see there); `key_hash` picks the finalizer
+    /// explicitly — e.g. to mix even a strong digest before a table that
+    /// keeps only a few low bits, or to skip mixing for a trusted one:
+    /// @code
+    /// using name = scl::hash::key<scl::hash::fnv1a_hasher>;
+    /// std::unordered_map<name, int, scl::hash::key_hash<scl::hash::splitmix64_mixer>> index;
+    /// @endcode
+    ///
+    /// @tparam Mixer  A @ref concepts::mixer. Defaults to @ref fmix64_mixer.
+    template <concepts::mixer Mixer = fmix64_mixer>
+    struct key_hash
+    {
+        template <concepts::byte_hasher Hasher>
+        constexpr ::std::size_t operator()(key<Hasher> const & k) const noexcept
+        {
+            return detail::fold_to_size(Mixer{}(detail::digest_word(k.value)));
+        }
+    };
+
 } // namespace scl::hash
 
 /// @brief `std::hash` partial specialisation for all `scl::hash::key<Hasher>`.
 /// @ingroup scl_utility_hash
+///
+/// Equivalent to `scl::hash::key_hash<typename Hasher::mixer>` when the
+/// hasher declares a `mixer` — FNV-1a, djb2 and SDBM, whose low digest bits
+/// depend only on the low bits of the input, and the 32-bit Jenkins,
+/// CRC-32C and HalfSipHash digests, which leave the upper half of a 64-bit
+/// word empty — so power-of-two tables and @ref scl::hash::fast_range see
+/// well-mixed bits.
+/// Other digests are already uniformly distributed and are used directly.
+/// Digests wider than `std::size_t` are folded so that every bit contributes.
 template <typename Hasher>
 struct std::hash<::scl::hash::key<Hasher>>
 {
     constexpr ::std::size_t operator()(::scl::hash::key<Hasher> const & k) const noexcept
     {
-        return ::std::hash<typename ::scl::hash::key<Hasher>::value_type>{}(k.value);
+        return ::scl::hash::key_hash<typename ::scl::hash::detail::key_mixer<Hasher>::type>{}(k);
     }
 };
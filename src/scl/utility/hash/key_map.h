@@ -0,0 +1,196 @@
+#pragma once
+
+/// @file key_map.h
+/// @brief Flat hash map and set of @ref scl::hash::key values that use the digest as the hash.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/detail/key_table.h>
+#include <scl/utility/hash/key.h>
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace scl::hash
+{
+    namespace detail
+    {
+        template <typename Key, typename Value>
+        struct key_map_policy
+        {
+            using key_type = Key;
+            using slot_type = ::std::pair<Key const, Value>;
+
+            static Key const & key(slot_type const & slot) noexcept { return slot.first; }
+        };
+
+        template <typename Key>
+        struct key_set_policy
+        {
+            using key_type = Key;
+            using slot_type = Key;
+
+            static Key const & key(slot_type const & slot) noexcept { return slot; }
+        };
+    } // namespace detail
+
+    /// @brief Open-addressing hash map from @ref key to @p Value, hashed by the key's own digest.
+    /// @ingroup scl_utility_hash
+    ///
+    /// `std::unordered_map<key<>, V>` allocates a node per entry and follows
+    /// a bucket pointer and a node pointer on every lookup. `key_map` stores
+    /// entries inline in one slot array, with one control byte per slot in
+    /// groups of 15. A lookup takes the group index (H1) from the low bits
+    /// of the digest and a 7-bit tag (H2) from its top bits — no hashing,
+    /// only the `std::hash<key<Hasher>>` mixer for hashers that declare one.
+    /// It compares the tag against a whole group with one SSE2 instruction
+    /// (a scalar loop elsewhere) and then checks the few matching slots.
+    ///
+    /// Each group also counts the keys that probed past it while it was
+    /// full; a lookup stops at the first group whose count is zero. Erasing
+    /// decrements the counts on the erased key's path and empties the slot,
+    /// so there are no tombstones and no slow-down after many erasures.
+    ///
+    /// The table grows by doubling when 7/8 of the slots are in use.
+    /// Growth, @ref reserve and @ref rehash move the entries into two new
+    /// arrays — one for the control bytes, one for the slots — without an
+    /// allocation per entry and without re-hashing any string. Per entry,
+    /// the map needs `sizeof(value_type)` plus about 1.1 bytes, divided by
+    /// the load factor.
+    ///
+    /// @code
+    /// scl::hash::key_map<std::uint32_t> symbols;
+    /// symbols.reserve(50'000'000);
+    /// symbols[scl::hash::key<>{"main"}] = 1;
+    /// if (auto const it = symbols.find(scl::hash::key<>{name}); it != symbols.end())
+    ///     use(it->second);
+    /// @endcode
+    ///
+    /// Any insertion may move every entry and invalidates all iterators and
+    /// references; erasure invalidates only those to the erased entry.
+    /// Iteration order is unspecified.
+    ///
+    /// @tparam Value   Mapped type.
+    /// @tparam Hasher  A @ref concepts::byte_hasher. Defaults to `siphash_hasher<>`, as @ref key does.
+    template <typename Value, concepts::byte_hasher Hasher = siphash_hasher<>>
+    struct key_map : detail::key_table<detail::key_map_policy<key<Hasher>, Value>>
+    {
+    private:
+        using base = detail::key_table<detail::key_map_policy<key<Hasher>, Value>>;
+
+    public:
+        using key_type = key<Hasher>;
+        using mapped_type = Value;
+        using value_type = typename base::value_type;
+        using size_type = typename base::size_type;
+        using iterator = typename base::iterator;
+        using const_iterator = typename base::const_iterator;
+
+        key_map() noexcept = default;
+
+        /// @brief Creates an empty map with room for @p n entries.
+        explicit key_map(size_type const n) { this->reserve(n); }
+
+        key_map(::std::initializer_list<value_type> const entries)
+        {
+            this->reserve(entries.size());
+            for (auto const & e : entries)
+                insert(e);
+        }
+
+        /// @brief Inserts `{k, Value(args...)}` if @p k is absent; returns the entry and whether it was inserted.
+        template <typename... Args>
+        ::std::pair<iterator, bool> try_emplace(key_type const k, Args &&... args)
+        {
+            if (auto const index = this->locate(k); index != base::npos)
+                return {this->to_iterator(index), false};
+            auto const index = this->emplace_new(k, ::std::piecewise_construct,
+                ::std::forward_as_tuple(k), ::std::forward_as_tuple(::std::forward<Args>(args)...));
+            return {this->to_iterator(index), true};
+        }
+
+        /// @brief Inserts @p entry if its key is absent.
+        ::std::pair<iterator, bool> insert(value_type const & entry)
+        {
+            return try_emplace(entry.first, entry.second);
+        }
+
+        /// @brief Inserts or replaces the value of @p k.
+        template <typename V>
+        ::std::pair<iterator, bool> insert_or_assign(key_type const k, V && value)
+        {
+            auto result = try_emplace(k, ::std::forward<V>(value));
+            if (!result.second)
+                result.first->second = ::std::forward<V>(value);
+            return result;
+        }
+
+        /// @brief Returns the value of @p k, inserting a value-initialised one if absent.
+        mapped_type & operator[](key_type const k) { return try_emplace(k).first->second; }
+
+        /// @brief Returns the value of @p k; throws `std::out_of_range` if absent.
+        mapped_type & at(key_type const k)
+        {
+            auto const index = this->locate(k);
+            if (index == base::npos)
+                throw ::std::out_of_range{"scl::hash::key_map::at"};
+            return this->slot(index).second;
+        }
+
+        mapped_type const & at(key_type const k) const
+        {
+            return const_cast<key_map &>(*this).at(k);
+        }
+    };
+
+    /// @brief Open-addressing hash set of @ref key values; see @ref key_map.
+    /// @ingroup scl_utility_hash
+    ///
+    /// @code
+    /// scl::hash::key_set<> seen;
+    /// if (seen.insert(scl::hash::key<>{url}).second)
+    ///     crawl(url);
+    /// @endcode
+    template <concepts::byte_hasher Hasher = siphash_hasher<>>
+    struct key_set : detail::key_table<detail::key_set_policy<key<Hasher>>>
+    {
+    private:
+        using base = detail::key_table<detail::key_set_policy<key<Hasher>>>;
+
+    public:
+        using key_type = key<Hasher>;
+        using value_type = key_type;
+        using size_type = typename base::size_type;
+        /// @brief Keys are immutable: both iterator types are constant.
+        using iterator = typename base::const_iterator;
+        using const_iterator = typename base::const_iterator;
+
+        key_set() noexcept = default;
+
+        /// @brief Creates an empty set with room for @p n keys.
+        explicit key_set(size_type const n) { this->reserve(n); }
+
+        key_set(::std::initializer_list<key_type> const keys)
+        {
+            this->reserve(keys.size());
+            for (auto const k : keys)
+                insert(k);
+        }
+
+        const_iterator begin() const noexcept { return base::begin(); }
+        const_iterator end() const noexcept { return base::end(); }
+
+        const_iterator find(key_type const k) const noexcept { return base::find(k); }
+
+        /// @brief Inserts @p k if absent; returns its position and whether it was inserted.
+        ::std::pair<const_iterator, bool> insert(key_type const k)
+        {
+            if (auto const index = this->locate(k); index != base::npos)
+                return {this->to_iterator(index), false};
+            return {this->to_iterator(this->emplace_new(k, k)), true};
+        }
+    };
+
+} // namespace scl::hash
@@ -0,0 +1,316 @@
+#pragma once
+
+/// @file key_registry.h
+/// @brief Per-domain registration of literal @ref scl::hash::key values with compile-time collision checks.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/fnv1a.h>
+#include <scl/utility/hash/key.h>
+#include <scl/utility/meta/type.h>
+#include <scl/utility/preprocessor/counter.h>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * @def SCL_HASH_KEY_SECTION
+ * @brief Define to `1` before including this header to also record every
+ *        @ref SCL_KEY_REGISTER in the `scl_keys` linker section.
+ * @ingroup scl_utility_hash
+ *
+ * Only ELF targets built with GCC or Clang support the section; elsewhere
+ * the macro is forced to `0`. @ref scl::hash::key_section_collisions scans
+ * the section of the linked program, across translation units.
+ */
+#if !defined(SCL_HASH_KEY_SECTION)
+#define SCL_HASH_KEY_SECTION 0
+#endif
+
+/**
+ * @def SCL_HASH_KEY_SECTION_SUPPORTED
+ * @brief `1` when the `scl_keys` section and its `__start_`/`__stop_` bounds are available.
+ * @ingroup scl_utility_hash
+ */
+#if defined(__ELF__) && (defined(__GNUC__) || defined(__clang__))
+#define SCL_HASH_KEY_SECTION_SUPPORTED 1
+#else
+#define SCL_HASH_KEY_SECTION_SUPPORTED 0
+#undef SCL_HASH_KEY_SECTION
+#define SCL_HASH_KEY_SECTION 0
+#endif
+
+namespace scl::hash
+{
+    /// @brief Base of a key domain: a set of literal keys checked for collisions together.
+    /// @ingroup scl_utility_hash
+    ///
+    /// A domain is a namespace-scope type deriving from `key_domain`; its
+    /// keys are `key<Hasher>`.
+    /// @code
+    /// struct commands : scl::hash::key_domain<> {};
+    /// @endcode
+    ///
+    /// @tparam Hasher  A @ref concepts::byte_hasher. Defaults to `siphash_hasher<>`, as @ref key does.
+    template <concepts::byte_hasher Hasher = siphash_hasher<>>
+    struct key_domain
+    {
+        using key_type = key<Hasher>;
+    };
+
+    /// @brief One registered key as stored in the `scl_keys` linker section.
+    /// @ingroup scl_utility_hash
+    struct key_section_record
+    {
+        /// @brief FNV-1a of the domain's type name.
+        ::std::uint64_t domain;
+        /// @brief Low and high 64 bits of the digest.
+        ::std::uint64_t digest[2];
+        char const * name;
+        ::std::size_t size;
+
+        constexpr ::std::string_view text() const noexcept { return {name, size}; }
+    };
+
+    namespace detail
+    {
+        // Called only when a check fails; being non-constexpr, each turns the
+        // failure into a compile error that names it.
+
+        /// @brief @ref SCL_KEY names a literal not registered in the domain before this point.
+        inline void key_registry_error_unregistered() noexcept {}
+
+        /// @brief Counter tag and ADL anchor of the registry of @p Domain.
+        template <typename Domain>
+        struct key_registry_tag
+        {};
+
+        /// @brief One registered literal and its key.
+        template <typename Domain>
+        struct key_registry_entry
+        {
+            typename Domain::key_type key;
+            ::std::string_view name;
+        };
+
+        /// @brief Entries `0 .. sizeof...(I)-1` of the registry of @p Domain.
+        ///
+        /// Each entry is a `key_registry_record` overload defined by
+        /// @ref SCL_KEY_REGISTER and found by ADL through @ref key_registry_tag.
+        template <typename Domain, ::std::uint_fast32_t... I>
+        consteval auto key_registry_entries(::std::integer_sequence<::std::uint_fast32_t, I...>)
+        {
+            return ::std::array<key_registry_entry<Domain>, sizeof...(I)>{key_registry_record(
+                key_registry_tag<Domain>{}, ::scl::preprocessor::detail::counter<I>{})...};
+        }
+
+        /// @brief Returns `true` if entry @p N of @p Domain has the digest of a
+        ///        different literal among entries `0 .. N-1`.
+        ///
+        /// Registering the same literal twice is allowed: it is the same key.
+        template <typename Domain, ::std::uint_fast32_t N>
+        consteval bool key_registry_collides()
+        {
+            constexpr auto entries = detail::key_registry_entries<Domain>(
+                ::std::make_integer_sequence<::std::uint_fast32_t, N + 1>{});
+            auto const & last = entries[N];
+            return ::std::any_of(entries.begin(), entries.begin() + N, [&](auto const & e) {
+                return e.key == last.key && e.name != last.name;
+            });
+        }
+
+        /// @brief Returns the key of @p name among the first @p N entries of @p Domain.
+        template <typename Domain, ::std::uint_fast32_t N>
+        consteval typename Domain::key_type key_registry_find(::std::string_view const name)
+        {
+            constexpr auto entries = detail::key_registry_entries<Domain>(
+                ::std::make_integer_sequence<::std::uint_fast32_t, N>{});
+            for (auto const & e : entries)
+                if (e.name == name)
+                    return e.key;
+            detail::key_registry_error_unregistered();
+            return typename Domain::key_type{name};
+        }
+
+        /// @brief Identifies @p Domain across translation units.
+        template <typename Domain>
+        inline constexpr ::std::uint64_t key_domain_id = fnv1a_hasher{}(::scl::type_name<Domain>());
+
+        /// @brief Section record of @p entry.
+        template <typename Domain>
+        constexpr key_section_record
+        key_section_make(key_registry_entry<Domain> const & entry) noexcept
+        {
+            auto const d = entry.key.value;
+            if constexpr (::std::same_as<typename Domain::key_type::value_type, uint128>)
+                return {key_domain_id<Domain>, {d.lo, d.hi}, entry.name.data(), entry.name.size()};
+            else
+                return {key_domain_id<Domain>, {static_cast<::std::uint64_t>(d), 0},
+                    entry.name.data(), entry.name.size()};
+        }
+    } // namespace detail
+
+    /// @brief Pairs of records of one domain with equal digests and different names.
+    /// @ingroup scl_utility_hash
+    inline ::std::vector<::std::pair<key_section_record, key_section_record>>
+    key_section_collisions(::std::span<key_section_record const> const records)
+    {
+        ::std::vector<key_section_record> sorted(records.begin(), records.end());
+        auto const id = [](key_section_record const & r) {
+            return ::std::array{r.domain, r.digest[0], r.digest[1]};
+        };
+        ::std::sort(sorted.begin(), sorted.end(),
+            [&](auto const & a, auto const & b) { return id(a) < id(b); });
+
+        ::std::vector<::std::pair<key_section_record, key_section_record>> out;
+        for (::std::size_t first = 0, last = 0; first < sorted.size(); first = last)
+        {
+            while (last < sorted.size() && id(sorted[last]) == id(sorted[first]))
+                ++last;
+            for (auto i = first; i < last; ++i)
+                for (auto j = i + 1; j < last; ++j)
+                    if (sorted[i].text() != sorted[j].text())
+                        out.emplace_back(sorted[i], sorted[j]);
+        }
+        return out;
+    }
+
+#if SCL_HASH_KEY_SECTION_SUPPORTED
+    namespace detail
+    {
+        // Bounds of the section, provided by the linker; weak so that a
+        // program without records still links.
+        extern "C" [[gnu::weak]] key_section_record const __start_scl_keys[];
+        extern "C" [[gnu::weak]] key_section_record const __stop_scl_keys[];
+    } // namespace detail
+
+    /// @brief Records of every @ref SCL_KEY_REGISTER compiled with @ref SCL_HASH_KEY_SECTION
+    ///        in the linked program, across translation units.
+    /// @ingroup scl_utility_hash
+    inline ::std::span<key_section_record const> key_section() noexcept
+    {
+        if (detail::__start_scl_keys == nullptr || detail::__stop_scl_keys == nullptr)
+            return {};
+        return {detail::__start_scl_keys, detail::__stop_scl_keys};
+    }
+
+    /// @brief Collisions across the whole program; see @ref key_section.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Each translation unit already rejects its own collisions at compile
+    /// time. Call this once, e.g. from a unit test, to check the keys that
+    /// different translation units register in the same domain.
+    inline ::std::vector<::std::pair<key_section_record, key_section_record>>
+    key_section_collisions()
+    {
+        return scl::hash::key_section_collisions(scl::hash::key_section());
+    }
+#endif
+
+} // namespace scl::hash
+
+/**
+ * @internal
+ * @def SCL_HASH_KEY_CONCAT(a, b)
+ * @brief Pastes @p a and @p b after expanding them.
+ * @ingroup scl_utility_hash
+ */
+#define SCL_HASH_KEY_CONCAT_IMPL(a, b) a##b
+#define SCL_HASH_KEY_CONCAT(a, b) SCL_HASH_KEY_CONCAT_IMPL(a, b)
+
+/**
+ * @internal
+ * @def SCL_HASH_KEY_SECTION_RECORD(Domain)
+ * @brief Places the newest entry of @p Domain in the `scl_keys` section when
+ *        @ref SCL_HASH_KEY_SECTION is `1`.
+ * @ingroup scl_utility_hash
+ */
+#if SCL_HASH_KEY_SECTION
+#define SCL_HASH_KEY_SECTION_RECORD(Domain)                                                      \
+    namespace scl::hash::detail                                                                  \
+    {                                                                                            \
+        [[gnu::used, gnu::section("scl_keys")]] alignas(key_section_record) static constexpr     \
+            key_section_record SCL_HASH_KEY_CONCAT(key_section_entry_, __COUNTER__) =            \
+                detail::key_section_make<Domain>(key_registry_record(key_registry_tag<Domain>{}, \
+                    ::scl::preprocessor::detail::counter<SCL_COUNTER_VALUE(                      \
+                        ::scl::hash::detail::key_registry_tag<Domain>) - 1>{}));                 \
+    }
+#else
+#define SCL_HASH_KEY_SECTION_RECORD(Domain)
+#endif
+
+/**
+ * @def SCL_KEY_REGISTER(Domain, literal)
+ * @brief Registers the string @p literal as a key of @p Domain, failing to compile
+ *        if its digest collides with a different literal registered earlier.
+ * @ingroup scl_utility_hash
+ * @details
+ * Each registration defines the next entry of the domain's registry, built
+ * on the `SCL_COUNTER` ADL counter, and checks it against every earlier
+ * entry: the keys of a domain are pairwise distinct within the translation
+ * unit. Registering the same literal twice is allowed.
+ *
+ * Like `SCL_COUNTER_NEXT`, it must be used at global namespace scope.
+ *
+ * @param Domain   A type deriving from @ref scl::hash::key_domain, fully qualified.
+ * @param literal  A string literal.
+ *
+ * @code{.cpp}
+ * namespace app { struct commands : scl::hash::key_domain<> {}; }
+ *
+ * SCL_KEY_REGISTER(app::commands, "start")
+ * SCL_KEY_REGISTER(app::commands, "stop")
+ * @endcode
+ */
+#define SCL_KEY_REGISTER(Domain, literal)                                                        \
+    namespace scl::hash::detail                                                                  \
+    {                                                                                            \
+        static constexpr key_registry_entry<Domain> key_registry_record(                         \
+            key_registry_tag<Domain>,                                                            \
+            ::scl::preprocessor::detail::counter<SCL_COUNTER_VALUE(                              \
+                ::scl::hash::detail::key_registry_tag<Domain>)>) noexcept                        \
+        {                                                                                        \
+            return {typename Domain::key_type{::std::string_view{literal}}, literal};            \
+        }                                                                                        \
+    }                                                                                            \
+    static_assert(!::scl::hash::detail::key_registry_collides<Domain,                            \
+                      SCL_COUNTER_VALUE(::scl::hash::detail::key_registry_tag<Domain>)>(),       \
+        "SCL_KEY_REGISTER(" #Domain ", " #literal "): digest collides with a different literal " \
+        "registered earlier in this domain");                                                    \
+    SCL_COUNTER_NEXT(::scl::hash::detail::key_registry_tag<Domain>)                              \
+    SCL_HASH_KEY_SECTION_RECORD(Domain)
+
+/**
+ * @def SCL_KEY(Domain, literal)
+ * @brief The key of @p literal in @p Domain; fails to compile unless @p literal
+ *        was registered with @ref SCL_KEY_REGISTER earlier in the translation unit.
+ * @ingroup scl_utility_hash
+ * @details
+ * A constant expression of type `Domain::key_type`, usable anywhere —
+ * including `case` labels and template arguments. An unregistered literal
+ * is a compile error naming `key_registry_error_unregistered`.
+ *
+ * Every `SCL_KEY` of a domain is therefore one of its registered keys,
+ * which are pairwise distinct: labels and map keys built with it cannot
+ * alias each other.
+ *
+ * @code{.cpp}
+ * int handle(app::commands::key_type cmd) {
+ *     switch (cmd) {
+ *         case SCL_KEY(app::commands, "start"): return 1;
+ *         case SCL_KEY(app::commands, "stop"):  return 2;
+ *         default: return 0;
+ *     }
+ * }
+ * @endcode
+ */
+#define SCL_KEY(Domain, literal)                                                  \
+    (::scl::hash::detail::key_registry_find<Domain,                               \
+        SCL_COUNTER_VALUE(::scl::hash::detail::key_registry_tag<Domain>)>(        \
+        ::std::string_view{literal}))
@@ -0,0 +1,178 @@
+#pragma once
+
+/// @file key_switch.h
+/// @brief Jump-table dispatch on @ref scl::hash::key values through a compile-time perfect hash.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/detail/perfect_hash.h>
+#include <scl/utility/hash/key.h>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace scl::hash
+{
+    namespace detail
+    {
+        /// @brief Compile-time tables of one @ref key_switch label set.
+        template <auto First, auto... Rest>
+        struct key_switch_table
+        {
+            using key_type = decltype(First);
+            using hasher_type = typename key_type::hasher_type;
+            using digest_type = typename key_type::value_type;
+
+            static_assert((::std::same_as<decltype(Rest), key_type> && ...),
+                "scl::hash::key_switch: all labels must be keys of the same hasher");
+
+            static constexpr ::std::size_t size = 1 + sizeof...(Rest);
+
+            static constexpr ::std::array<::std::uint64_t, size> words{
+                detail::perfect_hash_word<hasher_type>(First.value),
+                detail::perfect_hash_word<hasher_type>(Rest.value)...};
+
+            static constexpr bool distinct = [] {
+                auto sorted = words;
+                ::std::sort(sorted.begin(), sorted.end());
+                return ::std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end();
+            }();
+            static_assert(distinct,
+                "scl::hash::key_switch: duplicate case label, "
+                "or two labels with colliding digests");
+
+            static constexpr auto layout =
+                distinct ? detail::make_perfect_hash(words) : perfect_hash_layout<size>{};
+
+            /// @brief Label digests by slot.
+            static constexpr auto digests = [] {
+                constexpr ::std::array<digest_type, size> labels{First.value, Rest.value...};
+                ::std::array<digest_type, size> out{};
+                for (::std::size_t slot = 0; slot < size; ++slot)
+                    out[slot] = labels[layout.order[slot]];
+                return out;
+            }();
+
+            /// @brief Jump-table index of @p k: its slot if it is a label, @ref size otherwise.
+            static constexpr ::std::size_t index(key_type const k) noexcept
+            {
+                auto const slot = layout.hash(detail::perfect_hash_word<hasher_type>(k.value));
+                return digests[slot] == k.value ? slot : size;
+            }
+        };
+
+        /// @brief Reference to handler @p I of a @ref key_switch call.
+        template <::std::size_t I,
+            typename Handler,
+            bool Stateless = ::std::is_empty_v<Handler> && ::std::default_initializable<Handler>>
+        struct key_switch_handler
+        {
+            Handler & handler;
+
+            constexpr Handler & get() const noexcept { return handler; }
+        };
+
+        /// @brief Captureless handlers are recreated in the jump-table entry,
+        ///        so nothing is stored for them.
+        template <::std::size_t I, typename Handler>
+        struct key_switch_handler<I, Handler, true>
+        {
+            constexpr key_switch_handler(Handler &) noexcept {}
+
+            constexpr Handler get() const noexcept { return Handler{}; }
+        };
+
+        /// @brief All handlers of a @ref key_switch call.
+        ///
+        /// A flat set of bases rather than a `std::tuple`, whose recursive
+        /// layout makes each `get<I>` cost O(N) instantiations.
+        template <typename Indices, typename... Handlers>
+        struct key_switch_handlers;
+
+        template <::std::size_t... I, typename... Handlers>
+        struct key_switch_handlers<::std::index_sequence<I...>, Handlers...>
+            : key_switch_handler<I, Handlers>...
+        {};
+
+        template <::std::size_t I, typename Handler, bool Stateless>
+        constexpr decltype(auto)
+        key_switch_get(key_switch_handler<I, Handler, Stateless> const & h) noexcept
+        {
+            return h.get();
+        }
+
+        /// @brief Jump-table entry: calls handler @p I.
+        template <::std::size_t I, typename Result, typename Handlers>
+        constexpr Result key_switch_call(Handlers const & handlers)
+        {
+            return static_cast<Result>(::std::invoke(detail::key_switch_get<I>(handlers)));
+        }
+
+        /// @brief Handler pointers by slot, followed by the default handler.
+        template <typename Table, typename Result, typename Handlers, ::std::size_t... Slot>
+        inline constexpr Result (*key_switch_jump_table[])(Handlers const &) = {
+            &detail::key_switch_call<Table::layout.order[Slot], Result, Handlers>...,
+            &detail::key_switch_call<Table::size, Result, Handlers>};
+
+        template <typename Table, typename Result, typename Handlers, ::std::size_t... Slot>
+        constexpr auto const & key_switch_jump_table_for(::std::index_sequence<Slot...>) noexcept
+        {
+            return key_switch_jump_table<Table, Result, Handlers, Slot...>;
+        }
+    } // namespace detail
+
+    /// @brief Calls the handler of the label equal to @p k, or the default handler.
+    /// @ingroup scl_utility_hash
+    ///
+    /// A `switch` over @ref key case labels compiles to a binary search over
+    /// sparse 64-bit constants: with hundreds of labels, about eight
+    /// unpredictable branches. `key_switch` maps the labels onto `0 .. N-1`
+    /// with a minimal perfect hash found at compile time (the
+    /// hash-and-displace search of @ref static_map) and dispatches through
+    /// a table of handler pointers: two mixes, one displacement load, one
+    /// digest comparison and one indirect call, whatever the number of labels.
+    ///
+    /// There is one handler per label, in label order, followed by the
+    /// default handler, which is called when @p k is not a label. Handlers
+    /// take no arguments; the result is their `std::common_type`.
+    ///
+    /// @code
+    /// using cmd = scl::hash::key<>;
+    /// int const code = scl::hash::key_switch<cmd{"start"}, cmd{"stop"}, cmd{"status"}>(
+    ///     cmd{input},
+    ///     [] { return 1; },  // "start"
+    ///     [] { return 2; },  // "stop"
+    ///     [] { return 3; },  // "status"
+    ///     [] { return 0; }); // default
+    /// @endcode
+    ///
+    /// Duplicate labels, or two labels whose digests collide, fail a
+    /// `static_assert`. Dispatch also works in constant evaluation.
+    ///
+    /// @tparam Labels    @ref key values of one hasher type.
+    /// @param  k         The runtime key to dispatch on.
+    /// @param  handlers  `sizeof...(Labels)` handlers followed by the default handler.
+    template <auto... Labels, typename... Handlers>
+        requires(sizeof...(Labels) > 0 && sizeof...(Handlers) == sizeof...(Labels) + 1
+            && (::std::invocable<Handlers &> && ...))
+    constexpr auto key_switch(
+        typename detail::key_switch_table<Labels...>::key_type const k, Handlers &&... handlers)
+        -> ::std::common_type_t<::std::invoke_result_t<Handlers &>...>
+    {
+        using table = detail::key_switch_table<Labels...>;
+        using result_type = ::std::common_type_t<::std::invoke_result_t<Handlers &>...>;
+        using handlers_type = detail::key_switch_handlers<::std::index_sequence_for<Handlers...>,
+            ::std::remove_reference_t<Handlers>...>;
+
+        handlers_type const refs{{handlers}...};
+        auto const & jump = detail::key_switch_jump_table_for<table, result_type, handlers_type>(
+            ::std::make_index_sequence<table::size>{});
+        return jump[table::index(k)](refs);
+    }
+
+} // namespace scl::hash
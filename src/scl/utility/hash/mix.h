@@ -0,0 +1,159 @@
+#pragma once
+
+/// @file mix.h
+/// @brief Integer finalizers (mixers), Lemire's fast range reduction and hashing of integral keys.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/detail/mul128.h>
+#include <scl/utility/hash/uint128.h>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace scl::hash::concepts
+{
+    /// @brief Concept satisfied by the integer finalizers, e.g. @ref scl::hash::fmix64_mixer:
+    ///        default-constructible, mapping a 64-bit word to a 64-bit word.
+    /// @ingroup scl_utility_hash
+    // clang-format off
+    template <typename M>
+    concept mixer = ::std::default_initializable<M>
+            && requires(M const & m, ::std::uint64_t x) {
+                   { m(x) } -> ::std::same_as<::std::uint64_t>;
+               };
+    // clang-format on
+} // namespace scl::hash::concepts
+
+namespace scl::hash
+{
+    /// @brief Returns its input unchanged — for digests that are already uniform.
+    /// @ingroup scl_utility_hash
+    struct identity_mixer
+    {
+        constexpr ::std::uint64_t operator()(::std::uint64_t const x) const noexcept { return x; }
+    };
+
+    /// @brief MurmurHash3 64-bit finalizer `fmix64`: two multiplies, three xor-shifts.
+    /// @ingroup scl_utility_hash
+    ///
+    /// A bijection in which every input bit affects every output bit with
+    /// probability close to ½. Maps 0 to 0.
+    struct fmix64_mixer
+    {
+        constexpr ::std::uint64_t operator()(::std::uint64_t x) const noexcept
+        {
+            x ^= x >> 33;
+            x *= 0xff51afd7ed558ccdull;
+            x ^= x >> 33;
+            x *= 0xc4ceb9fe1a85ec53ull;
+            x ^= x >> 33;
+            return x;
+        }
+    };
+
+    /// @brief SplitMix64 finalizer (Stafford's "Mix13" variant): adds the golden ratio, then mixes.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Same cost as @ref fmix64_mixer with slightly better avalanche; the
+    /// added constant means 0 does not map to 0. `splitmix64_mixer{}(0)` is
+    /// the first output of the reference SplitMix64 generator seeded with 0.
+    struct splitmix64_mixer
+    {
+        constexpr ::std::uint64_t operator()(::std::uint64_t x) const noexcept
+        {
+            x += 0x9e3779b97f4a7c15ull;
+            x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+            x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+            return x ^ (x >> 31);
+        }
+    };
+
+    /// @brief Fibonacci multiply-shift: one multiply by 2^64/φ, high half xor-ed into the low half.
+    /// @ingroup scl_utility_hash
+    ///
+    /// The product's high bits depend on all input bits; xor-ing them down
+    /// makes the low bits — the ones a power-of-two mask keeps — depend on
+    /// them too. The cheapest mixer here and the weakest: enough to spread
+    /// sequential or aligned integers, not to repair a poor hash.
+    struct multiply_shift_mixer
+    {
+        constexpr ::std::uint64_t operator()(::std::uint64_t const x) const noexcept
+        {
+            ::std::uint64_t const p = x * 0x9e3779b97f4a7c15ull;
+            return p ^ (p >> 32);
+        }
+    };
+
+    /// @brief Maps a 64-bit hash uniformly onto `[0, n)` without division (Lemire's fast range).
+    /// @ingroup scl_utility_hash
+    ///
+    /// Returns the high 64 bits of `h * n`: one multiply instead of the
+    /// 64-bit division of `h % n`, for any table size, not only powers of two.
+    /// Unlike `%` it uses the **high** bits of @p h, so pair it with a hash
+    /// or @ref concepts::mixer whose high bits are well mixed.
+    ///
+    /// @code
+    /// auto const bucket = scl::hash::fast_range(scl::hash::hash_int(id), buckets.size());
+    /// @endcode
+    ///
+    /// @see D. Lemire, "A fast alternative to the modulo reduction", 2016.
+    constexpr ::std::uint64_t fast_range(::std::uint64_t const h, ::std::uint64_t const n) noexcept
+    {
+        ::std::uint64_t hi = 0;
+        detail::mul128(h, n, hi);
+        return hi;
+    }
+
+    /// @brief 32-bit @ref fast_range: the high 32 bits of `h * n`, for 32-bit digests and table sizes.
+    /// @ingroup scl_utility_hash
+    constexpr ::std::uint32_t fast_range32(
+        ::std::uint32_t const h, ::std::uint32_t const n) noexcept
+    {
+        return static_cast<::std::uint32_t>((static_cast<::std::uint64_t>(h) * n) >> 32);
+    }
+
+    /// @brief Hashes an integral value with @p Mixer.
+    /// @ingroup scl_utility_hash
+    ///
+    /// The value is converted to `std::uint64_t` first — signed values are
+    /// sign-extended — so equal values of different integer types hash equal.
+    ///
+    /// @code
+    /// static_assert(scl::hash::hash_int(42) == scl::hash::fmix64_mixer{}(42));
+    /// @endcode
+    template <concepts::mixer Mixer = fmix64_mixer, ::std::integral T>
+    constexpr ::std::uint64_t hash_int(T const v) noexcept
+    {
+        return Mixer{}(static_cast<::std::uint64_t>(v));
+    }
+
+    /// @brief `std::unordered_map`-compatible hash function object for integral and enum keys.
+    /// @ingroup scl_utility_hash
+    ///
+    /// `std::hash<int>` is the identity on libstdc++ and libc++; tables that
+    /// keep the low bits (power-of-two open addressing) then see clustered
+    /// keys — multiples of 8, sequential ids with a common stride — pile
+    /// into few buckets. `int_hash` mixes first:
+    /// @code
+    /// std::unordered_map<std::uint64_t, order, scl::hash::int_hash<>> by_id;
+    /// @endcode
+    ///
+    /// @tparam Mixer  A @ref concepts::mixer. Defaults to @ref fmix64_mixer.
+    template <concepts::mixer Mixer = fmix64_mixer>
+    struct int_hash
+    {
+        template <typename T>
+            requires ::std::integral<T> || ::std::is_enum_v<T>
+        constexpr ::std::size_t operator()(T const v) const noexcept
+        {
+            if constexpr (::std::is_enum_v<T>)
+                return detail::fold_to_size(
+                    scl::hash::hash_int<Mixer>(static_cast<::std::underlying_type_t<T>>(v)));
+            else
+                return detail::fold_to_size(scl::hash::hash_int<Mixer>(v));
+        }
+    };
+
+} // namespace scl::hash
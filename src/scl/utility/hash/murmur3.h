@@ -0,0 +1,231 @@
+#pragma once
+
+/// @file murmur3.h
+/// @brief MurmurHash3_x64_128: 128-bit multiply-rotate hash over 16-byte blocks.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/detail/load.h>
+#include <scl/utility/hash/detail/segments.h>
+#include <scl/utility/hash/mix.h>
+#include <scl/utility/hash/uint128.h>
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+namespace scl::hash
+{
+    namespace detail
+    {
+        inline constexpr ::std::uint64_t murmur3_c1 = 0x87c37b91114253d5ull;
+        inline constexpr ::std::uint64_t murmur3_c2 = 0x4cf5ad432745937full;
+
+        /// @brief Premixes the first 8-byte word of a block.
+        constexpr ::std::uint64_t murmur3_mix_k1(::std::uint64_t k1) noexcept
+        {
+            k1 *= murmur3_c1;
+            k1 = ::std::rotl(k1, 31);
+            return k1 * murmur3_c2;
+        }
+
+        /// @brief Premixes the second 8-byte word of a block.
+        constexpr ::std::uint64_t murmur3_mix_k2(::std::uint64_t k2) noexcept
+        {
+            k2 *= murmur3_c2;
+            k2 = ::std::rotl(k2, 33);
+            return k2 * murmur3_c1;
+        }
+    } // namespace detail
+
+    /// @brief Incremental MurmurHash3_x64_128 state for hashing a message in several ranges.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Buffers the trailing partial 16-byte block between @ref update calls, so
+    /// the digest returned by @ref finalize equals @ref murmur3_x64_128 over
+    /// the concatenated bytes, however the message is split. @ref finalize
+    /// works on a copy of the state; more bytes may be appended afterwards.
+    ///
+    /// At run time, contiguous ranges of byte-sized elements are absorbed a
+    /// block at a time with unaligned 64-bit loads; constant evaluation and
+    /// non-contiguous ranges are absorbed element by element.
+    struct murmur3_x64_128_state
+    {
+        using result_type = uint128;
+
+        /// @brief Starts a new message with @p seed.
+        constexpr explicit murmur3_x64_128_state(::std::uint32_t const seed = 0) noexcept
+            : m_h1{seed}
+            , m_h2{seed}
+        {}
+
+        /// @brief Appends @p range to the message.
+        template <::std::ranges::input_range Range>
+        constexpr murmur3_x64_128_state & update(Range && range) noexcept
+            requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+        {
+            if (!::std::is_constant_evaluated())
+            {
+                detail::for_each_segment(range, [this](::std::span<unsigned char const> bytes) {
+                    update_bytes(bytes.data(), bytes.size());
+                });
+                return *this;
+            }
+
+            for (auto const c : range)
+            {
+                m_buf[m_len & 15] = static_cast<unsigned char>(static_cast<::std::uint8_t>(c));
+                if ((++m_len & 15) == 0) // full 16-byte block ready
+                    consume(m_buf);
+            }
+            return *this;
+        }
+
+        /// @brief Returns the digest of all bytes appended so far.
+        constexpr result_type finalize() const noexcept
+        {
+            ::std::uint64_t h1 = m_h1;
+            ::std::uint64_t h2 = m_h2;
+
+            // Tail: up to 15 bytes as two zero-padded words. An all-zero word
+            // premixes to zero, so absent words leave the state unchanged.
+            ::std::size_t const n = m_len & 15;
+            ::std::uint64_t k1 = 0;
+            ::std::uint64_t k2 = 0;
+            for (::std::size_t i = 0; i < n; ++i)
+            {
+                if (i < 8)
+                    k1 |= ::std::uint64_t{m_buf[i]} << (i * 8);
+                else
+                    k2 |= ::std::uint64_t{m_buf[i]} << ((i - 8) * 8);
+            }
+            h2 ^= detail::murmur3_mix_k2(k2);
+            h1 ^= detail::murmur3_mix_k1(k1);
+
+            h1 ^= m_len;
+            h2 ^= m_len;
+            h1 += h2;
+            h2 += h1;
+            h1 = fmix64_mixer{}(h1);
+            h2 = fmix64_mixer{}(h2);
+            h1 += h2;
+            h2 += h1;
+            return {.lo = h1, .hi = h2};
+        }
+
+    private:
+        /// @brief Absorbs one 16-byte block.
+        constexpr void consume(unsigned char const * p) noexcept
+        {
+            m_h1 ^= detail::murmur3_mix_k1(detail::read_le<::std::uint64_t>(p));
+            m_h1 = ::std::rotl(m_h1, 27);
+            m_h1 += m_h2;
+            m_h1 = m_h1 * 5 + 0x52dce729;
+
+            m_h2 ^= detail::murmur3_mix_k2(detail::read_le<::std::uint64_t>(p + 8));
+            m_h2 = ::std::rotl(m_h2, 31);
+            m_h2 += m_h1;
+            m_h2 = m_h2 * 5 + 0x38495ab5;
+        }
+
+        /// @brief Runtime path: block-at-a-time absorption of contiguous memory.
+        void update_bytes(unsigned char const * p, ::std::size_t n) noexcept
+        {
+            ::std::size_t const fill = m_len & 15;
+            m_len += n;
+
+            if (fill != 0) // complete the buffered partial block first
+            {
+                ::std::size_t const k = n < 16 - fill ? n : 16 - fill;
+                ::std::memcpy(m_buf + fill, p, k);
+                if (fill + k < 16)
+                    return;
+                consume(m_buf);
+                p += k;
+                n -= k;
+            }
+
+            for (; n >= 16; p += 16, n -= 16)
+                consume(p);
+
+            if (n != 0)
+                ::std::memcpy(m_buf, p, n);
+        }
+
+        ::std::uint64_t m_h1;
+        ::std::uint64_t m_h2;
+        unsigned char m_buf[16]{}; ///< Pending bytes of the current block.
+        ::std::uint64_t m_len{};   ///< Total number of bytes appended.
+    };
+
+    /// @brief Computes a MurmurHash3_x64_128 hash over an arbitrary byte range.
+    /// @ingroup scl_utility_hash
+    ///
+    /// MurmurHash3 (Austin Appleby, 2011) in its x64 128-bit flavour consumes
+    /// 16-byte blocks as two 64-bit words that update two cross-coupled
+    /// halves of the state:
+    /// @code
+    ///   h1 ^= rotl(k1 * c1, 31) * c2;  h1 = (rotl(h1, 27) + h2) * 5 + 0x52dce729;
+    ///   h2 ^= rotl(k2 * c2, 33) * c1;  h2 = (rotl(h2, 31) + h1) * 5 + 0x38495ab5;
+    /// @endcode
+    /// Both halves are avalanched with `fmix64` at the end. It is a common
+    /// 128-bit hash in data tools (Guava's `murmur3_128`, Python's `mmh3`), so
+    /// digests interoperate with identifiers they produced.
+    /// Digests match the reference `MurmurHash3_x64_128()`.
+    ///
+    /// The function is `constexpr`, allowing compile-time hash computation.
+    /// At run time, contiguous ranges of byte-sized elements are read with
+    /// unaligned 64-bit loads; both paths produce identical digests.
+    ///
+    /// MurmurHash3 is **not** resistant to hash flooding: seed-independent
+    /// collisions are known. Use @ref siphash128 for attacker-controlled keys.
+    ///
+    /// @tparam Range  Any type satisfying `std::ranges::input_range` whose elements
+    ///                are convertible to `std::uint8_t` — e.g. a string literal,
+    ///                `std::string_view`, `std::string`, `std::span<std::byte>`.
+    /// @param  range  Input range to hash.
+    /// @note   String literals (e.g. `"hello"`) include the null terminator in the
+    ///         hash. Use `std::string_view{"hello"}` to hash only the characters.
+    /// @param  seed   32-bit seed, as in the reference. Defaults to `0`.
+    /// @return 128-bit digest; `lo` and `hi` are the reference `h1` and `h2`.
+    ///
+    /// @par Compile-time example
+    /// @code
+    /// constexpr auto h = scl::hash::murmur3_x64_128(std::string_view{"hello"});
+    /// static_assert(h.lo == 0xcbd8a7b341bd9b02ull);
+    /// @endcode
+    ///
+    /// @see https://github.com/aappleby/smhasher/blob/master/src/MurmurHash3.cpp
+    template <::std::ranges::input_range Range>
+    constexpr uint128 murmur3_x64_128(Range && range, ::std::uint32_t const seed = 0)
+        requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+    {
+        return murmur3_x64_128_state{seed}.update(range).finalize();
+    }
+
+    /// @brief Callable wrapper around @ref murmur3_x64_128 for use with @ref scl::hash::key.
+    /// @ingroup scl_utility_hash
+    ///
+    /// @tparam Seed  32-bit seed. Defaults to `0`.
+    template <::std::uint32_t Seed = 0>
+    struct murmur3_x64_128_hasher
+    {
+        using result_type = uint128;
+        using state_type = murmur3_x64_128_state;
+
+        template <::std::ranges::input_range Range>
+        constexpr result_type operator()(Range && range) const noexcept
+            requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+        {
+            return ::scl::hash::murmur3_x64_128(range, Seed);
+        }
+
+        /// @brief Returns a fresh streaming state seeded with @p Seed.
+        constexpr state_type make_state() const noexcept { return state_type{Seed}; }
+    };
+
+} // namespace scl::hash
@@ -0,0 +1,222 @@
+#pragma once
+
+/// @file rapidhash.h
+/// @brief rapidhash: wyhash-family 64-bit hash built on a 64×64→128-bit multiply-mix.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/detail/load.h>
+#include <scl/utility/hash/detail/mul128.h>
+#include <scl/utility/hash/detail/segments.h>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace scl::hash
+{
+    /// @brief Default rapidhash seed (`RAPID_SEED` of the reference implementation).
+    /// @ingroup scl_utility_hash
+    inline constexpr ::std::uint64_t rapidhash_default_seed = 0xbdd89aa982704029ull;
+
+    namespace detail
+    {
+        /// @brief rapidhash mixing constants.
+        inline constexpr ::std::array<::std::uint64_t, 3> rapid_secret{
+            0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull};
+
+        /// @brief Replaces @p a and @p b by the low and high halves of their 128-bit product.
+        constexpr void rapid_mum(::std::uint64_t & a, ::std::uint64_t & b) noexcept
+        {
+            ::std::uint64_t hi = 0;
+            a = detail::mul128(a, b, hi);
+            b = hi;
+        }
+
+        /// @brief rapidhash of @p n bytes starting at @p p.
+        template <::std::random_access_iterator It>
+        constexpr ::std::uint64_t rapidhash_impl(
+            It p, ::std::size_t const n, ::std::uint64_t seed) noexcept
+        {
+            constexpr auto const & s = rapid_secret;
+            seed ^= detail::mul128_fold64(seed ^ s[0], s[1]) ^ n;
+
+            ::std::uint64_t a = 0;
+            ::std::uint64_t b = 0;
+            if (n <= 16)
+            {
+                if (n >= 4)
+                {
+                    // One path for 4–16 bytes: four overlapping 32-bit loads
+                    // cover the input whatever its length.
+                    It const last = p + (n - 4);
+                    ::std::size_t const delta = (n & 24) >> (n >> 3);
+                    a = (::std::uint64_t{detail::read_le<::std::uint32_t>(p)} << 32) |
+                        detail::read_le<::std::uint32_t>(last);
+                    b = (::std::uint64_t{detail::read_le<::std::uint32_t>(p + delta)} << 32) |
+                        detail::read_le<::std::uint32_t>(last - delta);
+                }
+                else if (n > 0)
+                {
+                    a = (::std::uint64_t{static_cast<::std::uint8_t>(p[0])} << 56) |
+                        (::std::uint64_t{static_cast<::std::uint8_t>(p[n >> 1])} << 32) |
+                        static_cast<::std::uint8_t>(p[n - 1]);
+                }
+            }
+            else
+            {
+                ::std::size_t i = n;
+                if (i > 48)
+                {
+                    // Three independent multiply chains per 48-byte block.
+                    ::std::uint64_t see1 = seed;
+                    ::std::uint64_t see2 = seed;
+                    do
+                    {
+                        seed = detail::mul128_fold64(
+                            detail::read_le<::std::uint64_t>(p) ^ s[0],
+                            detail::read_le<::std::uint64_t>(p + 8) ^ seed);
+                        see1 = detail::mul128_fold64(
+                            detail::read_le<::std::uint64_t>(p + 16) ^ s[1],
+                            detail::read_le<::std::uint64_t>(p + 24) ^ see1);
+                        see2 = detail::mul128_fold64(
+                            detail::read_le<::std::uint64_t>(p + 32) ^ s[2],
+                            detail::read_le<::std::uint64_t>(p + 40) ^ see2);
+                        p += 48;
+                        i -= 48;
+                    } while (i >= 48);
+                    seed ^= see1 ^ see2;
+                }
+                if (i > 16)
+                {
+                    seed = detail::mul128_fold64(detail::read_le<::std::uint64_t>(p) ^ s[2],
+                        detail::read_le<::std::uint64_t>(p + 8) ^ seed ^ s[1]);
+                    if (i > 32)
+                        seed = detail::mul128_fold64(
+                            detail::read_le<::std::uint64_t>(p + 16) ^ s[2],
+                            detail::read_le<::std::uint64_t>(p + 24) ^ seed);
+                }
+                // The last 16 bytes of the message, possibly overlapping the
+                // bytes already consumed.
+                a = detail::read_le<::std::uint64_t>((p + i) - 16);
+                b = detail::read_le<::std::uint64_t>((p + i) - 8);
+            }
+
+            a ^= s[1];
+            b ^= seed;
+            detail::rapid_mum(a, b);
+            return detail::mul128_fold64(a ^ s[0] ^ n, b ^ s[1]);
+        }
+    } // namespace detail
+
+    /// @brief Computes a rapidhash 64-bit hash over an arbitrary byte range.
+    /// @ingroup scl_utility_hash
+    ///
+    /// rapidhash (Nicolas De Carli, 2024) is the successor of wyhash: every
+    /// step XORs input words with secret constants and folds their full
+    /// 64×64→128-bit product into 64 bits (`lo ^ hi`), so each multiply mixes
+    /// all input bits into all output bits:
+    /// @code
+    ///   // 0–16 bytes: a, b = overlapping loads of the input
+    ///   // 17+ bytes : 48-byte blocks feed three independent multiply chains,
+    ///   //             then a, b = the last 16 bytes
+    ///   a ^= secret[1]; b ^= seed;
+    ///   (a, b) = lo, hi of a * b;
+    ///   return fold(a ^ secret[0] ^ len, b ^ secret[1]);
+    /// @endcode
+    /// Inputs of 4–16 bytes — typical identifiers — share a single path of
+    /// four overlapping 32-bit loads with no length-dependent branching.
+    /// The 128-bit product uses the compiler's native `unsigned __int128`
+    /// (one `mul` on x86-64, `mul`/`umulh` on AArch64) or `_umul128` on MSVC.
+    ///
+    /// The function is `constexpr`, allowing compile-time hash computation.
+    /// Sized random-access ranges are hashed in place, reading contiguous
+    /// bytes with unaligned loads at run time; other ranges are first copied
+    /// into a temporary buffer, because the digest depends on the total length
+    /// and the last 16 bytes before any block is mixed.
+    ///
+    /// rapidhash is **not** resistant to hash flooding; use it for tables whose
+    /// keys are not attacker-controlled.
+    ///
+    /// @tparam Range  Any type satisfying `std::ranges::input_range` whose elements
+    ///                are convertible to `std::uint8_t` — e.g. a string literal,
+    ///                `std::string_view`, `std::string`, `std::span<std::byte>`.
+    /// @param  range  Input range to hash.
+    /// @note   String literals (e.g. `"hello"`) include the null terminator in the
+    ///         hash. Use `std::string_view{"hello"}` to hash only the characters.
+    /// @param  seed   64-bit seed. Defaults to @ref rapidhash_default_seed.
+    /// @return 64-bit rapidhash digest.
+    ///
+    /// @par Compile-time example
+    /// @code
+    /// constexpr auto h = scl::hash::rapidhash(std::string_view{"metric.name"});
+    /// static_assert(h != 0);
+    /// @endcode
+    ///
+    /// @see https://github.com/Nicoshev/rapidhash
+    template <::std::ranges::input_range Range>
+    constexpr ::std::uint64_t rapidhash(
+        Range && range, ::std::uint64_t const seed = rapidhash_default_seed)
+        requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+    {
+        if constexpr (::std::ranges::random_access_range<Range> &&
+            ::std::ranges::sized_range<Range>)
+        {
+            if (detail::contiguous_byte_range<Range> || ::std::is_constant_evaluated())
+                return detail::rapidhash_impl(::std::ranges::begin(range),
+                    static_cast<::std::size_t>(::std::ranges::size(range)),
+                    seed);
+        }
+
+        // rapidhash needs the whole input up front: collect it, a segment at a time.
+        ::std::vector<unsigned char> bytes;
+        if (::std::is_constant_evaluated())
+        {
+            for (auto const c : range)
+                bytes.push_back(static_cast<unsigned char>(static_cast<::std::uint8_t>(c)));
+        }
+        else
+        {
+            if constexpr (::std::ranges::sized_range<Range>)
+                bytes.reserve(static_cast<::std::size_t>(::std::ranges::size(range)));
+            detail::for_each_segment(range, [&bytes](::std::span<unsigned char const> segment) {
+                bytes.insert(bytes.end(), segment.begin(), segment.end());
+            });
+        }
+        return detail::rapidhash_impl(bytes.data(), bytes.size(), seed);
+    }
+
+    /// @brief Callable wrapper around @ref rapidhash for use with @ref scl::hash::key.
+    /// @ingroup scl_utility_hash
+    ///
+    /// rapidhash mixes the total length into its seed before the first block,
+    /// so it has no streaming state; this hasher provides no `state_type`.
+    ///
+    /// It accepts sized random-access ranges only and hashes them in place,
+    /// so it never allocates and is `noexcept` like the @ref key constructor
+    /// that calls it. Hash other ranges with @ref rapidhash, which gathers
+    /// them into a buffer first.
+    ///
+    /// @tparam Seed  64-bit seed. Defaults to @ref rapidhash_default_seed.
+    template <::std::uint64_t Seed = rapidhash_default_seed>
+    struct rapidhash_hasher
+    {
+        using result_type = ::std::uint64_t;
+
+        template <::std::ranges::random_access_range Range>
+        constexpr result_type operator()(Range && range) const noexcept
+            requires ::std::ranges::sized_range<Range>
+            && ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+        {
+            return detail::rapidhash_impl(::std::ranges::begin(range),
+                static_cast<::std::size_t>(::std::ranges::size(range)),
+                Seed);
+        }
+    };
+
+} // namespace scl::hash
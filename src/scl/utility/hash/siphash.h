@@ -1,13 +1,21 @@
 #pragma once
 
 /// @file siphash.h
-/// @brief SipHash-2-4: 64-bit keyed hash designed for string hashing in hash tables.
+/// @brief SipHash-c-d (SipHash-2-4, SipHash-1-3): 64- and 128-bit keyed hash designed for
+///        string hashing in hash tables.
 /// @ingroup scl_utility_hash
 
+#include <scl/utility/hash/detail/load.h>
+#include <scl/utility/hash/detail/segments.h>
+#include <scl/utility/hash/uint128.h>
+
 #include <bit>
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <ranges>
+#include <span>
+#include <type_traits>
 #include <utility>
 
 namespace scl::hash
@@ -58,7 +66,153 @@ namespace scl::hash
         .k1 = 0x0f0e0d0c0b0a0908ull  // bytes 08..0f
     };
 
-    /// @brief Computes a SipHash-2-4 64-bit hash over an arbitrary byte range.
+    /// @brief Incremental SipHash-c-d state for hashing a message split into several ranges.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Buffers the trailing partial 8-byte block between @ref update calls, so
+    /// the digest returned by @ref finalize equals @ref siphash over the
+    /// concatenated bytes, however the message is split. @ref finalize works on
+    /// a copy of the state; more bytes may be appended afterwards.
+    ///
+    /// At run time, contiguous ranges of byte-sized elements are absorbed with
+    /// unaligned 64-bit little-endian loads; constant evaluation and
+    /// non-contiguous ranges are absorbed element by element.
+    ///
+    /// @code
+    /// scl::hash::siphash_state state{my_key};
+    /// for (std::span<char const> fragment : frame)
+    ///     state.update(fragment);
+    /// auto const digest = state.finalize();
+    /// @endcode
+    ///
+    /// @tparam C  Compression rounds per 8-byte block (2 for SipHash-2-4).
+    /// @tparam D  Finalization rounds (4 for SipHash-2-4).
+    template <::std::size_t C = 2, ::std::size_t D = 4>
+    struct siphash_state
+    {
+        static_assert(C > 0 && D > 0, "SipHash requires at least one round of each kind");
+
+        using result_type = ::std::uint64_t;
+
+        /// @brief Starts a new message keyed with @p key.
+        constexpr explicit siphash_state(siphash_key const key = siphash_default_key) noexcept
+            // Initial state: key XOR'd with magic constants spelling
+            // "somepseudorandomlygeneratedbytes".
+            : m_v0{key.k0 ^ 0x736f6d6570736575ull}
+            , m_v1{key.k1 ^ 0x646f72616e646f6dull}
+            , m_v2{key.k0 ^ 0x6c7967656e657261ull}
+            , m_v3{key.k1 ^ 0x7465646279746573ull}
+        {}
+
+        /// @brief Appends @p range to the message.
+        template <::std::ranges::input_range Range>
+        constexpr siphash_state & update(Range && range) noexcept
+            requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+        {
+            if (!::std::is_constant_evaluated())
+            {
+                detail::for_each_segment(range, [this](::std::span<unsigned char const> bytes) {
+                    update_bytes(bytes.data(), bytes.size());
+                });
+                return *this;
+            }
+
+            for (auto const c : range)
+            {
+                auto const byte = static_cast<::std::uint64_t>(static_cast<::std::uint8_t>(c));
+                m_tail |= byte << ((m_len & 7) * 8);
+                if ((++m_len & 7) == 0) // full 8-byte block ready
+                {
+                    compress(m_v0, m_v1, m_v2, m_v3, m_tail);
+                    m_tail = 0;
+                }
+            }
+            return *this;
+        }
+
+        /// @brief Returns the digest of all bytes appended so far.
+        constexpr result_type finalize() const noexcept
+        {
+            ::std::uint64_t v0 = 0;
+            ::std::uint64_t v1 = 0;
+            ::std::uint64_t v2 = 0;
+            ::std::uint64_t v3 = 0;
+            absorb_last(v0, v1, v2, v3);
+
+            // Finalization: D rounds.
+            v2 ^= 0xffull;
+            for (::std::size_t i = 0; i < D; ++i)
+                detail::sip_round(v0, v1, v2, v3);
+
+            return v0 ^ v1 ^ v2 ^ v3;
+        }
+
+    private:
+        template <::std::size_t, ::std::size_t>
+        friend struct siphash128_state;
+
+        /// @brief Copies the state into @p v0 .. @p v3 and absorbs the last block there.
+        constexpr void absorb_last(::std::uint64_t & v0,
+            ::std::uint64_t & v1,
+            ::std::uint64_t & v2,
+            ::std::uint64_t & v3) const noexcept
+        {
+            v0 = m_v0;
+            v1 = m_v1;
+            v2 = m_v2;
+            v3 = m_v3;
+
+            // Last (partial) block: high byte encodes message length mod 256.
+            ::std::uint64_t const last =
+                m_tail | (static_cast<::std::uint64_t>(m_len & 0xffull) << 56);
+            compress(v0, v1, v2, v3, last);
+        }
+
+        /// @brief Absorbs one 8-byte block with C compression rounds.
+        static constexpr void compress(::std::uint64_t & v0,
+            ::std::uint64_t & v1,
+            ::std::uint64_t & v2,
+            ::std::uint64_t & v3,
+            ::std::uint64_t const m) noexcept
+        {
+            v3 ^= m;
+            for (::std::size_t i = 0; i < C; ++i)
+                detail::sip_round(v0, v1, v2, v3);
+            v0 ^= m;
+        }
+
+        /// @brief Runtime path: word-at-a-time absorption of contiguous memory.
+        void update_bytes(unsigned char const * p, ::std::size_t n) noexcept
+        {
+            ::std::size_t const fill = m_len & 7;
+            m_len += n;
+
+            if (fill != 0) // complete the buffered partial block first
+            {
+                ::std::size_t const k = n < 8 - fill ? n : 8 - fill;
+                m_tail |= detail::load_le64_partial(p, k) << (fill * 8);
+                if (fill + k < 8)
+                    return;
+                compress(m_v0, m_v1, m_v2, m_v3, m_tail);
+                p += k;
+                n -= k;
+            }
+
+            for (; n >= 8; p += 8, n -= 8)
+                compress(m_v0, m_v1, m_v2, m_v3, detail::load_le<::std::uint64_t>(p));
+
+            m_tail = detail::load_le64_partial(p, n);
+        }
+
+        ::std::uint64_t m_v0;
+        ::std::uint64_t m_v1;
+        ::std::uint64_t m_v2;
+        ::std::uint64_t m_v3;
+        ::std::uint64_t m_tail{}; ///< Pending bytes of the current block (little-endian).
+        ::std::size_t m_len{};    ///< Total number of bytes appended.
+    };
+
+    /// @brief Computes a SipHash-c-d 64-bit hash over an arbitrary byte range.
     /// @ingroup scl_utility_hash
     ///
     /// SipHash-2-4 (2 compression rounds, 4 finalization rounds) is a fast,
@@ -69,22 +223,33 @@ namespace scl::hash
     ///
     /// It is used as the default string hash in Python (≥ 3.4), Rust, Ruby, and Perl.
     ///
+    /// The round counts are template parameters. SipHash-1-3 (`siphash<1, 3>`)
+    /// roughly halves the per-block cost and is what Rust and CPython ≥ 3.11 use
+    /// for their hash tables; it still relies on the secret key for flooding
+    /// resistance.
+    ///
     /// The algorithm processes input in 8-byte (64-bit) little-endian blocks:
     /// @code
-    ///   // Compression (c = 2 rounds per block):
+    ///   // Compression (C rounds per block):
     ///   v3 ^= block;
-    ///   SipRound × 2;
+    ///   SipRound × C;
     ///   v0 ^= block;
     ///
-    ///   // Finalization (d = 4 rounds):
+    ///   // Finalization (D rounds):
     ///   v2 ^= 0xff;
-    ///   SipRound × 4;
+    ///   SipRound × D;
     ///   return v0 ^ v1 ^ v2 ^ v3;
     /// @endcode
     ///
     /// The function is `constexpr`, allowing compile-time hash computation.
+    /// At run time, contiguous ranges of byte-sized elements (`std::string_view`,
+    /// `std::string`, `std::span<char const>`, arrays, ...) are hashed with
+    /// unaligned 64-bit loads instead of the byte-by-byte loop; both paths
+    /// produce identical digests.
     ///
-    /// @tparam Range  Any type satisfying `std::ranges::range` whose elements
+    /// @tparam C      Compression rounds per block. Defaults to `2`.
+    /// @tparam D      Finalization rounds. Defaults to `4`.
+    /// @tparam Range  Any type satisfying `std::ranges::input_range` whose elements
     ///                are convertible to `std::uint8_t` — e.g. a string literal,
     ///                `std::string_view`, `std::string`, `std::span<std::byte>`.
     /// @param  range  Input range to hash.
@@ -92,83 +257,175 @@ namespace scl::hash
     ///         hash. Use `std::string_view{"hello"}` to hash only the characters.
     /// @param  key    128-bit secret key. Defaults to @ref siphash_default_key.
     ///                For security-sensitive use, provide a randomly generated key.
-    /// @return 64-bit SipHash-2-4 digest.
+    /// @return 64-bit SipHash-c-d digest (SipHash-2-4 by default).
     ///
     /// @par Compile-time example
     /// @code
     /// constexpr scl::hash::siphash_key my_key{0xdeadbeefcafeull, 0xabad1deaull};
     /// constexpr auto h = scl::hash::siphash("hello", my_key);
     /// static_assert(h != 0);
+    ///
+    /// constexpr auto fast = scl::hash::siphash<1, 3>("hello", my_key); // SipHash-1-3
     /// @endcode
     ///
     /// @see https://www.131002.net/siphash/ — original paper and reference vectors
-    template <::std::ranges::range Range>
-    constexpr ::std::uint64_t siphash(Range const & range, siphash_key const key = siphash_default_key)
+    template <::std::size_t C = 2, ::std::size_t D = 4, ::std::ranges::input_range Range>
+    constexpr ::std::uint64_t siphash(Range && range, siphash_key const key = siphash_default_key)
         requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
     {
-        // State initialised from key XOR'd with magic constants spelling
-        // "somepseudorandomlygeneratedbytes".
-        ::std::uint64_t v0 = key.k0 ^ 0x736f6d6570736575ull;
-        ::std::uint64_t v1 = key.k1 ^ 0x646f72616e646f6dull;
-        ::std::uint64_t v2 = key.k0 ^ 0x6c7967656e657261ull;
-        ::std::uint64_t v3 = key.k1 ^ 0x7465646279746573ull;
-
-        ::std::uint64_t m = 0; // current 8-byte block (little-endian)
-        ::std::size_t len = 0;
-        int shift = 0; // bits filled in m (0, 8, 16, ..., 56)
-
-        for (auto const c : range)
+        return siphash_state<C, D>{key}.update(range).finalize();
+    }
+
+    /// @brief Callable wrapper around @ref siphash for use with @ref scl::hash::key.
+    /// @ingroup scl_utility_hash
+    ///
+    /// The secret key and the round counts are embedded as non-type template
+    /// parameters, so two instantiations that differ in any of them are
+    /// distinct types.
+    ///
+    /// @tparam Key  128-bit SipHash key. Defaults to @ref siphash_default_key.
+    /// @tparam C    Compression rounds per block. Defaults to `2`.
+    /// @tparam D    Finalization rounds. Defaults to `4`.
+    template <siphash_key Key = siphash_default_key, ::std::size_t C = 2, ::std::size_t D = 4>
+    struct siphash_hasher
+    {
+        using result_type = ::std::uint64_t;
+        using state_type = siphash_state<C, D>;
+
+        template <::std::ranges::input_range Range>
+        constexpr result_type operator()(Range && range) const noexcept
+            requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
         {
-            m |= static_cast<::std::uint64_t>(static_cast<::std::uint8_t>(c)) << shift;
-            shift += 8;
-            ++len;
+            return ::scl::hash::siphash<C, D>(range, Key);
+        }
 
-            if (shift == 64) // full 8-byte block ready
-            {
-                v3 ^= m;
-                detail::sip_round(v0, v1, v2, v3); // c = 2
+        /// @brief Returns a fresh streaming state keyed with @p Key.
+        constexpr state_type make_state() const noexcept { return state_type{Key}; }
+    };
+
+    /// @brief SipHash-1-3 streaming state: one compression and three finalization rounds.
+    /// @ingroup scl_utility_hash
+    using siphash13_state = siphash_state<1, 3>;
+
+    /// @brief SipHash-1-3 hasher for @ref scl::hash::key and hash tables.
+    /// @ingroup scl_utility_hash
+    ///
+    /// About twice as fast per 8-byte block as SipHash-2-4; this is the variant
+    /// Rust and CPython use for their hash tables.
+    ///
+    /// @tparam Key  128-bit SipHash key. Defaults to @ref siphash_default_key.
+    template <siphash_key Key = siphash_default_key>
+    using siphash13_hasher = siphash_hasher<Key, 1, 3>;
+
+    /// @brief Incremental SipHash-c-d-128 state: the 128-bit output variant of @ref siphash_state.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Compression is shared with @ref siphash_state; only the initial state
+    /// (`v1 ^= 0xee`) and the finalization, which squeezes a second 64-bit
+    /// word, differ. @ref finalize works on a copy of the state; more bytes
+    /// may be appended afterwards.
+    ///
+    /// @tparam C  Compression rounds per 8-byte block (2 for SipHash-2-4).
+    /// @tparam D  Finalization rounds per output word (4 for SipHash-2-4).
+    template <::std::size_t C = 2, ::std::size_t D = 4>
+    struct siphash128_state
+    {
+        using result_type = uint128;
+
+        /// @brief Starts a new message keyed with @p key.
+        constexpr explicit siphash128_state(siphash_key const key = siphash_default_key) noexcept
+            : m_state{key}
+        {
+            m_state.m_v1 ^= 0xeeull;
+        }
+
+        /// @brief Appends @p range to the message.
+        template <::std::ranges::input_range Range>
+        constexpr siphash128_state & update(Range && range) noexcept
+            requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+        {
+            m_state.update(range);
+            return *this;
+        }
+
+        /// @brief Returns the digest of all bytes appended so far.
+        constexpr result_type finalize() const noexcept
+        {
+            ::std::uint64_t v0 = 0;
+            ::std::uint64_t v1 = 0;
+            ::std::uint64_t v2 = 0;
+            ::std::uint64_t v3 = 0;
+            m_state.absorb_last(v0, v1, v2, v3);
+
+            v2 ^= 0xeeull;
+            for (::std::size_t i = 0; i < D; ++i)
                 detail::sip_round(v0, v1, v2, v3);
-                v0 ^= m;
-                m = 0;
-                shift = 0;
-            }
+            ::std::uint64_t const lo = v0 ^ v1 ^ v2 ^ v3;
+
+            v1 ^= 0xddull;
+            for (::std::size_t i = 0; i < D; ++i)
+                detail::sip_round(v0, v1, v2, v3);
+            return {.lo = lo, .hi = v0 ^ v1 ^ v2 ^ v3};
         }
 
-        // Last (partial) block: high byte encodes message length mod 256.
-        m |= static_cast<::std::uint64_t>(len & 0xffull) << 56;
-        v3 ^= m;
-        detail::sip_round(v0, v1, v2, v3); // c = 2
-        detail::sip_round(v0, v1, v2, v3);
-        v0 ^= m;
-
-        // Finalization: d = 4 rounds.
-        v2 ^= 0xffull;
-        detail::sip_round(v0, v1, v2, v3);
-        detail::sip_round(v0, v1, v2, v3);
-        detail::sip_round(v0, v1, v2, v3);
-        detail::sip_round(v0, v1, v2, v3);
-
-        return v0 ^ v1 ^ v2 ^ v3;
-    }
+    private:
+        siphash_state<C, D> m_state;
+    };
 
-    /// @brief Callable wrapper around @ref siphash for use with @ref scl::hash::key.
+    /// @brief Computes a SipHash-c-d 128-bit hash over an arbitrary byte range.
     /// @ingroup scl_utility_hash
     ///
-    /// The secret key is embedded as a non-type template parameter, so two
-    /// instantiations with different keys are distinct types.
+    /// The 128-bit output mode of SipHash from the reference implementation:
+    /// the same compression as @ref siphash, with `v1 ^= 0xee` at start-up and
+    /// two rounds of squeezing at the end:
+    /// @code
+    ///   v2 ^= 0xee; SipRound × D; lo = v0 ^ v1 ^ v2 ^ v3;
+    ///   v1 ^= 0xdd; SipRound × D; hi = v0 ^ v1 ^ v2 ^ v3;
+    /// @endcode
+    /// It costs D more rounds than the 64-bit digest and is still keyed, so
+    /// it suits collision-free identifiers for inputs an attacker may choose.
+    ///
+    /// @tparam C      Compression rounds per block. Defaults to `2`.
+    /// @tparam D      Finalization rounds per output word. Defaults to `4`.
+    /// @tparam Range  Any type satisfying `std::ranges::input_range` whose elements
+    ///                are convertible to `std::uint8_t`.
+    /// @param  range  Input range to hash.
+    /// @param  key    128-bit secret key. Defaults to @ref siphash_default_key.
+    /// @return 128-bit digest; `lo` holds output bytes 0–7 of the reference.
+    ///
+    /// @par Compile-time example
+    /// @code
+    /// constexpr auto h = scl::hash::siphash128(std::string_view{});
+    /// static_assert(h.lo == 0xe6a825ba047f81a3ull); // reference vector 0
+    /// @endcode
+    template <::std::size_t C = 2, ::std::size_t D = 4, ::std::ranges::input_range Range>
+    constexpr uint128 siphash128(Range && range, siphash_key const key = siphash_default_key)
+        requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+    {
+        return siphash128_state<C, D>{key}.update(range).finalize();
+    }
+
+    /// @brief Callable wrapper around @ref siphash128 for use with @ref scl::hash::key.
+    /// @ingroup scl_utility_hash
     ///
     /// @tparam Key  128-bit SipHash key. Defaults to @ref siphash_default_key.
-    template <siphash_key Key = siphash_default_key>
-    struct siphash_hasher
+    /// @tparam C    Compression rounds per block. Defaults to `2`.
+    /// @tparam D    Finalization rounds per output word. Defaults to `4`.
+    template <siphash_key Key = siphash_default_key, ::std::size_t C = 2, ::std::size_t D = 4>
+    struct siphash128_hasher
     {
-        using result_type = ::std::uint64_t;
+        using result_type = uint128;
+        using state_type = siphash128_state<C, D>;
 
-        template <::std::ranges::range Range>
-        constexpr result_type operator()(Range const & range) const noexcept
+        template <::std::ranges::input_range Range>
+        constexpr result_type operator()(Range && range) const noexcept
             requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
         {
-            return ::scl::hash::siphash(range, Key);
+            return ::scl::hash::siphash128<C, D>(range, Key);
         }
+
+        /// @brief Returns a fresh streaming state keyed with @p Key.
+        constexpr state_type make_state() const noexcept { return state_type{Key}; }
     };
 
 } // namespace scl::hash
@@ -0,0 +1,357 @@
+#pragma once
+
+/// @file siphash_batch.h
+/// @brief Multi-lane SipHash: hashes many short inputs at once across SIMD lanes.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/detail/load.h>
+#include <scl/utility/hash/dispatch.h>
+#include <scl/utility/hash/siphash.h>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace scl::hash
+{
+    namespace detail
+    {
+        /// @brief Returns the @p j-th SipHash block of a message of @p len bytes.
+        ///
+        /// Blocks `0 .. len / 8 - 1` are full 8-byte words; block `len / 8` is the
+        /// final block holding the trailing bytes and the length byte.
+        inline ::std::uint64_t sip_block(
+            unsigned char const * p, ::std::size_t const len, ::std::size_t const j) noexcept
+        {
+            ::std::size_t const full = len / 8;
+            if (j < full)
+                return detail::load_le<::std::uint64_t>(p + 8 * j);
+            return detail::load_le64_partial(p + 8 * full, len & 7) |
+                (static_cast<::std::uint64_t>(len & 0xffull) << 56);
+        }
+
+        /// @brief Number of SipHash compression steps (full blocks + final block).
+        constexpr ::std::size_t sip_block_count(::std::size_t const len) noexcept
+        {
+            return len / 8 + 1;
+        }
+
+        /// @brief Scalar reference: one @ref siphash call per input.
+        template <::std::size_t C, ::std::size_t D>
+        inline void siphash_batch_scalar(::std::string_view const * in,
+            ::std::uint64_t * out,
+            ::std::size_t const n,
+            siphash_key const key) noexcept
+        {
+            for (::std::size_t i = 0; i < n; ++i)
+                out[i] = ::scl::hash::siphash<C, D>(in[i], key);
+        }
+
+#if SCL_HASH_X86_64
+        /// @brief Rotates every 64-bit lane left by @p R bits.
+        template <int R>
+        SCL_HASH_TARGET("avx2")
+        inline __m256i sip_rotl_avx2(__m256i const x) noexcept
+        {
+            if constexpr (R == 32)
+                return _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+            else
+                return _mm256_or_si256(_mm256_slli_epi64(x, R), _mm256_srli_epi64(x, 64 - R));
+        }
+
+        /// @brief Broadcasts @p x to every 64-bit lane.
+        SCL_HASH_TARGET("avx2")
+        inline __m256i sip_splat_avx2(::std::uint64_t const x) noexcept
+        {
+            return _mm256_set1_epi64x(static_cast<long long>(x));
+        }
+
+        /// @brief @ref sip_round applied to four independent states at once.
+        SCL_HASH_TARGET("avx2")
+        inline void sip_round_avx2(__m256i & v0, __m256i & v1, __m256i & v2, __m256i & v3) noexcept
+        {
+            v0 = _mm256_add_epi64(v0, v1);
+            v1 = sip_rotl_avx2<13>(v1);
+            v1 = _mm256_xor_si256(v1, v0);
+            v0 = sip_rotl_avx2<32>(v0);
+            v2 = _mm256_add_epi64(v2, v3);
+            v3 = sip_rotl_avx2<16>(v3);
+            v3 = _mm256_xor_si256(v3, v2);
+            v0 = _mm256_add_epi64(v0, v3);
+            v3 = sip_rotl_avx2<21>(v3);
+            v3 = _mm256_xor_si256(v3, v0);
+            v2 = _mm256_add_epi64(v2, v1);
+            v1 = sip_rotl_avx2<17>(v1);
+            v1 = _mm256_xor_si256(v1, v2);
+            v2 = sip_rotl_avx2<32>(v2);
+        }
+
+        /// @brief Hashes inputs in groups of four with one SipHash state per 64-bit lane.
+        /// @return Number of inputs processed (a multiple of four).
+        template <::std::size_t C, ::std::size_t D>
+        SCL_HASH_TARGET("avx2")
+        inline ::std::size_t siphash_batch_avx2(::std::string_view const * in,
+            ::std::uint64_t * out,
+            ::std::size_t const n,
+            siphash_key const key) noexcept
+        {
+            constexpr ::std::size_t lanes = 4;
+            ::std::size_t done = 0;
+
+            for (; done + lanes <= n; done += lanes)
+            {
+                unsigned char const * p[lanes];
+                ::std::size_t len[lanes];
+                ::std::size_t blocks[lanes];
+                ::std::size_t min_full = ~::std::size_t{0};
+                ::std::size_t max_blocks = 0;
+                for (::std::size_t l = 0; l < lanes; ++l)
+                {
+                    p[l] = reinterpret_cast<unsigned char const *>(in[done + l].data());
+                    len[l] = in[done + l].size();
+                    blocks[l] = detail::sip_block_count(len[l]);
+                    min_full = len[l] / 8 < min_full ? len[l] / 8 : min_full;
+                    max_blocks = blocks[l] > max_blocks ? blocks[l] : max_blocks;
+                }
+
+                __m256i v0 = detail::sip_splat_avx2(key.k0 ^ 0x736f6d6570736575ull);
+                __m256i v1 = detail::sip_splat_avx2(key.k1 ^ 0x646f72616e646f6dull);
+                __m256i v2 = detail::sip_splat_avx2(key.k0 ^ 0x6c7967656e657261ull);
+                __m256i v3 = detail::sip_splat_avx2(key.k1 ^ 0x7465646279746573ull);
+
+                // Blocks that are full 8-byte words in every lane: direct loads, no masking.
+                for (::std::size_t j = 0; j < min_full; ++j)
+                {
+                    __m256i const m = _mm256_set_epi64x(
+                        static_cast<long long>(detail::load_le<::std::uint64_t>(p[3] + 8 * j)),
+                        static_cast<long long>(detail::load_le<::std::uint64_t>(p[2] + 8 * j)),
+                        static_cast<long long>(detail::load_le<::std::uint64_t>(p[1] + 8 * j)),
+                        static_cast<long long>(detail::load_le<::std::uint64_t>(p[0] + 8 * j)));
+                    v3 = _mm256_xor_si256(v3, m);
+                    for (::std::size_t r = 0; r < C; ++r)
+                        sip_round_avx2(v0, v1, v2, v3);
+                    v0 = _mm256_xor_si256(v0, m);
+                }
+
+                // Final blocks and longer lanes; finished lanes keep their state.
+                for (::std::size_t j = min_full; j < max_blocks; ++j)
+                {
+                    long long m_lane[lanes];
+                    long long active[lanes];
+                    for (::std::size_t l = 0; l < lanes; ++l)
+                    {
+                        bool const on = j < blocks[l];
+                        auto const block = on ? detail::sip_block(p[l], len[l], j) : 0;
+                        m_lane[l] = static_cast<long long>(block);
+                        active[l] = on ? -1 : 0;
+                    }
+                    __m256i const m =
+                        _mm256_set_epi64x(m_lane[3], m_lane[2], m_lane[1], m_lane[0]);
+                    __m256i const mask =
+                        _mm256_set_epi64x(active[3], active[2], active[1], active[0]);
+
+                    __m256i n0 = v0;
+                    __m256i n1 = v1;
+                    __m256i n2 = v2;
+                    __m256i n3 = _mm256_xor_si256(v3, m);
+                    for (::std::size_t r = 0; r < C; ++r)
+                        sip_round_avx2(n0, n1, n2, n3);
+                    n0 = _mm256_xor_si256(n0, m);
+
+                    v0 = _mm256_blendv_epi8(v0, n0, mask);
+                    v1 = _mm256_blendv_epi8(v1, n1, mask);
+                    v2 = _mm256_blendv_epi8(v2, n2, mask);
+                    v3 = _mm256_blendv_epi8(v3, n3, mask);
+                }
+
+                v2 = _mm256_xor_si256(v2, _mm256_set1_epi64x(0xff));
+                for (::std::size_t r = 0; r < D; ++r)
+                    sip_round_avx2(v0, v1, v2, v3);
+
+                __m256i const h =
+                    _mm256_xor_si256(_mm256_xor_si256(v0, v1), _mm256_xor_si256(v2, v3));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + done), h);
+            }
+            return done;
+        }
+
+        /// @brief Rotates every 64-bit lane left by @p R bits.
+        ///
+        /// Uses the merge-masked form with an all-ones mask: same instruction as
+        /// `_mm512_rol_epi64`, without the undefined pass-through operand that
+        /// trips `-Wmaybe-uninitialized` on GCC 12.
+        template <int R>
+        SCL_HASH_TARGET("avx512f")
+        inline __m512i sip_rotl_avx512(__m512i const x) noexcept
+        {
+            return _mm512_mask_rol_epi64(x, static_cast<__mmask8>(0xff), x, R);
+        }
+
+        /// @brief Broadcasts @p x to every 64-bit lane.
+        SCL_HASH_TARGET("avx512f")
+        inline __m512i sip_splat_avx512(::std::uint64_t const x) noexcept
+        {
+            return _mm512_set1_epi64(static_cast<long long>(x));
+        }
+
+        /// @brief @ref sip_round applied to eight independent states at once.
+        SCL_HASH_TARGET("avx512f")
+        inline void sip_round_avx512(
+            __m512i & v0, __m512i & v1, __m512i & v2, __m512i & v3) noexcept
+        {
+            v0 = _mm512_add_epi64(v0, v1);
+            v1 = sip_rotl_avx512<13>(v1);
+            v1 = _mm512_xor_si512(v1, v0);
+            v0 = sip_rotl_avx512<32>(v0);
+            v2 = _mm512_add_epi64(v2, v3);
+            v3 = sip_rotl_avx512<16>(v3);
+            v3 = _mm512_xor_si512(v3, v2);
+            v0 = _mm512_add_epi64(v0, v3);
+            v3 = sip_rotl_avx512<21>(v3);
+            v3 = _mm512_xor_si512(v3, v0);
+            v2 = _mm512_add_epi64(v2, v1);
+            v1 = sip_rotl_avx512<17>(v1);
+            v1 = _mm512_xor_si512(v1, v2);
+            v2 = sip_rotl_avx512<32>(v2);
+        }
+
+        /// @brief Hashes inputs in groups of eight with one SipHash state per 64-bit lane.
+        /// @return Number of inputs processed (a multiple of eight).
+        template <::std::size_t C, ::std::size_t D>
+        SCL_HASH_TARGET("avx512f")
+        inline ::std::size_t siphash_batch_avx512(::std::string_view const * in,
+            ::std::uint64_t * out,
+            ::std::size_t const n,
+            siphash_key const key) noexcept
+        {
+            constexpr ::std::size_t lanes = 8;
+            ::std::size_t done = 0;
+
+            for (; done + lanes <= n; done += lanes)
+            {
+                unsigned char const * p[lanes];
+                ::std::size_t len[lanes];
+                ::std::size_t blocks[lanes];
+                ::std::size_t min_full = ~::std::size_t{0};
+                ::std::size_t max_blocks = 0;
+                for (::std::size_t l = 0; l < lanes; ++l)
+                {
+                    p[l] = reinterpret_cast<unsigned char const *>(in[done + l].data());
+                    len[l] = in[done + l].size();
+                    blocks[l] = detail::sip_block_count(len[l]);
+                    min_full = len[l] / 8 < min_full ? len[l] / 8 : min_full;
+                    max_blocks = blocks[l] > max_blocks ? blocks[l] : max_blocks;
+                }
+
+                __m512i v0 = detail::sip_splat_avx512(key.k0 ^ 0x736f6d6570736575ull);
+                __m512i v1 = detail::sip_splat_avx512(key.k1 ^ 0x646f72616e646f6dull);
+                __m512i v2 = detail::sip_splat_avx512(key.k0 ^ 0x6c7967656e657261ull);
+                __m512i v3 = detail::sip_splat_avx512(key.k1 ^ 0x7465646279746573ull);
+
+                // Blocks that are full 8-byte words in every lane: direct loads, no masking.
+                for (::std::size_t j = 0; j < min_full; ++j)
+                {
+                    alignas(64) ::std::uint64_t m_lane[lanes];
+                    for (::std::size_t l = 0; l < lanes; ++l)
+                        m_lane[l] = detail::load_le<::std::uint64_t>(p[l] + 8 * j);
+                    __m512i const m = _mm512_load_si512(m_lane);
+                    v3 = _mm512_xor_si512(v3, m);
+                    for (::std::size_t r = 0; r < C; ++r)
+                        sip_round_avx512(v0, v1, v2, v3);
+                    v0 = _mm512_xor_si512(v0, m);
+                }
+
+                // Final blocks and longer lanes; finished lanes keep their state.
+                for (::std::size_t j = min_full; j < max_blocks; ++j)
+                {
+                    alignas(64) ::std::uint64_t m_lane[lanes];
+                    __mmask8 active = 0;
+                    for (::std::size_t l = 0; l < lanes; ++l)
+                    {
+                        bool const on = j < blocks[l];
+                        m_lane[l] = on ? detail::sip_block(p[l], len[l], j) : 0;
+                        active = static_cast<__mmask8>(active | (on ? 1u << l : 0u));
+                    }
+                    __m512i const m = _mm512_load_si512(m_lane);
+
+                    __m512i n0 = v0;
+                    __m512i n1 = v1;
+                    __m512i n2 = v2;
+                    __m512i n3 = _mm512_xor_si512(v3, m);
+                    for (::std::size_t r = 0; r < C; ++r)
+                        sip_round_avx512(n0, n1, n2, n3);
+                    n0 = _mm512_xor_si512(n0, m);
+
+                    v0 = _mm512_mask_mov_epi64(v0, active, n0);
+                    v1 = _mm512_mask_mov_epi64(v1, active, n1);
+                    v2 = _mm512_mask_mov_epi64(v2, active, n2);
+                    v3 = _mm512_mask_mov_epi64(v3, active, n3);
+                }
+
+                v2 = _mm512_xor_si512(v2, _mm512_set1_epi64(0xff));
+                for (::std::size_t r = 0; r < D; ++r)
+                    sip_round_avx512(v0, v1, v2, v3);
+
+                __m512i const h =
+                    _mm512_xor_si512(_mm512_xor_si512(v0, v1), _mm512_xor_si512(v2, v3));
+                _mm512_storeu_si512(out + done, h);
+            }
+            return done;
+        }
+#endif // SCL_HASH_X86_64
+    } // namespace detail
+
+    /// @brief Computes SipHash-c-d digests of many inputs at once.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Interleaves independent SipHash states across SIMD lanes — eight with
+    /// AVX-512F, four with AVX2 — so that the rounds of different inputs run in
+    /// parallel instead of waiting on the serial `sip_round` dependency chain of
+    /// a single input. Lanes whose input ends early keep their state while
+    /// longer inputs in the same group continue; inputs left over after the
+    /// last full group go to the narrower kernel and finally to the scalar
+    /// @ref siphash. The kernels are chosen at run time by
+    /// @ref active_simd_level, so no compiler flags are needed; on CPUs
+    /// without AVX2 the whole batch is hashed with the scalar function.
+    ///
+    /// Every output is bit-identical to `siphash<C, D>(inputs[i], key)`. Batches
+    /// of short inputs of similar length benefit most.
+    ///
+    /// @tparam C       Compression rounds per block. Defaults to `2`.
+    /// @tparam D       Finalization rounds. Defaults to `4`.
+    /// @param  inputs  Byte strings to hash.
+    /// @param  out     Receives `inputs.size()` digests;
+    ///                 must satisfy `out.size() >= inputs.size()`.
+    /// @param  key     128-bit secret key. Defaults to @ref siphash_default_key.
+    ///
+    /// @code
+    /// std::vector<std::string_view> ids = ...;
+    /// std::vector<std::uint64_t> digests(ids.size());
+    /// scl::hash::siphash_batch(ids, digests, my_key);
+    /// @endcode
+    template <::std::size_t C = 2, ::std::size_t D = 4>
+    inline void siphash_batch(::std::span<::std::string_view const> const inputs,
+        ::std::span<::std::uint64_t> const out,
+        siphash_key const key = siphash_default_key) noexcept
+    {
+        assert(out.size() >= inputs.size());
+
+        ::std::string_view const * const in = inputs.data();
+        ::std::uint64_t * const dst = out.data();
+        ::std::size_t const n = inputs.size();
+        ::std::size_t done = 0;
+
+#if SCL_HASH_X86_64
+        simd_level const level = ::scl::hash::active_simd_level();
+        if (level >= simd_level::avx512)
+            done += detail::siphash_batch_avx512<C, D>(in + done, dst + done, n - done, key);
+        if (level >= simd_level::avx2)
+            done += detail::siphash_batch_avx2<C, D>(in + done, dst + done, n - done, key);
+#endif
+
+        detail::siphash_batch_scalar<C, D>(in + done, dst + done, n - done, key);
+    }
+
+} // namespace scl::hash
@@ -0,0 +1,220 @@
+#pragma once
+
+/// @file siphash_runtime.h
+/// @brief SipHash keyed with a per-process random key for flooding-resistant hash tables.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/mix.h>
+#include <scl/utility/hash/siphash.h>
+
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <random>
+#include <ranges>
+#include <thread>
+
+/**
+ * @def SCL_HASH_GETRANDOM
+ * @brief `1` when `getrandom(2)` is available to seed @ref scl::hash::runtime_siphash_key.
+ * @ingroup scl_utility_hash
+ */
+#if defined(__linux__) && __has_include(<sys/random.h>)
+#include <cerrno>
+#include <sys/random.h>
+#define SCL_HASH_GETRANDOM 1
+#else
+#define SCL_HASH_GETRANDOM 0
+#endif
+
+/**
+ * @def SCL_HASH_ARC4RANDOM
+ * @brief `1` when `arc4random_buf(3)` is available (BSD and Apple platforms).
+ * @ingroup scl_utility_hash
+ */
+#if !SCL_HASH_GETRANDOM \
+    && (defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__NetBSD__))
+#include <stdlib.h>
+#define SCL_HASH_ARC4RANDOM 1
+#else
+#define SCL_HASH_ARC4RANDOM 0
+#endif
+
+namespace scl::hash
+{
+    namespace detail
+    {
+        /// @brief Draws a SipHash key from the operating system's CSPRNG.
+        ///
+        /// Uses `getrandom(2)` on Linux and `arc4random_buf(3)` on the BSDs and
+        /// Apple platforms, falling back to `std::random_device`. If every
+        /// source fails, the clock and an address are mixed in so the key is
+        /// at least not the public default.
+        inline siphash_key os_random_siphash_key() noexcept
+        {
+            ::std::uint64_t words[2]{};
+#if SCL_HASH_GETRANDOM
+            auto * bytes = reinterpret_cast<unsigned char *>(words);
+            ::std::size_t filled = 0;
+            while (filled < sizeof(words))
+            {
+                auto const n = ::getrandom(bytes + filled, sizeof(words) - filled, 0);
+                if (n > 0)
+                    filled += static_cast<::std::size_t>(n);
+                else if (errno != EINTR)
+                    break;
+            }
+            if (filled == sizeof(words))
+                return siphash_key{words[0], words[1]};
+#elif SCL_HASH_ARC4RANDOM
+            ::arc4random_buf(words, sizeof(words));
+            return siphash_key{words[0], words[1]};
+#endif
+            try
+            {
+                ::std::random_device device;
+                for (auto & w : words)
+                    w = (::std::uint64_t{device()} << 32) | device();
+                return siphash_key{words[0], words[1]};
+            }
+            catch (::std::exception const &)
+            {
+                auto const now = static_cast<::std::uint64_t>(
+                    ::std::chrono::high_resolution_clock::now().time_since_epoch().count());
+                auto const where =
+                    static_cast<::std::uint64_t>(reinterpret_cast<::std::uintptr_t>(&words));
+                return siphash_key{
+                    fmix64_mixer{}(now ^ where), fmix64_mixer{}(now + 0x9e3779b97f4a7c15ull)};
+            }
+        }
+
+        /// @brief The process-wide key, alone on its cache line.
+        ///
+        /// Constant-initialised to zero — no dynamic initialiser, no guard
+        /// variable. @ref runtime_siphash_key seeds it on first use: `state`
+        /// goes from `0` (unseeded) through `1` (being seeded) to `2` (ready),
+        /// and the key words are published by the release store of `2`.
+        /// After that the line is only read, so it stays shared in every
+        /// core's cache; the padding keeps unrelated writes from evicting it.
+        struct alignas(64) runtime_key_cell
+        {
+            ::std::atomic<::std::uint64_t> k0{0};
+            ::std::atomic<::std::uint64_t> k1{0};
+            ::std::atomic<::std::uint32_t> state{0};
+        };
+        static_assert(sizeof(runtime_key_cell) == 64);
+
+        inline constinit runtime_key_cell runtime_key{};
+
+        /// @brief Slow path of @ref runtime_siphash_key: seeds the key, or waits for the thread that does.
+        [[gnu::noinline]] inline void seed_runtime_key() noexcept
+        {
+            ::std::uint32_t expected = 0;
+            if (runtime_key.state.compare_exchange_strong(expected, 1, ::std::memory_order_acquire))
+            {
+                auto const k = detail::os_random_siphash_key();
+                runtime_key.k0.store(k.k0, ::std::memory_order_relaxed);
+                runtime_key.k1.store(k.k1, ::std::memory_order_relaxed);
+                runtime_key.state.store(2, ::std::memory_order_release);
+                return;
+            }
+            while (runtime_key.state.load(::std::memory_order_acquire) != 2)
+                ::std::this_thread::yield();
+        }
+    } // namespace detail
+
+    /// @brief Returns the process-wide random SipHash key, seeding it on first call.
+    /// @ingroup scl_utility_hash
+    ///
+    /// The key is drawn from the OS CSPRNG (`getrandom(2)` on Linux) the first
+    /// time any thread asks for it; concurrent first callers all observe the
+    /// same key. Every later call is one acquire load and a predictable
+    /// branch on a read-only cache line — no function-local static and no
+    /// `__cxa_guard` call. Nothing runs during static initialisation, so
+    /// programs that never hash pay nothing.
+    inline siphash_key runtime_siphash_key() noexcept
+    {
+        if (detail::runtime_key.state.load(::std::memory_order_acquire) != 2) [[unlikely]]
+            detail::seed_runtime_key();
+        return siphash_key{detail::runtime_key.k0.load(::std::memory_order_relaxed),
+            detail::runtime_key.k1.load(::std::memory_order_relaxed)};
+    }
+
+    /// @brief Returns a fresh random SipHash key that is independent of @ref runtime_siphash_key.
+    /// @ingroup scl_utility_hash
+    inline siphash_key random_siphash_key() noexcept { return detail::os_random_siphash_key(); }
+
+    /// @brief SipHash-c-d hasher keyed at run time, for hash tables fed attacker-controlled keys.
+    /// @ingroup scl_utility_hash
+    ///
+    /// @ref siphash_hasher embeds its key in the type, and the default key is
+    /// a public test vector, so an attacker can precompute colliding inputs.
+    /// This hasher carries the key as a data member instead. A
+    /// default-constructed hasher copies @ref runtime_siphash_key, seeding it
+    /// on first use; @ref with_random_key gives one container its own key.
+    ///
+    /// The key is read once, when the hasher — and so the container holding
+    /// it — is constructed. Hashing only reads the member: no global load,
+    /// no initialisation check.
+    ///
+    /// @code
+    /// // Shared process key.
+    /// std::unordered_map<std::string, int, scl::hash::siphash_runtime_hasher<>> a;
+    ///
+    /// // Own key for this table.
+    /// using hasher = scl::hash::siphash_runtime_hasher<>;
+    /// std::unordered_map<std::string, int, hasher> b{0, hasher::with_random_key()};
+    /// @endcode
+    ///
+    /// Digests differ between processes: do not persist them or use this
+    /// hasher for @ref scl::hash::key values that must match across runs.
+    ///
+    /// @tparam C  Compression rounds per block. Defaults to `2`.
+    /// @tparam D  Finalization rounds. Defaults to `4`.
+    template <::std::size_t C = 2, ::std::size_t D = 4>
+    struct siphash_runtime_hasher
+    {
+        using result_type = ::std::uint64_t;
+        using state_type = siphash_state<C, D>;
+
+        /// @brief Keys the hasher with the process-wide @ref runtime_siphash_key.
+        siphash_runtime_hasher() noexcept
+            : m_key{scl::hash::runtime_siphash_key()}
+        {}
+
+        /// @brief Keys the hasher with @p key, e.g. one restored from configuration.
+        constexpr explicit siphash_runtime_hasher(siphash_key const key) noexcept
+            : m_key{key}
+        {}
+
+        /// @brief Returns a hasher with a freshly drawn key of its own.
+        static siphash_runtime_hasher with_random_key() noexcept
+        {
+            return siphash_runtime_hasher{scl::hash::random_siphash_key()};
+        }
+
+        template <::std::ranges::input_range Range>
+        constexpr result_type operator()(Range && range) const noexcept
+            requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+        {
+            return ::scl::hash::siphash<C, D>(range, m_key);
+        }
+
+        /// @brief Returns a fresh streaming state keyed with this hasher's key.
+        constexpr state_type make_state() const noexcept { return state_type{m_key}; }
+
+        /// @brief Returns the key this hasher was constructed with.
+        constexpr siphash_key secret() const noexcept { return m_key; }
+
+    private:
+        siphash_key m_key;
+    };
+
+    /// @brief SipHash-1-3 keyed at run time; see @ref siphash_runtime_hasher.
+    /// @ingroup scl_utility_hash
+    using siphash13_runtime_hasher = siphash_runtime_hasher<1, 3>;
+
+} // namespace scl::hash
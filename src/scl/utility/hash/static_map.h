@@ -0,0 +1,195 @@
+#pragma once
+
+/// @file static_map.h
+/// @brief Compile-time perfect-hash lookup tables keyed by @ref scl::hash::key.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/detail/perfect_hash.h>
+#include <scl/utility/hash/key.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+namespace scl::hash
+{
+    /// @brief One `{name, value}` pair of a @ref static_map.
+    /// @ingroup scl_utility_hash
+    template <typename Value>
+    struct static_map_entry
+    {
+        ::std::string_view name;
+        Value value;
+    };
+
+    namespace detail
+    {
+        // Called only when building a static_map fails; being non-constexpr,
+        // each turns the failure into a compile error that names it.
+
+        /// @brief Two entries of a @ref static_map have the same name.
+        inline void static_map_error_duplicate_name() noexcept {}
+
+        /// @brief Two different names of a @ref static_map have the same digest; use a wider hasher.
+        inline void static_map_error_digest_collision() noexcept {}
+
+        /// @brief Perfect hash of a @ref static_map and its digests, indexed by slot.
+        template <typename Digest, ::std::size_t N>
+        struct static_map_layout
+        {
+            perfect_hash_layout<N> placement;
+            ::std::array<Digest, N> digests{};
+        };
+
+        /// @brief Hashes the names of @p entries, rejects duplicates and collisions, and places them.
+        template <concepts::byte_hasher Hasher, typename Value, ::std::size_t N>
+        consteval auto make_static_map_layout(static_map_entry<Value> const (&entries)[N])
+        {
+            using digest_type = typename Hasher::result_type;
+            ::std::array<digest_type, N> digests{};
+            ::std::array<::std::uint64_t, N> words{};
+            for (::std::size_t i = 0; i < N; ++i)
+            {
+                digests[i] = Hasher{}(entries[i].name);
+                words[i] = detail::perfect_hash_word<Hasher>(digests[i]);
+            }
+
+            ::std::array<::std::size_t, N> by_word{};
+            for (::std::size_t i = 0; i < N; ++i)
+                by_word[i] = i;
+            ::std::sort(by_word.begin(), by_word.end(),
+                [&](auto const a, auto const b) { return words[a] < words[b]; });
+            for (::std::size_t i = 1; i < N; ++i)
+            {
+                auto const a = by_word[i - 1];
+                auto const b = by_word[i];
+                if (entries[a].name == entries[b].name)
+                    detail::static_map_error_duplicate_name();
+                else if (words[a] == words[b])
+                    detail::static_map_error_digest_collision();
+            }
+
+            static_map_layout<digest_type, N> layout;
+            layout.placement = detail::make_perfect_hash(words);
+            for (::std::size_t slot = 0; slot < N; ++slot)
+                layout.digests[slot] = digests[layout.placement.order[slot]];
+            return layout;
+        }
+    } // namespace detail
+
+    /// @brief Immutable string-keyed lookup table with a perfect hash found at compile time.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Built by @ref make_static_map from `{"name", value}` pairs. The
+    /// constructor is `consteval`: it hashes every name with @p Hasher, checks
+    /// that names and digests are distinct, and runs a hash-and-displace
+    /// (CHD) search for a minimal perfect hash — `N` entries in `N` slots,
+    /// one 32-bit displacement per two entries. A duplicate name or a digest
+    /// collision is a compile error naming
+    /// `static_map_error_duplicate_name` or `static_map_error_digest_collision`.
+    ///
+    /// A `constexpr` map is constant-initialised into read-only data: no
+    /// startup cost, no allocation. A lookup is one hash, one displacement
+    /// load and one slot probe; @ref find by name then compares the stored
+    /// name, @ref find by @ref key compares only the digest.
+    ///
+    /// @code
+    /// constexpr auto mime = scl::hash::make_static_map<int>({
+    ///     {"text/html", 1},
+    ///     {"image/png", 2},
+    ///     {"application/json", 3},
+    /// });
+    /// static_assert(mime.find("image/png")->value == 2);
+    ///
+    /// if (auto const it = mime.find(content_type); it != mime.end())
+    ///     handle(it->value);
+    /// @endcode
+    ///
+    /// @tparam Value   Mapped type; must be usable in constant expressions.
+    /// @tparam N       Number of entries.
+    /// @tparam Hasher  A @ref concepts::byte_hasher. Defaults to `siphash_hasher<>`, as @ref key does.
+    template <typename Value, ::std::size_t N, concepts::byte_hasher Hasher = siphash_hasher<>>
+    struct static_map
+    {
+        using key_type = key<Hasher>;
+        using mapped_type = Value;
+        using value_type = static_map_entry<Value>;
+        using size_type = ::std::size_t;
+        using const_iterator = value_type const *;
+
+        /// @brief Builds the table; fails to compile on duplicate names or colliding digests.
+        consteval explicit static_map(value_type const (&entries)[N])
+            : static_map{entries, detail::make_static_map_layout<Hasher>(entries),
+                  ::std::make_index_sequence<N>{}}
+        {}
+
+        /// @brief Returns the entry named @p name, or @ref end.
+        constexpr const_iterator find(::std::string_view const name) const noexcept
+        {
+            auto const it = find(key_type{name});
+            return it != end() && it->name == name ? it : end();
+        }
+
+        /// @brief Returns the entry whose name has digest @p k, or @ref end;
+        ///        the name itself is not compared.
+        constexpr const_iterator find(key_type const k) const noexcept
+        {
+            if constexpr (N == 0)
+                return end();
+            else
+            {
+                auto const slot = m_hash(detail::perfect_hash_word<Hasher>(k.value));
+                return m_digests[slot] == k.value ? m_entries.data() + slot : end();
+            }
+        }
+
+        /// @brief Returns `true` if an entry is named @p name.
+        constexpr bool contains(::std::string_view const name) const noexcept
+        {
+            return find(name) != end();
+        }
+
+        constexpr size_type size() const noexcept { return N; }
+        constexpr bool empty() const noexcept { return N == 0; }
+
+        /// @brief Iteration visits the entries in slot order, not in construction order.
+        constexpr const_iterator begin() const noexcept { return m_entries.data(); }
+        constexpr const_iterator end() const noexcept { return m_entries.data() + N; }
+
+    private:
+        using layout_type = detail::static_map_layout<typename Hasher::result_type, N>;
+
+        template <::std::size_t... I>
+        consteval static_map(value_type const (&entries)[N],
+            layout_type const & layout,
+            ::std::index_sequence<I...>)
+            : m_hash{layout.placement.hash}
+            , m_digests{layout.digests}
+            , m_entries{{entries[layout.placement.order[I]]...}}
+        {}
+
+        detail::perfect_hash<N> m_hash;
+        ::std::array<typename Hasher::result_type, N> m_digests;
+        ::std::array<value_type, N> m_entries;
+    };
+
+    /// @brief Builds a @ref static_map from a braced list of `{"name", value}` pairs.
+    /// @ingroup scl_utility_hash
+    ///
+    /// @code
+    /// constexpr auto opcodes =
+    ///     scl::hash::make_static_map<std::uint8_t>({{"nop", 0}, {"add", 1}, {"jmp", 2}});
+    /// using fast = scl::hash::xxh3_hasher<>;
+    /// constexpr auto fields = scl::hash::make_static_map<int, fast>({{"id", 1}, {"name", 2}});
+    /// @endcode
+    template <typename Value, concepts::byte_hasher Hasher = siphash_hasher<>, ::std::size_t N>
+    consteval static_map<Value, N, Hasher>
+    make_static_map(static_map_entry<Value> const (&entries)[N])
+    {
+        return static_map<Value, N, Hasher>{entries};
+    }
+
+} // namespace scl::hash
@@ -0,0 +1,187 @@
+#pragma once
+
+/// @file transparent.h
+/// @brief Transparent hash and equality for heterogeneous lookup in string-keyed unordered containers.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/key.h>
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+namespace scl::hash
+{
+    /// @brief A `string_view` together with its @ref key, hashed once and reused for any number of lookups.
+    /// @ingroup scl_utility_hash
+    ///
+    /// @ref transparent_hash takes the stored digest instead of hashing the
+    /// text again, and @ref transparent_equal compares the text, so a
+    /// lookup touches the bytes only in the final comparison.
+    ///
+    /// @code
+    /// scl::hash::key_view<> const route{path};          // hashed once
+    /// auto const a = handlers.find(route);              // no re-hash, no std::string
+    /// auto const b = metrics.find(route);
+    /// @endcode
+    ///
+    /// @tparam Hasher  A @ref concepts::byte_hasher. Defaults to `siphash_hasher<>`, as @ref key does.
+    template <concepts::byte_hasher Hasher = siphash_hasher<>>
+    struct key_view
+    {
+        using key_type = ::scl::hash::key<Hasher>;
+
+        /// @brief Hashes @p text.
+        constexpr explicit key_view(::std::string_view const text) noexcept
+            : m_key{text}
+            , m_text{text}
+        {}
+
+        /// @brief Pairs @p text with its already computed digest @p k; `k` must equal `key_type{text}`.
+        constexpr key_view(key_type const k, ::std::string_view const text) noexcept
+            : m_key{k}
+            , m_text{text}
+        {}
+
+        constexpr key_type key() const noexcept { return m_key; }
+        constexpr ::std::string_view view() const noexcept { return m_text; }
+
+    private:
+        key_type m_key;
+        ::std::string_view m_text;
+    };
+
+    namespace detail
+    {
+        template <typename T>
+        inline constexpr bool is_key_v = false;
+
+        template <typename Hasher>
+        inline constexpr bool is_key_v<key<Hasher>> = true;
+    } // namespace detail
+
+    namespace concepts
+    {
+        /// @brief Concept satisfied by text that carries its own @ref scl::hash::key:
+        ///        `key()` and `view()` members, as in @ref scl::hash::key_view.
+        /// @ingroup scl_utility_hash
+        // clang-format off
+        template <typename T>
+        concept keyed_text = requires(T const & t) {
+            requires detail::is_key_v<::std::remove_cvref_t<decltype(t.key())>>;
+            { t.view() } -> ::std::convertible_to<::std::string_view>;
+        };
+        // clang-format on
+    } // namespace concepts
+
+    namespace detail
+    {
+        /// @brief The @ref key type carried by keyed text @p T.
+        template <concepts::keyed_text T>
+        using text_key_t = ::std::remove_cvref_t<decltype(::std::declval<T const &>().key())>;
+
+        /// @brief Plain text: `std::string`, `std::string_view`, `const char *` and the like.
+        template <typename T>
+        concept transparent_text = ::std::convertible_to<T const &, ::std::string_view>
+            && !concepts::keyed_text<T> && !is_key_v<T>;
+
+        template <typename T>
+        concept transparent_operand = transparent_text<T> || concepts::keyed_text<T> || is_key_v<T>;
+
+        /// @brief @p a == @p b for @p a a key or keyed text; @p b any @ref transparent_operand.
+        template <typename A, typename B>
+        constexpr bool transparent_equal_to(A const & a, B const & b) noexcept
+        {
+            if constexpr (is_key_v<A>)
+            {
+                if constexpr (is_key_v<B>)
+                    return a == b;
+                else if constexpr (concepts::keyed_text<B>)
+                    return a == b.key();
+                else
+                    return a == A{::std::string_view{b}};
+            }
+            else if constexpr (is_key_v<B>)
+                return detail::transparent_equal_to(b, a);
+            else if constexpr (concepts::keyed_text<B>)
+                return a.key() == b.key()
+                    && ::std::string_view{a.view()} == ::std::string_view{b.view()};
+            else
+                return ::std::string_view{a.view()} == ::std::string_view{b};
+        }
+    } // namespace detail
+
+    /// @brief Transparent hash for `std::unordered_map<std::string, V>`: hashes text through @ref key.
+    /// @ingroup scl_utility_hash
+    ///
+    /// `std::unordered_map<std::string, V>::find` with a `std::string_view`
+    /// or `const char *` builds a temporary `std::string` — an allocation for
+    /// anything longer than the short-string buffer — unless both the hash
+    /// and the equality declare `is_transparent`. With this hash and
+    /// @ref transparent_equal, lookups accept:
+    ///
+    /// | Argument                 | Hash                    | Equality             |
+    /// |--------------------------|-------------------------|----------------------|
+    /// | `std::string`, `std::string_view`, `const char *` | hashes the bytes | compares the bytes |
+    /// | @ref key_view, @ref interned, any @ref concepts::keyed_text | stored digest | compares the bytes |
+    /// | `key<Hasher>`            | stored digest           | hashes the stored string |
+    ///
+    /// Every text hashes to `std::hash<key<Hasher>>{}(key<Hasher>{text})`,
+    /// so all argument kinds find the same entries. A bare `key<Hasher>`
+    /// carries no text: it matches the entry whose digest it is, so two
+    /// strings sharing a digest are indistinguishable by it.
+    ///
+    /// @code
+    /// using routes = std::unordered_map<std::string, handler,
+    ///     scl::hash::transparent_hash<>, scl::hash::transparent_equal>;
+    /// routes table;
+    /// table.find(std::string_view{path});     // no std::string built
+    /// table.find("/health");
+    /// @endcode
+    ///
+    /// @tparam Hasher  A @ref concepts::byte_hasher. Defaults to `siphash_hasher<>`, as @ref key does.
+    template <concepts::byte_hasher Hasher = siphash_hasher<>>
+    struct transparent_hash
+    {
+        using is_transparent = void;
+        using key_type = key<Hasher>;
+
+        constexpr ::std::size_t operator()(::std::string_view const text) const noexcept
+        {
+            return (*this)(key_type{text});
+        }
+
+        constexpr ::std::size_t operator()(key_type const k) const noexcept
+        {
+            return ::std::hash<key_type>{}(k);
+        }
+
+        template <concepts::keyed_text T>
+            requires ::std::same_as<detail::text_key_t<T>, key_type>
+        constexpr ::std::size_t operator()(T const & t) const noexcept
+        {
+            return (*this)(t.key());
+        }
+    };
+
+    /// @brief Transparent equality matching @ref transparent_hash: compares text, keys and keyed text.
+    /// @ingroup scl_utility_hash
+    struct transparent_equal
+    {
+        using is_transparent = void;
+
+        template <detail::transparent_operand A, detail::transparent_operand B>
+        constexpr bool operator()(A const & a, B const & b) const noexcept
+        {
+            if constexpr (detail::transparent_text<A> && detail::transparent_text<B>)
+                return ::std::string_view{a} == ::std::string_view{b};
+            else if constexpr (detail::transparent_text<A>)
+                return detail::transparent_equal_to(b, a);
+            else
+                return detail::transparent_equal_to(a, b);
+        }
+    };
+
+} // namespace scl::hash
@@ -0,0 +1,150 @@
+#pragma once
+
+/// @file tree_hash.h
+/// @brief Parallel two-level hashing of large buffers: per-chunk digests hashed into a root.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/detail/load.h>
+#include <scl/utility/hash/key.h>
+#include <scl/utility/hash/uint128.h>
+
+#include <atomic>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace scl::hash
+{
+    /// @brief Default chunk size of @ref tree_hash: 1 MiB.
+    /// @ingroup scl_utility_hash
+    inline constexpr ::std::size_t tree_hash_default_chunk_size = ::std::size_t{1} << 20;
+
+    namespace detail
+    {
+        /// @brief Appends @p v as @p Bytes little-endian bytes.
+        template <::std::size_t Bytes>
+        inline void append_le(::std::vector<unsigned char> & out, ::std::uint64_t const v)
+        {
+            for (::std::size_t i = 0; i < Bytes; ++i)
+                out.push_back(static_cast<unsigned char>(v >> (8 * i)));
+        }
+
+        /// @brief Appends a digest in its canonical little-endian byte form.
+        template <concepts::digest Digest>
+        inline void append_digest(::std::vector<unsigned char> & out, Digest const d)
+        {
+            if constexpr (::std::same_as<Digest, uint128>)
+            {
+                detail::append_le<8>(out, d.lo);
+                detail::append_le<8>(out, d.hi);
+            }
+            else
+            {
+                detail::append_le<sizeof(Digest)>(out, static_cast<::std::uint64_t>(d));
+            }
+        }
+    } // namespace detail
+
+    /// @brief Hashes a large contiguous buffer on several threads with a two-level tree.
+    /// @ingroup scl_utility_hash
+    ///
+    /// The input is cut into fixed chunks of @p chunk_size bytes (the last
+    /// one may be shorter). Worker threads claim chunks from a shared counter
+    /// and hash each with `Hasher`; the chunk digests are then hashed, in
+    /// chunk order, into the root digest. Each chunk is read by exactly one
+    /// thread, so throughput scales with cores until memory bandwidth is
+    /// exhausted — fastest for slow per-byte hashers such as FNV-1a or SipHash.
+    ///
+    /// **Digest format** (stable; independent of @p threads):
+    /// @code
+    ///   n    = max(1, ceil(size / chunk_size))         // empty input: one empty chunk
+    ///   L[i] = Hasher(bytes[i * chunk_size, min((i + 1) * chunk_size, size)))
+    ///   root = Hasher(LE(L[0]) || ... || LE(L[n - 1]) || LE64(size) || LE64(chunk_size))
+    /// @endcode
+    /// `LE(d)` is the digest's little-endian bytes (4 or 8 bytes for integral
+    /// digests; `lo` then `hi` for @ref uint128). The trailing sizes bind the
+    /// root to the chunking, so the same bytes hashed with different chunk
+    /// sizes give unrelated digests. The result is **not** equal to
+    /// `Hasher(bytes)`; it is a different function of the input that depends
+    /// only on the bytes, `Hasher` and @p chunk_size.
+    ///
+    /// Keyed hashers keep their key for both levels, so
+    /// `tree_hash<siphash_hasher<Key>>` stays a keyed PRF of the input.
+    ///
+    /// @tparam Hasher      A @ref concepts::byte_hasher, e.g. `xxh3_hasher<>`,
+    ///                     `siphash_hasher<Key>`, `xxh3_128_hasher<>`.
+    /// @tparam Range       A contiguous range of byte-sized elements — e.g.
+    ///                     `std::span<std::byte const>` over a memory-mapped file.
+    /// @param  range       Input bytes.
+    /// @param  chunk_size  Bytes per chunk; must be non-zero. Part of the digest
+    ///                     format. Defaults to @ref tree_hash_default_chunk_size.
+    /// @param  threads     Number of threads, including the calling one; `0`
+    ///                     means `std::thread::hardware_concurrency()`. Capped at
+    ///                     the number of chunks. With `1` no thread is created.
+    ///                     If the system refuses to start a thread, the
+    ///                     remaining chunks are hashed by the threads that did start.
+    /// @return Root digest of type `Hasher::result_type`.
+    ///
+    /// @code
+    /// std::span<std::byte const> const file = map_file("ingest.bin");
+    /// auto const id = scl::hash::tree_hash<scl::hash::xxh3_128_hasher<>>(file);
+    /// @endcode
+    template <concepts::byte_hasher Hasher, detail::contiguous_byte_range Range>
+    typename Hasher::result_type tree_hash(Range const & range,
+        ::std::size_t const chunk_size = tree_hash_default_chunk_size,
+        unsigned threads = 0)
+    {
+        using digest_type = typename Hasher::result_type;
+        assert(chunk_size != 0);
+
+        unsigned char const * const data = detail::byte_data(range);
+        auto const size = static_cast<::std::size_t>(::std::ranges::size(range));
+        ::std::size_t const chunks = size == 0 ? 1 : (size - 1) / chunk_size + 1;
+
+        ::std::vector<digest_type> leaves(chunks);
+        ::std::atomic<::std::size_t> next{0};
+        auto const work = [&] {
+            for (::std::size_t i; (i = next.fetch_add(1, ::std::memory_order_relaxed)) < chunks;)
+            {
+                ::std::size_t const offset = i * chunk_size;
+                ::std::size_t const len = size - offset < chunk_size ? size - offset : chunk_size;
+                leaves[i] = Hasher{}(::std::span<unsigned char const>{data + offset, len});
+            }
+        };
+
+        if (threads == 0)
+            threads = ::std::thread::hardware_concurrency();
+        if (threads == 0) // concurrency unknown
+            threads = 1;
+        ::std::size_t const helpers = (threads < chunks ? threads : chunks) - 1;
+        {
+            ::std::vector<::std::jthread> pool;
+            pool.reserve(helpers);
+            try
+            {
+                for (::std::size_t t = 0; t < helpers; ++t)
+                    pool.emplace_back(work);
+            }
+            catch (::std::system_error const &)
+            {
+                // Fewer threads than requested; the digest does not depend on it.
+            }
+            work();
+        } // joins the helpers: every leaf is written
+
+        ::std::vector<unsigned char> root;
+        root.reserve(chunks * sizeof(digest_type) + 16);
+        for (digest_type const & leaf : leaves)
+            detail::append_digest(root, leaf);
+        detail::append_le<8>(root, size);
+        detail::append_le<8>(root, chunk_size);
+        return Hasher{}(root);
+    }
+
+} // namespace scl::hash
@@ -0,0 +1,80 @@
+#pragma once
+
+/// @file uint128.h
+/// @brief Structural 128-bit unsigned digest type.
+/// @ingroup scl_utility_hash
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace scl::hash
+{
+    /// @brief 128-bit digest stored as two 64-bit halves.
+    /// @ingroup scl_utility_hash
+    ///
+    /// A plain aggregate with public members, so it is a *structural* type:
+    /// `uint128` values — and @ref scl::hash::key objects holding them — may
+    /// be used as non-type template parameters. Unlike `unsigned __int128`,
+    /// it is available on every compiler and has the same layout everywhere.
+    ///
+    /// The halves are the digest's little-endian output words: @ref lo holds
+    /// bytes 0–7 of the canonical byte-string digest, @ref hi bytes 8–15.
+    /// Ordering compares @ref hi first, i.e. the value as a 128-bit integer.
+    ///
+    /// @code
+    /// constexpr scl::hash::uint128 d{.lo = 0x0123456789abcdefull, .hi = 1};
+    /// static_assert(d > scl::hash::uint128{.lo = ~0ull, .hi = 0});
+    /// @endcode
+    struct uint128
+    {
+        ::std::uint64_t lo{}; ///< Low 64 bits.
+        ::std::uint64_t hi{}; ///< High 64 bits.
+
+        friend constexpr bool operator==(uint128 const &, uint128 const &) noexcept = default;
+
+        /// @brief Orders values as unsigned 128-bit integers.
+        friend constexpr ::std::strong_ordering operator<=>(
+            uint128 const & a, uint128 const & b) noexcept
+        {
+            if (a.hi != b.hi)
+                return a.hi <=> b.hi;
+            return a.lo <=> b.lo;
+        }
+    };
+
+    namespace detail
+    {
+        /// @brief Folds a 64-bit digest into `std::size_t`, keeping every bit on 32-bit targets.
+        constexpr ::std::size_t fold_to_size(::std::uint64_t const h) noexcept
+        {
+            if constexpr (sizeof(::std::size_t) >= sizeof(::std::uint64_t))
+                return static_cast<::std::size_t>(h);
+            else
+                return static_cast<::std::size_t>(h ^ (h >> 32));
+        }
+
+        /// @brief Folds a 128-bit digest into `std::size_t`.
+        ///
+        /// The high half is multiplied by an odd constant before it is added,
+        /// so every input bit reaches the result and structured values such
+        /// as `{x, x}` do not collapse to a constant as they would with `lo ^ hi`.
+        constexpr ::std::size_t fold_to_size(uint128 const h) noexcept
+        {
+            return detail::fold_to_size(h.lo + h.hi * 0x9e3779b97f4a7c15ull);
+        }
+    } // namespace detail
+
+} // namespace scl::hash
+
+/// @brief `std::hash` specialisation for raw 128-bit digests.
+/// @ingroup scl_utility_hash
+template <>
+struct std::hash<::scl::hash::uint128>
+{
+    constexpr ::std::size_t operator()(::scl::hash::uint128 const & v) const noexcept
+    {
+        return ::scl::hash::detail::fold_to_size(v);
+    }
+};
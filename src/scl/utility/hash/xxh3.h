@@ -0,0 +1,1024 @@
+#pragma once
+
+/// @file xxh3.h
+/// @brief XXH3-64 and XXH3-128: xxHash v3 with a striped, vectorisable accumulator loop.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/detail/load.h>
+#include <scl/utility/hash/detail/segments.h>
+#include <scl/utility/hash/detail/mul128.h>
+#include <scl/utility/hash/dispatch.h>
+#include <scl/utility/hash/uint128.h>
+#include <scl/utility/hash/xxh64.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+namespace scl::hash
+{
+    namespace detail
+    {
+        inline constexpr ::std::uint32_t xxh_prime32_1 = 0x9e3779b1u;
+        inline constexpr ::std::uint32_t xxh_prime32_2 = 0x85ebca77u;
+        inline constexpr ::std::uint32_t xxh_prime32_3 = 0xc2b2ae3du;
+
+        inline constexpr ::std::size_t xxh3_stripe_len = 64;   ///< Bytes per stripe.
+        inline constexpr ::std::size_t xxh3_secret_size = 192; ///< Default secret length.
+        inline constexpr ::std::size_t xxh3_mid_size_max = 240;
+        /// @brief Stripes between two accumulator scrambles (16 for the default secret).
+        inline constexpr ::std::size_t xxh3_stripes_per_block =
+            (xxh3_secret_size - xxh3_stripe_len) / 8;
+
+        /// @brief Default 192-byte XXH3 secret (kSecret of the reference implementation).
+        inline constexpr ::std::array<unsigned char, xxh3_secret_size> xxh3_default_secret{
+            0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c,
+            0xf7, 0x21, 0xad, 0x1c, 0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb,
+            0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f, 0xcb, 0x79, 0xe6, 0x4e,
+            0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+            0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6,
+            0x81, 0x3a, 0x26, 0x4c, 0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb,
+            0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3, 0x71, 0x64, 0x48, 0x97,
+            0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+            0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7,
+            0xc7, 0x0b, 0x4f, 0x1d, 0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31,
+            0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64, 0xea, 0xc5, 0xac, 0x83,
+            0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+            0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26,
+            0x29, 0xd4, 0x68, 0x9e, 0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc,
+            0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce, 0x45, 0xcb, 0x3a, 0x8f,
+            0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e};
+
+        /// @brief Initial values of the eight long-input accumulators.
+        inline constexpr ::std::array<::std::uint64_t, 8> xxh3_init_acc{xxh_prime32_3,
+            xxh_prime64_1,
+            xxh_prime64_2,
+            xxh_prime64_3,
+            xxh_prime64_4,
+            xxh_prime32_2,
+            xxh_prime64_5,
+            xxh_prime32_1};
+
+        /// @brief Derives the long-input secret for a non-zero @p seed.
+        constexpr ::std::array<unsigned char, xxh3_secret_size> xxh3_custom_secret(
+            ::std::uint64_t const seed) noexcept
+        {
+            ::std::array<unsigned char, xxh3_secret_size> secret{};
+            for (::std::size_t i = 0; i < xxh3_secret_size; i += 16)
+            {
+                ::std::uint64_t const lo =
+                    detail::read_le<::std::uint64_t>(xxh3_default_secret.data() + i) + seed;
+                ::std::uint64_t const hi =
+                    detail::read_le<::std::uint64_t>(xxh3_default_secret.data() + i + 8) - seed;
+                for (::std::size_t b = 0; b < 8; ++b)
+                {
+                    secret[i + b] = static_cast<unsigned char>(lo >> (b * 8));
+                    secret[i + 8 + b] = static_cast<unsigned char>(hi >> (b * 8));
+                }
+            }
+            return secret;
+        }
+
+        /// @brief Final XXH3 bit mixer for mid-sized and long inputs.
+        constexpr ::std::uint64_t xxh3_avalanche(::std::uint64_t h) noexcept
+        {
+            h ^= h >> 37;
+            h *= 0x165667919e3779f9ull;
+            return h ^ (h >> 32);
+        }
+
+        /// @brief Stronger mixer for 4–8 byte inputs (rrmxmx).
+        constexpr ::std::uint64_t xxh3_rrmxmx(::std::uint64_t h, ::std::uint64_t const len) noexcept
+        {
+            h ^= ::std::rotl(h, 49) ^ ::std::rotl(h, 24);
+            h *= 0x9fb21c651e98df25ull;
+            h ^= (h >> 35) + len;
+            h *= 0x9fb21c651e98df25ull;
+            return h ^ (h >> 28);
+        }
+
+        /// @brief Mixes 16 input bytes with 16 secret bytes into 64 bits.
+        template <::std::random_access_iterator It>
+        constexpr ::std::uint64_t xxh3_mix16(
+            It const p, unsigned char const * s, ::std::uint64_t const seed) noexcept
+        {
+            ::std::uint64_t const lo = detail::read_le<::std::uint64_t>(p) ^
+                (detail::read_le<::std::uint64_t>(s) + seed);
+            ::std::uint64_t const hi = detail::read_le<::std::uint64_t>(p + 8) ^
+                (detail::read_le<::std::uint64_t>(s + 8) - seed);
+            return detail::mul128_fold64(lo, hi);
+        }
+
+        /// @brief XXH3-64 of 0–16 bytes.
+        template <::std::random_access_iterator It>
+        constexpr ::std::uint64_t xxh3_len_0to16(It const p,
+            ::std::size_t const n,
+            unsigned char const * s,
+            ::std::uint64_t seed) noexcept
+        {
+            if (n > 8)
+            {
+                ::std::uint64_t const flip1 = (detail::read_le<::std::uint64_t>(s + 24) ^
+                                                  detail::read_le<::std::uint64_t>(s + 32)) +
+                    seed;
+                ::std::uint64_t const flip2 = (detail::read_le<::std::uint64_t>(s + 40) ^
+                                                  detail::read_le<::std::uint64_t>(s + 48)) -
+                    seed;
+                ::std::uint64_t const lo = detail::read_le<::std::uint64_t>(p) ^ flip1;
+                ::std::uint64_t const hi = detail::read_le<::std::uint64_t>(p + (n - 8)) ^ flip2;
+                return detail::xxh3_avalanche(
+                    n + detail::byteswap(lo) + hi + detail::mul128_fold64(lo, hi));
+            }
+            if (n >= 4)
+            {
+                seed ^= static_cast<::std::uint64_t>(
+                            detail::byteswap(static_cast<::std::uint32_t>(seed)))
+                    << 32;
+                ::std::uint64_t const in1 = detail::read_le<::std::uint32_t>(p);
+                ::std::uint64_t const in2 = detail::read_le<::std::uint32_t>(p + (n - 4));
+                ::std::uint64_t const flip = (detail::read_le<::std::uint64_t>(s + 8) ^
+                                                 detail::read_le<::std::uint64_t>(s + 16)) -
+                    seed;
+                return detail::xxh3_rrmxmx((in2 + (in1 << 32)) ^ flip, n);
+            }
+            if (n > 0)
+            {
+                ::std::uint32_t const c1 = static_cast<::std::uint8_t>(p[0]);
+                ::std::uint32_t const c2 = static_cast<::std::uint8_t>(p[n >> 1]);
+                ::std::uint32_t const c3 = static_cast<::std::uint8_t>(p[n - 1]);
+                ::std::uint32_t const combined = (c1 << 16) | (c2 << 24) | c3 |
+                    (static_cast<::std::uint32_t>(n) << 8);
+                ::std::uint64_t const flip = (detail::read_le<::std::uint32_t>(s) ^
+                                                 detail::read_le<::std::uint32_t>(s + 4)) +
+                    seed;
+                return detail::xxh64_avalanche(combined ^ flip);
+            }
+            return detail::xxh64_avalanche(seed ^ detail::read_le<::std::uint64_t>(s + 56) ^
+                detail::read_le<::std::uint64_t>(s + 64));
+        }
+
+        /// @brief XXH3-64 of 17–128 bytes.
+        template <::std::random_access_iterator It>
+        constexpr ::std::uint64_t xxh3_len_17to128(It const p,
+            ::std::size_t const n,
+            unsigned char const * s,
+            ::std::uint64_t const seed) noexcept
+        {
+            ::std::uint64_t acc = n * xxh_prime64_1;
+            if (n > 32)
+            {
+                if (n > 64)
+                {
+                    if (n > 96)
+                    {
+                        acc += detail::xxh3_mix16(p + 48, s + 96, seed);
+                        acc += detail::xxh3_mix16(p + (n - 64), s + 112, seed);
+                    }
+                    acc += detail::xxh3_mix16(p + 32, s + 64, seed);
+                    acc += detail::xxh3_mix16(p + (n - 48), s + 80, seed);
+                }
+                acc += detail::xxh3_mix16(p + 16, s + 32, seed);
+                acc += detail::xxh3_mix16(p + (n - 32), s + 48, seed);
+            }
+            acc += detail::xxh3_mix16(p, s, seed);
+            acc += detail::xxh3_mix16(p + (n - 16), s + 16, seed);
+            return detail::xxh3_avalanche(acc);
+        }
+
+        /// @brief XXH3-64 of 129–240 bytes.
+        template <::std::random_access_iterator It>
+        constexpr ::std::uint64_t xxh3_len_129to240(It const p,
+            ::std::size_t const n,
+            unsigned char const * s,
+            ::std::uint64_t const seed) noexcept
+        {
+            ::std::uint64_t acc = n * xxh_prime64_1;
+            ::std::size_t const rounds = n / 16;
+            for (::std::size_t i = 0; i < 8; ++i)
+                acc += detail::xxh3_mix16(p + 16 * i, s + 16 * i, seed);
+            acc = detail::xxh3_avalanche(acc);
+            for (::std::size_t i = 8; i < rounds; ++i)
+                acc += detail::xxh3_mix16(p + 16 * i, s + 16 * (i - 8) + 3, seed);
+            acc += detail::xxh3_mix16(p + (n - 16), s + (136 - 17), seed);
+            return detail::xxh3_avalanche(acc);
+        }
+
+        /// @brief XXH3-128 of 0–16 bytes.
+        template <::std::random_access_iterator It>
+        constexpr uint128 xxh3_128_len_0to16(It const p,
+            ::std::size_t const n,
+            unsigned char const * s,
+            ::std::uint64_t seed) noexcept
+        {
+            if (n > 8)
+            {
+                ::std::uint64_t const flip_lo = (detail::read_le<::std::uint64_t>(s + 32) ^
+                                                    detail::read_le<::std::uint64_t>(s + 40)) -
+                    seed;
+                ::std::uint64_t const flip_hi = (detail::read_le<::std::uint64_t>(s + 48) ^
+                                                    detail::read_le<::std::uint64_t>(s + 56)) +
+                    seed;
+                ::std::uint64_t const in_lo = detail::read_le<::std::uint64_t>(p);
+                ::std::uint64_t in_hi = detail::read_le<::std::uint64_t>(p + (n - 8));
+
+                ::std::uint64_t m_hi = 0;
+                ::std::uint64_t m_lo =
+                    detail::mul128(in_lo ^ in_hi ^ flip_lo, xxh_prime64_1, m_hi);
+                m_lo += static_cast<::std::uint64_t>(n - 1) << 54;
+                in_hi ^= flip_hi;
+                m_hi += in_hi + (in_hi & 0xffffffffull) * (xxh_prime32_2 - 1);
+                m_lo ^= detail::byteswap(m_hi);
+
+                ::std::uint64_t r_hi = 0;
+                ::std::uint64_t const r_lo = detail::mul128(m_lo, xxh_prime64_2, r_hi);
+                r_hi += m_hi * xxh_prime64_2;
+                return {.lo = detail::xxh3_avalanche(r_lo), .hi = detail::xxh3_avalanche(r_hi)};
+            }
+            if (n >= 4)
+            {
+                seed ^= static_cast<::std::uint64_t>(
+                            detail::byteswap(static_cast<::std::uint32_t>(seed)))
+                    << 32;
+                ::std::uint64_t const in1 = detail::read_le<::std::uint32_t>(p);
+                ::std::uint64_t const in2 = detail::read_le<::std::uint32_t>(p + (n - 4));
+                ::std::uint64_t const flip = (detail::read_le<::std::uint64_t>(s + 16) ^
+                                                 detail::read_le<::std::uint64_t>(s + 24)) +
+                    seed;
+
+                ::std::uint64_t hi = 0;
+                ::std::uint64_t lo = detail::mul128((in1 + (in2 << 32)) ^ flip,
+                    xxh_prime64_1 + (static_cast<::std::uint64_t>(n) << 2),
+                    hi);
+                hi += lo << 1;
+                lo ^= hi >> 3;
+                lo ^= lo >> 35;
+                lo *= 0x9fb21c651e98df25ull;
+                lo ^= lo >> 28;
+                return {.lo = lo, .hi = detail::xxh3_avalanche(hi)};
+            }
+            if (n > 0)
+            {
+                ::std::uint32_t const c1 = static_cast<::std::uint8_t>(p[0]);
+                ::std::uint32_t const c2 = static_cast<::std::uint8_t>(p[n >> 1]);
+                ::std::uint32_t const c3 = static_cast<::std::uint8_t>(p[n - 1]);
+                ::std::uint32_t const combined_lo = (c1 << 16) | (c2 << 24) | c3 |
+                    (static_cast<::std::uint32_t>(n) << 8);
+                ::std::uint32_t const combined_hi = ::std::rotl(detail::byteswap(combined_lo), 13);
+                ::std::uint64_t const flip_lo = (detail::read_le<::std::uint32_t>(s) ^
+                                                    detail::read_le<::std::uint32_t>(s + 4)) +
+                    seed;
+                ::std::uint64_t const flip_hi = (detail::read_le<::std::uint32_t>(s + 8) ^
+                                                    detail::read_le<::std::uint32_t>(s + 12)) -
+                    seed;
+                return {.lo = detail::xxh64_avalanche(combined_lo ^ flip_lo),
+                    .hi = detail::xxh64_avalanche(combined_hi ^ flip_hi)};
+            }
+            return {.lo = detail::xxh64_avalanche(seed ^ detail::read_le<::std::uint64_t>(s + 64) ^
+                        detail::read_le<::std::uint64_t>(s + 72)),
+                .hi = detail::xxh64_avalanche(seed ^ detail::read_le<::std::uint64_t>(s + 80) ^
+                    detail::read_le<::std::uint64_t>(s + 88))};
+        }
+
+        /// @brief Mixes two 16-byte input chunks into both halves of an XXH3-128 accumulator.
+        template <::std::random_access_iterator It>
+        constexpr void xxh3_mix32(uint128 & acc,
+            It const p1,
+            It const p2,
+            unsigned char const * s,
+            ::std::uint64_t const seed) noexcept
+        {
+            acc.lo += detail::xxh3_mix16(p1, s, seed);
+            acc.lo ^=
+                detail::read_le<::std::uint64_t>(p2) + detail::read_le<::std::uint64_t>(p2 + 8);
+            acc.hi += detail::xxh3_mix16(p2, s + 16, seed);
+            acc.hi ^=
+                detail::read_le<::std::uint64_t>(p1) + detail::read_le<::std::uint64_t>(p1 + 8);
+        }
+
+        /// @brief Final mixing shared by the 17–240 byte XXH3-128 paths.
+        constexpr uint128 xxh3_128_mid_avalanche(
+            uint128 const acc, ::std::size_t const n, ::std::uint64_t const seed) noexcept
+        {
+            ::std::uint64_t const hi = acc.lo * xxh_prime64_1 + acc.hi * xxh_prime64_4 +
+                (static_cast<::std::uint64_t>(n) - seed) * xxh_prime64_2;
+            return {.lo = detail::xxh3_avalanche(acc.lo + acc.hi),
+                .hi = 0 - detail::xxh3_avalanche(hi)};
+        }
+
+        /// @brief XXH3-128 of 17–128 bytes.
+        template <::std::random_access_iterator It>
+        constexpr uint128 xxh3_128_len_17to128(It const p,
+            ::std::size_t const n,
+            unsigned char const * s,
+            ::std::uint64_t const seed) noexcept
+        {
+            uint128 acc{.lo = n * xxh_prime64_1, .hi = 0};
+            if (n > 32)
+            {
+                if (n > 64)
+                {
+                    if (n > 96)
+                        detail::xxh3_mix32(acc, p + 48, p + (n - 64), s + 96, seed);
+                    detail::xxh3_mix32(acc, p + 32, p + (n - 48), s + 64, seed);
+                }
+                detail::xxh3_mix32(acc, p + 16, p + (n - 32), s + 32, seed);
+            }
+            detail::xxh3_mix32(acc, p, p + (n - 16), s, seed);
+            return detail::xxh3_128_mid_avalanche(acc, n, seed);
+        }
+
+        /// @brief XXH3-128 of 129–240 bytes.
+        template <::std::random_access_iterator It>
+        constexpr uint128 xxh3_128_len_129to240(It const p,
+            ::std::size_t const n,
+            unsigned char const * s,
+            ::std::uint64_t const seed) noexcept
+        {
+            uint128 acc{.lo = n * xxh_prime64_1, .hi = 0};
+            ::std::size_t const rounds = n / 32;
+            for (::std::size_t i = 0; i < 4; ++i)
+                detail::xxh3_mix32(acc, p + 32 * i, p + (32 * i + 16), s + 32 * i, seed);
+            acc.lo = detail::xxh3_avalanche(acc.lo);
+            acc.hi = detail::xxh3_avalanche(acc.hi);
+            for (::std::size_t i = 4; i < rounds; ++i)
+                detail::xxh3_mix32(
+                    acc, p + 32 * i, p + (32 * i + 16), s + (32 * (i - 4) + 3), seed);
+            detail::xxh3_mix32(acc, p + (n - 16), p + (n - 32), s + (136 - 17 - 16), 0 - seed);
+            return detail::xxh3_128_mid_avalanche(acc, n, seed);
+        }
+
+#if SCL_HASH_X86_64
+        /// @brief Accumulates one 16-byte quarter stripe into two 64-bit lanes.
+        SCL_HASH_TARGET("sse2")
+        inline __m128i xxh3_accumulate_sse2(
+            __m128i const acc, unsigned char const * p, unsigned char const * s) noexcept
+        {
+            __m128i const data = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+            __m128i const key = _mm_loadu_si128(reinterpret_cast<__m128i const *>(s));
+            __m128i const data_key = _mm_xor_si128(data, key);
+            __m128i const product =
+                _mm_mul_epu32(data_key, _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1)));
+            __m128i const swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+            return _mm_add_epi64(_mm_add_epi64(acc, swapped), product);
+        }
+
+        /// @brief Scrambles two 64-bit accumulator lanes.
+        SCL_HASH_TARGET("sse2")
+        inline __m128i xxh3_scramble_sse2(__m128i acc, unsigned char const * s) noexcept
+        {
+            __m128i const prime = _mm_set1_epi32(static_cast<int>(xxh_prime32_1));
+            acc = _mm_xor_si128(acc, _mm_srli_epi64(acc, 47));
+            acc = _mm_xor_si128(acc, _mm_loadu_si128(reinterpret_cast<__m128i const *>(s)));
+            __m128i const lo = _mm_mul_epu32(acc, prime);
+            __m128i const hi =
+                _mm_mul_epu32(_mm_shuffle_epi32(acc, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+            return _mm_add_epi64(lo, _mm_slli_epi64(hi, 32));
+        }
+
+        SCL_HASH_TARGET("sse2")
+        inline void xxh3_accumulate_bytes_sse2(::std::uint64_t * acc,
+            unsigned char const * p,
+            unsigned char const * s,
+            ::std::size_t const stripes) noexcept
+        {
+            __m128i a[4];
+            for (::std::size_t l = 0; l < 4; ++l)
+                a[l] = _mm_loadu_si128(reinterpret_cast<__m128i const *>(acc + 2 * l));
+            for (::std::size_t i = 0; i < stripes; ++i, p += xxh3_stripe_len, s += 8)
+                for (::std::size_t l = 0; l < 4; ++l)
+                    a[l] = detail::xxh3_accumulate_sse2(a[l], p + 16 * l, s + 16 * l);
+            for (::std::size_t l = 0; l < 4; ++l)
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(acc + 2 * l), a[l]);
+        }
+
+        SCL_HASH_TARGET("sse2")
+        inline void xxh3_scramble_bytes_sse2(
+            ::std::uint64_t * acc, unsigned char const * s) noexcept
+        {
+            for (::std::size_t l = 0; l < 4; ++l)
+            {
+                auto * const lane = reinterpret_cast<__m128i *>(acc + 2 * l);
+                _mm_storeu_si128(
+                    lane, detail::xxh3_scramble_sse2(_mm_loadu_si128(lane), s + 16 * l));
+            }
+        }
+
+        /// @brief Accumulates one 32-byte half stripe into four 64-bit lanes.
+        SCL_HASH_TARGET("avx2")
+        inline __m256i xxh3_accumulate_avx2(
+            __m256i const acc, unsigned char const * p, unsigned char const * s) noexcept
+        {
+            __m256i const data = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p));
+            __m256i const key = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(s));
+            __m256i const data_key = _mm256_xor_si256(data, key);
+            // 32×32→64 product of the low and high halves of every lane.
+            __m256i const product = _mm256_mul_epu32(data_key, _mm256_srli_epi64(data_key, 32));
+            // Neighbouring lanes swap their raw input: acc[i ^ 1] += data[i].
+            __m256i const swapped = _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+            return _mm256_add_epi64(_mm256_add_epi64(acc, swapped), product);
+        }
+
+        /// @brief Scrambles four 64-bit accumulator lanes.
+        SCL_HASH_TARGET("avx2")
+        inline __m256i xxh3_scramble_avx2(__m256i acc, unsigned char const * s) noexcept
+        {
+            __m256i const prime = _mm256_set1_epi32(static_cast<int>(xxh_prime32_1));
+            acc = _mm256_xor_si256(acc, _mm256_srli_epi64(acc, 47));
+            acc = _mm256_xor_si256(acc, _mm256_loadu_si256(reinterpret_cast<__m256i const *>(s)));
+            __m256i const lo = _mm256_mul_epu32(acc, prime);
+            __m256i const hi = _mm256_mul_epu32(_mm256_srli_epi64(acc, 32), prime);
+            return _mm256_add_epi64(lo, _mm256_slli_epi64(hi, 32));
+        }
+
+        SCL_HASH_TARGET("avx2")
+        inline void xxh3_accumulate_bytes_avx2(::std::uint64_t * acc,
+            unsigned char const * p,
+            unsigned char const * s,
+            ::std::size_t const stripes) noexcept
+        {
+            __m256i a0 = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(acc));
+            __m256i a1 = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(acc + 4));
+            for (::std::size_t i = 0; i < stripes; ++i, p += xxh3_stripe_len, s += 8)
+            {
+                a0 = detail::xxh3_accumulate_avx2(a0, p, s);
+                a1 = detail::xxh3_accumulate_avx2(a1, p + 32, s + 32);
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc), a0);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc + 4), a1);
+        }
+
+        SCL_HASH_TARGET("avx2")
+        inline void xxh3_scramble_bytes_avx2(
+            ::std::uint64_t * acc, unsigned char const * s) noexcept
+        {
+            for (::std::size_t l = 0; l < 2; ++l)
+            {
+                auto * const lane = reinterpret_cast<__m256i *>(acc + 4 * l);
+                _mm256_storeu_si256(lane,
+                    detail::xxh3_scramble_avx2(_mm256_loadu_si256(lane), s + 32 * l));
+            }
+        }
+
+        /// @brief AVX-512F: the whole 64-byte stripe and all eight accumulators in one register.
+        ///
+        /// Shifts, shuffles and multiplies use their merge-masked forms with an
+        /// all-ones mask: the same instructions, without the undefined
+        /// pass-through operand that trips `-Wuninitialized` on GCC 12.
+        SCL_HASH_TARGET("avx512f")
+        inline void xxh3_accumulate_bytes_avx512(::std::uint64_t * acc,
+            unsigned char const * p,
+            unsigned char const * s,
+            ::std::size_t const stripes) noexcept
+        {
+            constexpr auto all = static_cast<__mmask8>(0xff);
+            __m512i a = _mm512_loadu_si512(acc);
+            for (::std::size_t i = 0; i < stripes; ++i, p += xxh3_stripe_len, s += 8)
+            {
+                __m512i const data = _mm512_loadu_si512(p);
+                __m512i const data_key = _mm512_xor_si512(data, _mm512_loadu_si512(s));
+                __m512i const product = _mm512_mask_mul_epu32(data_key,
+                    all,
+                    data_key,
+                    _mm512_mask_srli_epi64(data_key, all, data_key, 32));
+                __m512i const swapped = _mm512_mask_shuffle_epi32(data,
+                    static_cast<__mmask16>(0xffff),
+                    data,
+                    static_cast<_MM_PERM_ENUM>(_MM_SHUFFLE(1, 0, 3, 2)));
+                a = _mm512_add_epi64(_mm512_add_epi64(a, swapped), product);
+            }
+            _mm512_storeu_si512(acc, a);
+        }
+
+        SCL_HASH_TARGET("avx512f")
+        inline void xxh3_scramble_bytes_avx512(
+            ::std::uint64_t * acc, unsigned char const * s) noexcept
+        {
+            constexpr auto all = static_cast<__mmask8>(0xff);
+            __m512i const prime = _mm512_set1_epi32(static_cast<int>(xxh_prime32_1));
+            __m512i a = _mm512_loadu_si512(acc);
+            a = _mm512_xor_si512(a, _mm512_mask_srli_epi64(a, all, a, 47));
+            a = _mm512_xor_si512(a, _mm512_loadu_si512(s));
+            __m512i const lo = _mm512_mask_mul_epu32(a, all, a, prime);
+            __m512i const hi =
+                _mm512_mask_mul_epu32(a, all, _mm512_mask_srli_epi64(a, all, a, 32), prime);
+            _mm512_storeu_si512(acc, _mm512_add_epi64(lo, _mm512_mask_slli_epi64(hi, all, hi, 32)));
+        }
+#endif
+
+        /// @brief Runtime path: accumulates @p stripes consecutive 64-byte stripes.
+        ///
+        /// Runs the widest kernel allowed by @ref active_simd_level; the
+        /// accumulators stay in vector registers for the whole run and the
+        /// secret advances by 8 bytes per stripe.
+        inline void xxh3_accumulate_bytes(::std::uint64_t * acc,
+            unsigned char const * p,
+            unsigned char const * s,
+            ::std::size_t const stripes) noexcept
+        {
+#if SCL_HASH_X86_64
+            switch (::scl::hash::active_simd_level())
+            {
+            case simd_level::avx512:
+                return detail::xxh3_accumulate_bytes_avx512(acc, p, s, stripes);
+            case simd_level::avx2:
+                return detail::xxh3_accumulate_bytes_avx2(acc, p, s, stripes);
+            case simd_level::sse42:
+            case simd_level::sse2:
+                return detail::xxh3_accumulate_bytes_sse2(acc, p, s, stripes);
+            case simd_level::scalar:
+                break;
+            }
+#endif
+            for (::std::size_t i = 0; i < stripes; ++i, p += xxh3_stripe_len, s += 8)
+                for (::std::size_t l = 0; l < 8; ++l)
+                {
+                    ::std::uint64_t const data = detail::load_le<::std::uint64_t>(p + 8 * l);
+                    ::std::uint64_t const key = data ^ detail::load_le<::std::uint64_t>(s + 8 * l);
+                    acc[l ^ 1] += data;
+                    acc[l] += (key & 0xffffffffull) * (key >> 32);
+                }
+        }
+
+        /// @brief Runtime path: scrambles all eight accumulators with 64 secret bytes.
+        inline void xxh3_scramble_bytes(::std::uint64_t * acc, unsigned char const * s) noexcept
+        {
+#if SCL_HASH_X86_64
+            switch (::scl::hash::active_simd_level())
+            {
+            case simd_level::avx512:
+                return detail::xxh3_scramble_bytes_avx512(acc, s);
+            case simd_level::avx2:
+                return detail::xxh3_scramble_bytes_avx2(acc, s);
+            case simd_level::sse42:
+            case simd_level::sse2:
+                return detail::xxh3_scramble_bytes_sse2(acc, s);
+            case simd_level::scalar:
+                break;
+            }
+#endif
+            for (::std::size_t l = 0; l < 8; ++l)
+            {
+                ::std::uint64_t a = acc[l];
+                a ^= a >> 47;
+                a ^= detail::load_le<::std::uint64_t>(s + 8 * l);
+                acc[l] = a * xxh_prime32_1;
+            }
+        }
+
+        /// @brief Accumulates @p stripes consecutive 64-byte stripes starting at @p p.
+        ///
+        /// Contiguous bytes go through the vectorised @ref xxh3_accumulate_bytes
+        /// at run time; constant evaluation and other iterators use the
+        /// equivalent scalar formulation.
+        template <::std::random_access_iterator It>
+        constexpr void xxh3_accumulate(::std::uint64_t * acc,
+            It p,
+            unsigned char const * s,
+            ::std::size_t const stripes) noexcept
+        {
+            if constexpr (contiguous_byte_iterator<It>)
+            {
+                if (!::std::is_constant_evaluated())
+                {
+                    detail::xxh3_accumulate_bytes(acc,
+                        reinterpret_cast<unsigned char const *>(::std::to_address(p)),
+                        s,
+                        stripes);
+                    return;
+                }
+            }
+
+            for (::std::size_t i = 0; i < stripes; ++i, p += xxh3_stripe_len, s += 8)
+                for (::std::size_t l = 0; l < 8; ++l)
+                {
+                    ::std::uint64_t const data = detail::read_le<::std::uint64_t>(p + 8 * l);
+                    ::std::uint64_t const key = data ^ detail::read_le<::std::uint64_t>(s + 8 * l);
+                    acc[l ^ 1] += data;
+                    acc[l] += (key & 0xffffffffull) * (key >> 32);
+                }
+        }
+
+        /// @brief Scrambles the accumulators at the end of every block.
+        constexpr void xxh3_scramble(::std::uint64_t * acc, unsigned char const * s) noexcept
+        {
+            if (!::std::is_constant_evaluated())
+            {
+                detail::xxh3_scramble_bytes(acc, s);
+                return;
+            }
+
+            for (::std::size_t l = 0; l < 8; ++l)
+            {
+                ::std::uint64_t a = acc[l];
+                a ^= a >> 47;
+                a ^= detail::read_le<::std::uint64_t>(s + 8 * l);
+                acc[l] = a * xxh_prime32_1;
+            }
+        }
+
+        /// @brief Merges the eight accumulators into the final 64-bit digest.
+        constexpr ::std::uint64_t xxh3_merge_accs(
+            ::std::uint64_t const * acc, unsigned char const * s, ::std::uint64_t result) noexcept
+        {
+            for (::std::size_t i = 0; i < 4; ++i)
+                result += detail::mul128_fold64(
+                    acc[2 * i] ^ detail::read_le<::std::uint64_t>(s + 16 * i),
+                    acc[2 * i + 1] ^ detail::read_le<::std::uint64_t>(s + 16 * i + 8));
+            return detail::xxh3_avalanche(result);
+        }
+
+        /// @brief Merges the long-input accumulators into a @p Result digest.
+        template <typename Result>
+        constexpr Result xxh3_long_digest(::std::uint64_t const * acc,
+            unsigned char const * s,
+            ::std::uint64_t const len) noexcept
+        {
+            ::std::uint64_t const lo = detail::xxh3_merge_accs(acc, s + 11, len * xxh_prime64_1);
+            if constexpr (::std::same_as<Result, uint128>)
+                return {.lo = lo,
+                    .hi = detail::xxh3_merge_accs(
+                        acc, s + (xxh3_secret_size - 64 - 11), ~(len * xxh_prime64_2))};
+            else
+                return lo;
+        }
+
+        /// @brief XXH3 of more than 240 bytes with a 192-byte @p secret.
+        template <typename Result, ::std::random_access_iterator It>
+        constexpr Result xxh3_hash_long(
+            It const p, ::std::size_t const n, unsigned char const * secret) noexcept
+        {
+            constexpr ::std::size_t block_len = xxh3_stripe_len * xxh3_stripes_per_block;
+
+            alignas(32) ::std::uint64_t acc[8]{};
+            for (::std::size_t l = 0; l < 8; ++l)
+                acc[l] = xxh3_init_acc[l];
+
+            ::std::size_t const blocks = (n - 1) / block_len;
+            for (::std::size_t b = 0; b < blocks; ++b)
+            {
+                detail::xxh3_accumulate(acc, p + b * block_len, secret, xxh3_stripes_per_block);
+                detail::xxh3_scramble(acc, secret + (xxh3_secret_size - xxh3_stripe_len));
+            }
+
+            // Last partial block, then the last stripe (which may overlap it).
+            ::std::size_t const stripes = ((n - 1) - blocks * block_len) / xxh3_stripe_len;
+            detail::xxh3_accumulate(acc, p + blocks * block_len, secret, stripes);
+            detail::xxh3_accumulate(acc,
+                p + (n - xxh3_stripe_len),
+                secret + (xxh3_secret_size - xxh3_stripe_len - 7),
+                1);
+
+            return detail::xxh3_long_digest<Result>(acc, secret, n);
+        }
+
+        /// @brief XXH3 digest of type @p Result (64- or 128-bit) of @p n bytes starting at @p p.
+        template <typename Result, ::std::random_access_iterator It>
+        constexpr Result xxh3_impl(
+            It const p, ::std::size_t const n, ::std::uint64_t const seed) noexcept
+        {
+            unsigned char const * const s = xxh3_default_secret.data();
+            if constexpr (::std::same_as<Result, uint128>)
+            {
+                if (n <= 16)
+                    return detail::xxh3_128_len_0to16(p, n, s, seed);
+                if (n <= 128)
+                    return detail::xxh3_128_len_17to128(p, n, s, seed);
+                if (n <= xxh3_mid_size_max)
+                    return detail::xxh3_128_len_129to240(p, n, s, seed);
+            }
+            else
+            {
+                if (n <= 16)
+                    return detail::xxh3_len_0to16(p, n, s, seed);
+                if (n <= 128)
+                    return detail::xxh3_len_17to128(p, n, s, seed);
+                if (n <= xxh3_mid_size_max)
+                    return detail::xxh3_len_129to240(p, n, s, seed);
+            }
+            if (seed == 0)
+                return detail::xxh3_hash_long<Result>(p, n, s);
+            auto const secret = detail::xxh3_custom_secret(seed);
+            return detail::xxh3_hash_long<Result>(p, n, secret.data());
+        }
+    } // namespace detail
+
+    /// @brief Incremental XXH3 state for hashing a message split into several ranges.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Keeps the eight long-input accumulators and a 256-byte buffer of
+    /// pending input, so the digest returned by @ref finalize equals
+    /// @ref xxh3_64 (or @ref xxh3_128) over the concatenated bytes, however
+    /// the message is split.
+    /// Messages of up to 240 bytes stay entirely in the buffer and are hashed
+    /// by the short-input paths. @ref finalize works on a copy of the state;
+    /// more bytes may be appended afterwards.
+    ///
+    /// At run time, contiguous ranges of byte-sized elements are absorbed
+    /// directly from the caller's memory by the vectorised stripe loop;
+    /// constant evaluation and non-contiguous ranges go through the buffer
+    /// element by element.
+    ///
+    /// @tparam Result  `std::uint64_t` for XXH3-64 or @ref uint128 for XXH3-128.
+    ///                 Both digests share the whole input loop.
+    template <typename Result>
+        requires ::std::same_as<Result, ::std::uint64_t> || ::std::same_as<Result, uint128>
+    struct xxh3_state
+    {
+        using result_type = Result;
+
+        /// @brief Starts a new message with @p seed.
+        constexpr explicit xxh3_state(::std::uint64_t const seed = 0) noexcept
+            : m_secret{seed == 0 ? detail::xxh3_default_secret : detail::xxh3_custom_secret(seed)}
+            , m_seed{seed}
+        {
+            for (::std::size_t l = 0; l < 8; ++l)
+                m_acc[l] = detail::xxh3_init_acc[l];
+        }
+
+        /// @brief Appends @p range to the message.
+        template <::std::ranges::input_range Range>
+        constexpr xxh3_state & update(Range && range) noexcept
+            requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+        {
+            if (!::std::is_constant_evaluated())
+            {
+                detail::for_each_segment(range, [this](::std::span<unsigned char const> bytes) {
+                    update_bytes(bytes.data(), bytes.size());
+                });
+                return *this;
+            }
+
+            for (auto const c : range)
+            {
+                // A full buffer is consumed only once more input follows it, so
+                // the last stripe of the message is always still buffered.
+                if (m_buffered == buffer_size)
+                {
+                    consume_stripes(m_buffer.data(), buffer_size / detail::xxh3_stripe_len);
+                    m_buffered = 0;
+                }
+                m_buffer[m_buffered++] = static_cast<unsigned char>(static_cast<::std::uint8_t>(c));
+                ++m_len;
+            }
+            return *this;
+        }
+
+        /// @brief Returns the digest of all bytes appended so far.
+        constexpr result_type finalize() const noexcept
+        {
+            if (m_len <= detail::xxh3_mid_size_max)
+                return detail::xxh3_impl<Result>(
+                    m_buffer.data(), static_cast<::std::size_t>(m_len), m_seed);
+
+            xxh3_state copy = *this;
+            unsigned char const * const s = copy.m_secret.data();
+            if (m_buffered >= detail::xxh3_stripe_len)
+            {
+                copy.consume_stripes(
+                    copy.m_buffer.data(), (m_buffered - 1) / detail::xxh3_stripe_len);
+                detail::xxh3_accumulate(copy.m_acc,
+                    copy.m_buffer.data() + (m_buffered - detail::xxh3_stripe_len),
+                    s + (detail::xxh3_secret_size - detail::xxh3_stripe_len - 7),
+                    1);
+            }
+            else
+            {
+                // The last stripe straddles the previously consumed bytes, which
+                // are still at the end of the buffer.
+                ::std::array<unsigned char, detail::xxh3_stripe_len> last{};
+                ::std::size_t const catchup = detail::xxh3_stripe_len - m_buffered;
+                for (::std::size_t i = 0; i < catchup; ++i)
+                    last[i] = m_buffer[buffer_size - catchup + i];
+                for (::std::size_t i = 0; i < m_buffered; ++i)
+                    last[catchup + i] = m_buffer[i];
+                detail::xxh3_accumulate(copy.m_acc,
+                    last.data(),
+                    s + (detail::xxh3_secret_size - detail::xxh3_stripe_len - 7),
+                    1);
+            }
+            return detail::xxh3_long_digest<Result>(copy.m_acc, s, m_len);
+        }
+
+    private:
+        static constexpr ::std::size_t buffer_size = 4 * detail::xxh3_stripe_len;
+
+        /// @brief Accumulates @p stripes stripes, scrambling at every block boundary.
+        constexpr void consume_stripes(unsigned char const * p, ::std::size_t stripes) noexcept
+        {
+            unsigned char const * const s = m_secret.data();
+            for (::std::size_t to_end = detail::xxh3_stripes_per_block - m_stripes;
+                 stripes >= to_end;
+                 to_end = detail::xxh3_stripes_per_block)
+            {
+                detail::xxh3_accumulate(m_acc, p, s + m_stripes * 8, to_end);
+                detail::xxh3_scramble(
+                    m_acc, s + (detail::xxh3_secret_size - detail::xxh3_stripe_len));
+                p += to_end * detail::xxh3_stripe_len;
+                stripes -= to_end;
+                m_stripes = 0;
+            }
+            detail::xxh3_accumulate(m_acc, p, s + m_stripes * 8, stripes);
+            m_stripes += stripes;
+        }
+
+        /// @brief Runtime path: absorbs contiguous memory without copying whole blocks.
+        void update_bytes(unsigned char const * p, ::std::size_t n) noexcept
+        {
+            m_len += n;
+            // m_buffered never exceeds buffer_size; clamping it and the copy
+            // length lets the compiler prove the copy stays inside m_buffer.
+            ::std::size_t const used = ::std::min(m_buffered, buffer_size);
+            ::std::size_t const room = buffer_size - used;
+            if (n <= room || used != 0) // fill the buffer, consume it if more input follows
+            {
+                ::std::size_t const k = ::std::min(n, room);
+                if (k != 0)
+                    ::std::memcpy(m_buffer.data() + used, p, k);
+                m_buffered = used + k;
+                if (k == n)
+                    return;
+                consume_stripes(m_buffer.data(), buffer_size / detail::xxh3_stripe_len);
+                m_buffered = 0;
+                p += k;
+                n -= k;
+            }
+
+            if (n > buffer_size)
+            {
+                ::std::size_t const stripes = (n - 1) / detail::xxh3_stripe_len;
+                consume_stripes(p, stripes);
+                p += stripes * detail::xxh3_stripe_len;
+                n -= stripes * detail::xxh3_stripe_len;
+                // Keep the last consumed stripe for a final stripe that straddles it.
+                ::std::memcpy(m_buffer.data() + (buffer_size - detail::xxh3_stripe_len),
+                    p - detail::xxh3_stripe_len,
+                    detail::xxh3_stripe_len);
+            }
+
+            ::std::memcpy(m_buffer.data(), p, n);
+            m_buffered = n;
+        }
+
+        alignas(32) ::std::uint64_t m_acc[8]{};
+        ::std::array<unsigned char, detail::xxh3_secret_size> m_secret;
+        ::std::array<unsigned char, buffer_size> m_buffer{}; ///< Pending input.
+        ::std::size_t m_buffered{}; ///< Number of pending bytes in @ref m_buffer.
+        ::std::size_t m_stripes{};  ///< Stripes accumulated in the current block.
+        ::std::uint64_t m_len{};    ///< Total number of bytes appended.
+        ::std::uint64_t m_seed;
+    };
+
+    /// @brief Incremental XXH3-64 state.
+    /// @ingroup scl_utility_hash
+    using xxh3_64_state = xxh3_state<::std::uint64_t>;
+
+    /// @brief Incremental XXH3-128 state.
+    /// @ingroup scl_utility_hash
+    using xxh3_128_state = xxh3_state<uint128>;
+
+    /// @brief Computes an XXH3 64-bit hash over an arbitrary byte range.
+    /// @ingroup scl_utility_hash
+    ///
+    /// XXH3 (Yann Collet, 2019) has dedicated paths for 0–16, 17–128 and
+    /// 129–240 byte inputs built on a 64×64→128-bit multiply-fold of input
+    /// and secret words. Longer inputs are cut into 64-byte stripes that
+    /// feed eight 64-bit accumulators:
+    /// @code
+    ///   // Per 8-byte lane l of every stripe:
+    ///   key        = lane[l] ^ secret[l];
+    ///   acc[l ^ 1] += lane[l];
+    ///   acc[l]     += lo32(key) * hi32(key);
+    ///   // Every 16 stripes: acc = (acc ^ acc >> 47 ^ secret) * PRIME32_1;
+    /// @endcode
+    /// Every step is a 32×32→64 multiply and add per lane, which maps directly
+    /// onto SSE2, AVX2 and AVX-512. Digests match the reference `XXH3_64bits_withSeed()`.
+    ///
+    /// The function is `constexpr`, allowing compile-time hash computation.
+    /// At run time, contiguous ranges of byte-sized elements are read with
+    /// unaligned loads and long inputs run the widest stripe loop the CPU
+    /// supports — SSE2, AVX2 or AVX-512F, chosen by @ref active_simd_level —
+    /// without any compiler flags; all paths produce identical digests.
+    /// Sized random-access ranges are hashed in place; other ranges are
+    /// streamed through an @ref xxh3_64_state.
+    ///
+    /// @tparam Range  Any type satisfying `std::ranges::input_range` whose elements
+    ///                are convertible to `std::uint8_t` — e.g. a string literal,
+    ///                `std::string_view`, `std::string`, `std::span<std::byte>`.
+    /// @param  range  Input range to hash.
+    /// @note   String literals (e.g. `"hello"`) include the null terminator in the
+    ///         hash. Use `std::string_view{"hello"}` to hash only the characters.
+    /// @param  seed   64-bit seed. Defaults to `0`.
+    /// @return 64-bit XXH3 digest.
+    ///
+    /// @par Compile-time example
+    /// @code
+    /// constexpr auto h = scl::hash::xxh3_64(std::string_view{"hello"});
+    /// static_assert(h == 0x9555e8555c62dcfdull);
+    /// @endcode
+    ///
+    /// @see https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+    template <::std::ranges::input_range Range>
+    constexpr ::std::uint64_t xxh3_64(Range && range, ::std::uint64_t const seed = 0)
+        requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+    {
+        // At run time only contiguous input is read in place; anything else
+        // reaches the stripe loop through the state's segment gathering.
+        if constexpr (::std::ranges::random_access_range<Range> &&
+            ::std::ranges::sized_range<Range>)
+        {
+            if (detail::contiguous_byte_range<Range> || ::std::is_constant_evaluated())
+                return detail::xxh3_impl<::std::uint64_t>(::std::ranges::begin(range),
+                    static_cast<::std::size_t>(::std::ranges::size(range)),
+                    seed);
+        }
+        return xxh3_64_state{seed}.update(range).finalize();
+    }
+
+    /// @brief Callable wrapper around @ref xxh3_64 for use with @ref scl::hash::key.
+    /// @ingroup scl_utility_hash
+    ///
+    /// @tparam Seed  64-bit seed. Defaults to `0`.
+    template <::std::uint64_t Seed = 0>
+    struct xxh3_hasher
+    {
+        using result_type = ::std::uint64_t;
+        using state_type = xxh3_64_state;
+
+        template <::std::ranges::input_range Range>
+        constexpr result_type operator()(Range && range) const noexcept
+            requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+        {
+            return ::scl::hash::xxh3_64(range, Seed);
+        }
+
+        /// @brief Returns a fresh streaming state seeded with @p Seed.
+        constexpr state_type make_state() const noexcept { return state_type{Seed}; }
+    };
+
+    /// @brief Computes an XXH3 128-bit hash over an arbitrary byte range.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Shares the stripe loop of @ref xxh3_64 for long inputs and merges the
+    /// accumulators a second time with a different secret slice for the high
+    /// half; inputs of up to 240 bytes have dedicated 128-bit paths that mix
+    /// 32 bytes per step. Long inputs cost the same as XXH3-64, and digests
+    /// match the reference `XXH3_128bits_withSeed()`.
+    ///
+    /// @tparam Range  Any type satisfying `std::ranges::input_range` whose elements
+    ///                are convertible to `std::uint8_t`.
+    /// @param  range  Input range to hash.
+    /// @param  seed   64-bit seed. Defaults to `0`.
+    /// @return 128-bit XXH3 digest (`lo` and `hi` are the reference `low64` and `high64`).
+    ///
+    /// @par Compile-time example
+    /// @code
+    /// constexpr auto h = scl::hash::xxh3_128(std::string_view{"hello"});
+    /// static_assert(h.hi == 0xb5e9c1ad071b3e7full);
+    /// @endcode
+    template <::std::ranges::input_range Range>
+    constexpr uint128 xxh3_128(Range && range, ::std::uint64_t const seed = 0)
+        requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+    {
+        // At run time only contiguous input is read in place; anything else
+        // reaches the stripe loop through the state's segment gathering.
+        if constexpr (::std::ranges::random_access_range<Range> &&
+            ::std::ranges::sized_range<Range>)
+        {
+            if (detail::contiguous_byte_range<Range> || ::std::is_constant_evaluated())
+                return detail::xxh3_impl<uint128>(::std::ranges::begin(range),
+                    static_cast<::std::size_t>(::std::ranges::size(range)),
+                    seed);
+        }
+        return xxh3_128_state{seed}.update(range).finalize();
+    }
+
+    /// @brief Callable wrapper around @ref xxh3_128 for use with @ref scl::hash::key.
+    /// @ingroup scl_utility_hash
+    ///
+    /// @tparam Seed  64-bit seed. Defaults to `0`.
+    template <::std::uint64_t Seed = 0>
+    struct xxh3_128_hasher
+    {
+        using result_type = uint128;
+        using state_type = xxh3_128_state;
+
+        template <::std::ranges::input_range Range>
+        constexpr result_type operator()(Range && range) const noexcept
+            requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+        {
+            return ::scl::hash::xxh3_128(range, Seed);
+        }
+
+        /// @brief Returns a fresh streaming state seeded with @p Seed.
+        constexpr state_type make_state() const noexcept { return state_type{Seed}; }
+    };
+
+} // namespace scl::hash
@@ -0,0 +1,244 @@
+#pragma once
+
+/// @file xxh64.h
+/// @brief XXH64: 64-bit xxHash with four parallel accumulator lanes.
+/// @ingroup scl_utility_hash
+
+#include <scl/utility/hash/detail/load.h>
+#include <scl/utility/hash/detail/segments.h>
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+namespace scl::hash
+{
+    namespace detail
+    {
+        inline constexpr ::std::uint64_t xxh_prime64_1 = 0x9e3779b185ebca87ull;
+        inline constexpr ::std::uint64_t xxh_prime64_2 = 0xc2b2ae3d27d4eb4full;
+        inline constexpr ::std::uint64_t xxh_prime64_3 = 0x165667b19e3779f9ull;
+        inline constexpr ::std::uint64_t xxh_prime64_4 = 0x85ebca77c2b2ae63ull;
+        inline constexpr ::std::uint64_t xxh_prime64_5 = 0x27d4eb2f165667c5ull;
+
+        /// @brief Mixes one 8-byte lane into an XXH64 accumulator.
+        constexpr ::std::uint64_t xxh64_round(
+            ::std::uint64_t acc, ::std::uint64_t const lane) noexcept
+        {
+            acc += lane * xxh_prime64_2;
+            acc = ::std::rotl(acc, 31);
+            return acc * xxh_prime64_1;
+        }
+
+        /// @brief Folds accumulator @p val into the converging hash @p acc.
+        constexpr ::std::uint64_t xxh64_merge_round(
+            ::std::uint64_t acc, ::std::uint64_t const val) noexcept
+        {
+            acc ^= detail::xxh64_round(0, val);
+            return acc * xxh_prime64_1 + xxh_prime64_4;
+        }
+
+        /// @brief Final XXH64 bit mixer.
+        constexpr ::std::uint64_t xxh64_avalanche(::std::uint64_t h) noexcept
+        {
+            h ^= h >> 33;
+            h *= xxh_prime64_2;
+            h ^= h >> 29;
+            h *= xxh_prime64_3;
+            h ^= h >> 32;
+            return h;
+        }
+    } // namespace detail
+
+    /// @brief Incremental XXH64 state for hashing a message split into several ranges.
+    /// @ingroup scl_utility_hash
+    ///
+    /// Buffers the trailing partial 32-byte stripe between @ref update calls, so
+    /// the digest returned by @ref finalize equals @ref xxh64 over the
+    /// concatenated bytes, however the message is split. @ref finalize works on
+    /// a copy of the state; more bytes may be appended afterwards.
+    ///
+    /// At run time, contiguous ranges of byte-sized elements are absorbed a
+    /// stripe at a time with unaligned 64-bit loads; constant evaluation and
+    /// non-contiguous ranges are absorbed element by element.
+    struct xxh64_state
+    {
+        using result_type = ::std::uint64_t;
+
+        /// @brief Starts a new message with @p seed.
+        constexpr explicit xxh64_state(::std::uint64_t const seed = 0) noexcept
+            : m_v1{seed + detail::xxh_prime64_1 + detail::xxh_prime64_2}
+            , m_v2{seed + detail::xxh_prime64_2}
+            , m_v3{seed}
+            , m_v4{seed - detail::xxh_prime64_1}
+        {}
+
+        /// @brief Appends @p range to the message.
+        template <::std::ranges::input_range Range>
+        constexpr xxh64_state & update(Range && range) noexcept
+            requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+        {
+            if (!::std::is_constant_evaluated())
+            {
+                detail::for_each_segment(range, [this](::std::span<unsigned char const> bytes) {
+                    update_bytes(bytes.data(), bytes.size());
+                });
+                return *this;
+            }
+
+            for (auto const c : range)
+            {
+                m_buf[m_len & 31] = static_cast<unsigned char>(static_cast<::std::uint8_t>(c));
+                if ((++m_len & 31) == 0) // full 32-byte stripe ready
+                    consume(m_buf);
+            }
+            return *this;
+        }
+
+        /// @brief Returns the digest of all bytes appended so far.
+        constexpr result_type finalize() const noexcept
+        {
+            // Before the first stripe m_v3 still holds the seed.
+            ::std::uint64_t h = m_v3 + detail::xxh_prime64_5;
+            if (m_len >= 32)
+            {
+                h = ::std::rotl(m_v1, 1) + ::std::rotl(m_v2, 7) + ::std::rotl(m_v3, 12) +
+                    ::std::rotl(m_v4, 18);
+                h = detail::xxh64_merge_round(h, m_v1);
+                h = detail::xxh64_merge_round(h, m_v2);
+                h = detail::xxh64_merge_round(h, m_v3);
+                h = detail::xxh64_merge_round(h, m_v4);
+            }
+            h += m_len;
+
+            unsigned char const * p = m_buf;
+            ::std::size_t n = m_len & 31;
+            for (; n >= 8; p += 8, n -= 8)
+            {
+                h ^= detail::xxh64_round(0, detail::read_le<::std::uint64_t>(p));
+                h = ::std::rotl(h, 27) * detail::xxh_prime64_1 + detail::xxh_prime64_4;
+            }
+            if (n >= 4)
+            {
+                h ^= detail::read_le<::std::uint32_t>(p) * detail::xxh_prime64_1;
+                h = ::std::rotl(h, 23) * detail::xxh_prime64_2 + detail::xxh_prime64_3;
+                p += 4;
+                n -= 4;
+            }
+            for (; n > 0; ++p, --n)
+            {
+                h ^= *p * detail::xxh_prime64_5;
+                h = ::std::rotl(h, 11) * detail::xxh_prime64_1;
+            }
+            return detail::xxh64_avalanche(h);
+        }
+
+    private:
+        /// @brief Absorbs one 32-byte stripe, one 8-byte lane per accumulator.
+        constexpr void consume(unsigned char const * p) noexcept
+        {
+            m_v1 = detail::xxh64_round(m_v1, detail::read_le<::std::uint64_t>(p));
+            m_v2 = detail::xxh64_round(m_v2, detail::read_le<::std::uint64_t>(p + 8));
+            m_v3 = detail::xxh64_round(m_v3, detail::read_le<::std::uint64_t>(p + 16));
+            m_v4 = detail::xxh64_round(m_v4, detail::read_le<::std::uint64_t>(p + 24));
+        }
+
+        /// @brief Runtime path: stripe-at-a-time absorption of contiguous memory.
+        void update_bytes(unsigned char const * p, ::std::size_t n) noexcept
+        {
+            ::std::size_t const fill = m_len & 31;
+            m_len += n;
+
+            if (fill != 0) // complete the buffered partial stripe first
+            {
+                ::std::size_t const k = n < 32 - fill ? n : 32 - fill;
+                ::std::memcpy(m_buf + fill, p, k);
+                if (fill + k < 32)
+                    return;
+                consume(m_buf);
+                p += k;
+                n -= k;
+            }
+
+            for (; n >= 32; p += 32, n -= 32)
+                consume(p);
+
+            if (n != 0)
+                ::std::memcpy(m_buf, p, n);
+        }
+
+        ::std::uint64_t m_v1;
+        ::std::uint64_t m_v2;
+        ::std::uint64_t m_v3;
+        ::std::uint64_t m_v4;
+        unsigned char m_buf[32]{}; ///< Pending bytes of the current stripe.
+        ::std::uint64_t m_len{};   ///< Total number of bytes appended.
+    };
+
+    /// @brief Computes an XXH64 64-bit hash over an arbitrary byte range.
+    /// @ingroup scl_utility_hash
+    ///
+    /// XXH64 (Yann Collet, 2014) splits the input into 32-byte stripes and
+    /// feeds each 8-byte lane of a stripe to its own accumulator, so the four
+    /// multiply-rotate chains run in parallel on a superscalar core:
+    /// @code
+    ///   // Per lane, 4 lanes per stripe:
+    ///   acc = rotl(acc + lane * PRIME64_2, 31) * PRIME64_1;
+    /// @endcode
+    /// The accumulators are then merged, the trailing bytes folded in and the
+    /// result avalanched. Digests match the reference `XXH64()`.
+    ///
+    /// The function is `constexpr`, allowing compile-time hash computation.
+    /// At run time, contiguous ranges of byte-sized elements are read with
+    /// unaligned 64-bit loads; both paths produce identical digests.
+    ///
+    /// @tparam Range  Any type satisfying `std::ranges::input_range` whose elements
+    ///                are convertible to `std::uint8_t` — e.g. a string literal,
+    ///                `std::string_view`, `std::string`, `std::span<std::byte>`.
+    /// @param  range  Input range to hash.
+    /// @note   String literals (e.g. `"hello"`) include the null terminator in the
+    ///         hash. Use `std::string_view{"hello"}` to hash only the characters.
+    /// @param  seed   64-bit seed. Defaults to `0`.
+    /// @return 64-bit XXH64 digest.
+    ///
+    /// @par Compile-time example
+    /// @code
+    /// constexpr auto h = scl::hash::xxh64(std::string_view{"hello"});
+    /// static_assert(h == 0x26c7827d889f6da3ull);
+    /// @endcode
+    ///
+    /// @see https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+    template <::std::ranges::input_range Range>
+    constexpr ::std::uint64_t xxh64(Range && range, ::std::uint64_t const seed = 0)
+        requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+    {
+        return xxh64_state{seed}.update(range).finalize();
+    }
+
+    /// @brief Callable wrapper around @ref xxh64 for use with @ref scl::hash::key.
+    /// @ingroup scl_utility_hash
+    ///
+    /// @tparam Seed  64-bit seed. Defaults to `0`.
+    template <::std::uint64_t Seed = 0>
+    struct xxh64_hasher
+    {
+        using result_type = ::std::uint64_t;
+        using state_type = xxh64_state;
+
+        template <::std::ranges::input_range Range>
+        constexpr result_type operator()(Range && range) const noexcept
+            requires ::std::convertible_to<::std::ranges::range_value_t<Range>, ::std::uint8_t>
+        {
+            return ::scl::hash::xxh64(range, Seed);
+        }
+
+        /// @brief Returns a fresh streaming state seeded with @p Seed.
+        constexpr state_type make_state() const noexcept { return state_type{Seed}; }
+    };
+
+} // namespace scl::hash
@@ -0,0 +1,124 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/case_fold.h>
+#include <scl/utility/hash/dispatch.h>
+#include <scl/utility/hash/fnv1a.h>
+#include <scl/utility/hash/key.h>
+#include <scl/utility/hash/rapidhash.h>
+#include <scl/utility/hash/siphash.h>
+#include <scl/utility/hash/xxh3.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+
+using namespace ::scl::hash;
+
+namespace
+{
+    /// Reference folding: byte-wise ASCII lower case.
+    ::std::string lower(::std::string_view const text)
+    {
+        ::std::string out{text};
+        for (auto & c : out)
+            if (c >= 'A' && c <= 'Z')
+                c = static_cast<char>(c - 'A' + 'a');
+        return out;
+    }
+
+    /// Every byte value, repeated with varying offsets, so all kernel tails are exercised.
+    ::std::string all_bytes(::std::size_t const n)
+    {
+        ::std::string text(n, '\0');
+        for (::std::size_t i = 0; i < n; ++i)
+            text[i] = static_cast<char>((i * 37 + i / 256) & 0xff);
+        return text;
+    }
+
+    using header = key<ci_hasher<fnv1a_hasher>>;
+
+    constexpr int classify(header const name)
+    {
+        switch (name)
+        {
+        case header{::std::string_view{"Content-Length"}}:
+            return 1;
+        case header{::std::string_view{"content-type"}}:
+            return 2;
+        default:
+            return 0;
+        }
+    }
+} // namespace
+
+/**
+ * @test Only A-Z are folded; the digest equals that of the lower-cased input.
+ */
+TEST(CaseFoldTest, MatchesLowerCasedInput)
+{
+    STATIC_EXPECT_EQ(fnv1a_ci(::std::string_view{"Content-Length"}),
+        fnv1a(::std::string_view{"content-length"}));
+    STATIC_EXPECT_EQ(siphash_ci(::std::string_view{"HOST"}), siphash(::std::string_view{"host"}));
+    STATIC_EXPECT_EQ(fnv1a_ci(::std::string_view{"@[`{"}), fnv1a(::std::string_view{"@[`{"}));
+
+    for (::std::size_t const n :
+        {0u, 1u, 7u, 8u, 15u, 16u, 31u, 32u, 33u, 255u, 4096u, 4097u, 10000u})
+    {
+        auto const text = all_bytes(n);
+        auto const folded = lower(text);
+        EXPECT_EQ(fnv1a_ci(text), fnv1a(folded)) << n;
+        EXPECT_EQ(siphash_ci(text), siphash(folded)) << n;
+        EXPECT_EQ(
+            (siphash_ci<1, 3>(text, siphash_key{1, 2})), (siphash<1, 3>(folded, siphash_key{1, 2})))
+            << n;
+        EXPECT_EQ(ci_hasher<xxh3_hasher<>>{}(text), xxh3_64(folded)) << n;
+        EXPECT_EQ(ci_hasher<rapidhash_hasher<>>{}(text), rapidhash(folded)) << n;
+    }
+}
+
+/**
+ * @test Every SIMD level folds identically.
+ */
+TEST(CaseFoldTest, SimdLevelsAgree)
+{
+    auto const text = all_bytes(1000);
+    auto const expected = xxh3_64(lower(text));
+    for (auto const level : {simd_level::scalar, simd_level::sse2, simd_level::avx2})
+    {
+        force_simd_level(level);
+        EXPECT_EQ(ci_hasher<xxh3_hasher<>>{}(text), expected) << static_cast<int>(level);
+        EXPECT_EQ(fnv1a_ci(text), fnv1a(lower(text))) << static_cast<int>(level);
+    }
+    reset_simd_level();
+}
+
+/**
+ * @test ci_state streams like the one-shot hasher and accepts non-contiguous input.
+ */
+TEST(CaseFoldTest, StreamingAndRanges)
+{
+    auto state = ci_hasher<siphash13_hasher<>>{}.make_state();
+    state.update(::std::string_view{"X-Forwarded"}).update(::std::string_view{"-FOR"});
+    EXPECT_EQ(state.finalize(), siphash13_hasher<>{}(::std::string_view{"x-forwarded-for"}));
+
+    ::std::string const text = "Accept-Encoding";
+    ::std::deque<char> const bytes(text.begin(), text.end());
+    EXPECT_EQ(fnv1a_ci(bytes), fnv1a(lower(text)));
+    EXPECT_EQ(ci_hasher<rapidhash_hasher<>>{}(bytes), rapidhash(lower(text)));
+}
+
+/**
+ * @test Case-insensitive keys work as case labels for any spelling.
+ */
+TEST(CaseFoldTest, KeySwitch)
+{
+    STATIC_EXPECT_EQ(classify(header{::std::string_view{"CONTENT-LENGTH"}}), 1);
+    STATIC_EXPECT_EQ(classify(header{::std::string_view{"Content-Type"}}), 2);
+    STATIC_EXPECT_EQ(classify(header{::std::string_view{"Content-Encoding"}}), 0);
+
+    ::std::string const runtime = "cOnTeNt-LeNgTh";
+    EXPECT_EQ(classify(header{runtime}), 1);
+    EXPECT_EQ(header{runtime}, header{::std::string_view{"content-length"}});
+}
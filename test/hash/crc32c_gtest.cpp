@@ -0,0 +1,201 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/crc32c.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+using namespace ::scl::hash;
+
+/// Reference-vector message of length N: bytes 0x00, 0x01, ..., (N - 1) mod 256.
+template <::std::size_t N>
+struct ref_message
+{
+    ::std::array<char, N> bytes{};
+
+    constexpr ref_message() noexcept
+    {
+        for (::std::size_t i = 0; i < N; ++i)
+            bytes[i] = static_cast<char>(i);
+    }
+
+    constexpr ::std::string_view view() const noexcept { return {bytes.data(), N}; }
+};
+
+/// Message of N identical bytes.
+template <::std::size_t N, char Byte>
+struct fill_message
+{
+    ::std::array<char, N> bytes{};
+
+    constexpr fill_message() noexcept { bytes.fill(Byte); }
+
+    constexpr ::std::string_view view() const noexcept { return {bytes.data(), N}; }
+};
+
+/**
+ * @test The standard check value and the iSCSI test vectors of RFC 3720, B.4.
+ */
+TEST(Crc32cTest, StandardVectors)
+{
+    STATIC_EXPECT_EQ(crc32c(::std::string_view{"123456789"}), 0xe3069283u);
+    STATIC_EXPECT_EQ(crc32c((fill_message<32, '\x00'>{}.view())), 0x8a9136aau);
+    STATIC_EXPECT_EQ(crc32c((fill_message<32, '\xff'>{}.view())), 0x62a8ab43u);
+    STATIC_EXPECT_EQ(crc32c(ref_message<32>{}.view()), 0x46dd794eu);
+
+    constexpr auto descending = [] {
+        ::std::array<char, 32> bytes{};
+        for (::std::size_t i = 0; i < bytes.size(); ++i)
+            bytes[i] = static_cast<char>(31 - i);
+        return bytes;
+    }();
+    STATIC_EXPECT_EQ(crc32c(descending), 0x113fdb5cu);
+}
+
+/**
+ * @test Reference vectors around the 8-byte slicing boundary.
+ *       Source: `google_crc32c.value(data)`.
+ */
+TEST(Crc32cTest, ReferenceVectors)
+{
+    STATIC_EXPECT_EQ(crc32c(::std::string_view{}), 0u);
+    STATIC_EXPECT_EQ(crc32c(::std::string_view{"hello"}), 0x9a71bb4cu);
+    STATIC_EXPECT_EQ(crc32c(ref_message<1>{}.view()), 0x527d5351u);
+    STATIC_EXPECT_EQ(crc32c(ref_message<7>{}.view()), 0xa359ed4cu);
+    STATIC_EXPECT_EQ(crc32c(ref_message<8>{}.view()), 0x8a2cbc3bu);
+    STATIC_EXPECT_EQ(crc32c(ref_message<9>{}.view()), 0x7144c5a8u);
+    STATIC_EXPECT_EQ(crc32c(ref_message<15>{}.view()), 0x68ef03f6u);
+    STATIC_EXPECT_EQ(crc32c(ref_message<16>{}.view()), 0xd9c908ebu);
+    STATIC_EXPECT_EQ(crc32c(ref_message<63>{}.view()), 0x7a873004u);
+    STATIC_EXPECT_EQ(crc32c(ref_message<64>{}.view()), 0xfb6d36ebu);
+    STATIC_EXPECT_EQ(crc32c(ref_message<255>{}.view()), 0x8953c482u);
+}
+
+/**
+ * @test String literals include the null terminator.
+ */
+TEST(Crc32cTest, StringLiteralIncludesTerminator)
+{
+    STATIC_EXPECT_EQ(crc32c("hello"), 0x5edff086u);
+    STATIC_EXPECT_NE(crc32c("hello"), crc32c(::std::string_view{"hello"}));
+}
+
+/**
+ * @test A long buffer crossing both interleaved lane sizes matches the reference.
+ *       Source: `google_crc32c.value(data)`.
+ */
+TEST(Crc32cTest, LongBuffer)
+{
+    ::std::vector<unsigned char> buffer(100000);
+    for (::std::size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = static_cast<unsigned char>(i * 37 + 11);
+    EXPECT_EQ(crc32c(buffer), 0xe20dc57cu);
+}
+
+/**
+ * @test Contiguous and non-contiguous ranges with the same bytes give the same
+ *       checksum for every length and buffer misalignment.
+ */
+TEST(Crc32cTest, ContiguousMatchesNonContiguous)
+{
+    ::std::vector<char> buffer(1000);
+    for (::std::size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = static_cast<char>(i * 37 + 11);
+
+    for (::std::size_t offset = 0; offset < 8; ++offset)
+    {
+        for (::std::size_t len = 0; len + offset <= buffer.size(); ++len)
+        {
+            ::std::string_view const view{buffer.data() + offset, len};
+            ::std::list<char> const list(view.begin(), view.end());
+            EXPECT_EQ(crc32c(view), crc32c(list)) << "len=" << len;
+        }
+    }
+}
+
+/**
+ * @test Passing a previous checksum continues the message.
+ */
+TEST(Crc32cTest, Chaining)
+{
+    STATIC_EXPECT_EQ(crc32c(::std::string_view{"56789"}, crc32c(::std::string_view{"1234"})),
+        0xe3069283u);
+    STATIC_EXPECT_EQ(crc32c(::std::string_view{}, 0x12345678u), 0x12345678u);
+}
+
+/**
+ * @test crc32c_combine merges the checksums of adjacent chunks.
+ */
+TEST(Crc32cTest, Combine)
+{
+    STATIC_EXPECT_EQ(crc32c_combine(crc32c(::std::string_view{"1234"}),
+                         crc32c(::std::string_view{"56789"}),
+                         5),
+        0xe3069283u);
+    STATIC_EXPECT_EQ(crc32c_combine(0xe3069283u, crc32c(::std::string_view{}), 0), 0xe3069283u);
+
+    ::std::vector<unsigned char> buffer(70000);
+    for (::std::size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = static_cast<unsigned char>(i * 131 + 7);
+    ::std::span<unsigned char const> const all{buffer};
+    for (::std::size_t const split : {0u, 1u, 8u, 767u, 24576u, 69999u, 70000u})
+    {
+        EXPECT_EQ(crc32c_combine(crc32c(all.first(split)),
+                      crc32c(all.subspan(split)),
+                      all.size() - split),
+            crc32c(all))
+            << "split=" << split;
+    }
+}
+
+/**
+ * @test Result type is std::uint32_t.
+ */
+TEST(Crc32cTest, ResultType)
+{
+    STATIC_EXPECT_TRUE((::std::is_same_v<decltype(crc32c("hello")), ::std::uint32_t>));
+    STATIC_EXPECT_TRUE((::std::is_same_v<crc32c_hasher::result_type, ::std::uint32_t>));
+}
+
+/**
+ * @test crc32c_hasher callable produces the same result as the free function.
+ */
+TEST(Crc32cTest, HasherMatchesFreeFunction)
+{
+    STATIC_EXPECT_EQ(crc32c_hasher{}("hello"), crc32c("hello"));
+}
+
+/**
+ * @test Streaming state fed in pieces matches the one-shot checksum at compile time.
+ */
+TEST(Crc32cTest, StateMatchesOneShot)
+{
+    STATIC_EXPECT_EQ(crc32c_state{}.finalize(), crc32c(::std::string_view{}));
+    constexpr auto streamed = crc32c_state{}
+                                  .update(::std::string_view{"a message "})
+                                  .update(::std::string_view{"in two parts"});
+    STATIC_EXPECT_EQ(
+        streamed.finalize(), crc32c(::std::string_view{"a message in two parts"}));
+}
+
+/**
+ * @test Splitting a message into equal chunks yields the one-shot checksum.
+ */
+TEST(Crc32cTest, StateSplitInvariant)
+{
+    ::std::string const message = "The quick brown fox jumps over the lazy dog, twice over.";
+    for (::std::size_t chunk = 1; chunk <= 20; ++chunk)
+    {
+        auto state = crc32c_hasher{}.make_state();
+        for (::std::size_t i = 0; i < message.size(); i += chunk)
+            state.update(::std::string_view{message}.substr(i, chunk));
+        EXPECT_EQ(state.finalize(), crc32c(::std::string_view{message})) << "chunk=" << chunk;
+    }
+}
@@ -0,0 +1,154 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/crc32c.h>
+#include <scl/utility/hash/dispatch.h>
+#include <scl/utility/hash/siphash_batch.h>
+#include <scl/utility/hash/xxh3.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace ::scl::hash;
+
+/// Every level, from scalar to the widest.
+inline constexpr simd_level all_levels[] = {simd_level::scalar,
+    simd_level::sse2,
+    simd_level::sse42,
+    simd_level::avx2,
+    simd_level::avx512};
+
+/// Restores the detected level when a test ends, even on failure.
+struct level_guard
+{
+    level_guard() = default;
+    level_guard(level_guard const &) = delete;
+    level_guard & operator=(level_guard const &) = delete;
+    ~level_guard() { reset_simd_level(); }
+};
+
+/// Pseudo-random test buffer.
+inline ::std::vector<unsigned char> make_buffer(::std::size_t const n)
+{
+    ::std::vector<unsigned char> buffer(n);
+    ::std::uint64_t x = 0x9e3779b97f4a7c15ull;
+    for (auto & b : buffer)
+    {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        b = static_cast<unsigned char>(x);
+    }
+    return buffer;
+}
+
+/**
+ * @test Detection is cached and the active level starts at the detected one.
+ */
+TEST(DispatchTest, DetectedLevelIsStable)
+{
+    EXPECT_EQ(detected_simd_level(), detected_simd_level());
+    EXPECT_EQ(active_simd_level(), detected_simd_level());
+#if SCL_HASH_X86_64
+    EXPECT_GE(detected_simd_level(), simd_level::sse2); // SSE2 is part of x86-64
+#else
+    EXPECT_EQ(detected_simd_level(), simd_level::scalar);
+#endif
+}
+
+/**
+ * @test Forcing a level clamps to the detected one; reset restores it.
+ */
+TEST(DispatchTest, ForceClampsAndResetRestores)
+{
+    level_guard const guard;
+    for (simd_level const level : all_levels)
+    {
+        simd_level const applied = force_simd_level(level);
+        EXPECT_EQ(applied, level < detected_simd_level() ? level : detected_simd_level());
+        EXPECT_EQ(active_simd_level(), applied);
+    }
+    reset_simd_level();
+    EXPECT_EQ(active_simd_level(), detected_simd_level());
+}
+
+/**
+ * @test XXH3-64 and XXH3-128 digests are identical at every level, one-shot and streamed.
+ */
+TEST(DispatchTest, Xxh3MatchesAcrossLevels)
+{
+    level_guard const guard;
+    auto const buffer = make_buffer(20000);
+    for (::std::size_t const n : {0u, 16u, 240u, 241u, 1023u, 1024u, 1025u, 5000u, 20000u})
+    {
+        ::std::span<unsigned char const> const data{buffer.data(), n};
+        force_simd_level(simd_level::scalar);
+        auto const ref64 = xxh3_64(data, 7);
+        auto const ref128 = xxh3_128(data, 7);
+        for (simd_level const level : all_levels)
+        {
+            force_simd_level(level);
+            EXPECT_EQ(xxh3_64(data, 7), ref64) << "n=" << n << " level=" << int(level);
+            EXPECT_EQ(xxh3_128(data, 7), ref128) << "n=" << n << " level=" << int(level);
+
+            xxh3_64_state state{7};
+            for (::std::size_t i = 0; i < n; i += 333)
+                state.update(data.subspan(i, n - i < 333 ? n - i : 333));
+            EXPECT_EQ(state.finalize(), ref64) << "n=" << n << " level=" << int(level);
+        }
+    }
+}
+
+/**
+ * @test CRC-32C checksums are identical at every level, across interleaved lane sizes.
+ */
+TEST(DispatchTest, Crc32cMatchesAcrossLevels)
+{
+    level_guard const guard;
+    auto const buffer = make_buffer(60000);
+    for (::std::size_t const n : {0u, 7u, 8u, 767u, 768u, 769u, 24575u, 24576u, 59993u})
+    {
+        ::std::span<unsigned char const> const data{buffer.data() + 3, n};
+        force_simd_level(simd_level::scalar);
+        auto const ref = crc32c(data);
+        for (simd_level const level : all_levels)
+        {
+            force_simd_level(level);
+            EXPECT_EQ(crc32c(data), ref) << "n=" << n << " level=" << int(level);
+        }
+    }
+}
+
+/**
+ * @test siphash_batch digests are identical at every level.
+ */
+TEST(DispatchTest, SiphashBatchMatchesAcrossLevels)
+{
+    level_guard const guard;
+    auto const buffer = make_buffer(256);
+    ::std::vector<::std::string> strings;
+    for (::std::size_t i = 0; i < 37; ++i)
+        strings.emplace_back(reinterpret_cast<char const *>(buffer.data()) + i, i * 5 % 43);
+    ::std::vector<::std::string_view> const inputs(strings.begin(), strings.end());
+
+    for (simd_level const level : all_levels)
+    {
+        force_simd_level(level);
+        ::std::vector<::std::uint64_t> out(inputs.size());
+        siphash_batch(inputs, out);
+        for (::std::size_t i = 0; i < inputs.size(); ++i)
+            EXPECT_EQ(out[i], siphash(inputs[i])) << "i=" << i << " level=" << int(level);
+    }
+}
+
+/**
+ * @test Constant evaluation does not depend on the runtime level.
+ */
+TEST(DispatchTest, ConstantEvaluationUnaffected)
+{
+    STATIC_EXPECT_EQ(crc32c(::std::string_view{"123456789"}), 0xe3069283u);
+    STATIC_EXPECT_EQ(xxh3_64(::std::string_view{"hello"}), 0x9555e8555c62dcfdull);
+}
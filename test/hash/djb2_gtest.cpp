@@ -2,6 +2,7 @@
 
 #include <scl/utility/hash/djb2.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <string_view>
 
@@ -65,3 +66,33 @@ TEST(Djb2Test, HasherMatchesFreeFunction)
 {
     STATIC_EXPECT_EQ(djb2_hasher{}("hello"), djb2("hello"));
 }
+
+/**
+ * @test Streaming state fed in pieces matches the one-shot digest at compile time.
+ */
+TEST(Djb2Test, StateMatchesOneShot)
+{
+    STATIC_EXPECT_EQ(djb2_state{}.finalize(), djb2(::std::string_view{}));
+    constexpr auto streamed =
+        djb2_state{}.update(::std::string_view{"foo"}).update(::std::string_view{"bar"});
+    STATIC_EXPECT_EQ(streamed.finalize(), djb2(::std::string_view{"foobar"}));
+}
+
+/**
+ * @test Every split point of a message yields the one-shot digest.
+ */
+TEST(Djb2Test, StateSplitInvariant)
+{
+    ::std::string_view const message{"The quick brown fox jumps over the lazy dog, twice over."};
+    for (::std::size_t i = 0; i <= message.size(); ++i)
+    {
+        for (::std::size_t j = i; j <= message.size(); ++j)
+        {
+            auto state = djb2_hasher{}.make_state();
+            state.update(message.substr(0, i));
+            state.update(message.substr(i, j - i));
+            state.update(message.substr(j));
+            EXPECT_EQ(state.finalize(), djb2(message)) << "split " << i << "/" << j;
+        }
+    }
+}
@@ -2,6 +2,7 @@
 
 #include <scl/utility/hash/fnv1a.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <string_view>
 #include <vector>
@@ -89,3 +90,33 @@ TEST(Fnv1aTest, HasherMatchesFreeFunction)
 {
     STATIC_EXPECT_EQ(fnv1a_hasher{}("hello"), fnv1a("hello"));
 }
+
+/**
+ * @test Streaming state fed in pieces matches the one-shot digest at compile time.
+ */
+TEST(Fnv1aTest, StateMatchesOneShot)
+{
+    STATIC_EXPECT_EQ(fnv1a_state{}.finalize(), fnv1a(::std::string_view{}));
+    constexpr auto streamed =
+        fnv1a_state{}.update(::std::string_view{"foo"}).update(::std::string_view{"bar"});
+    STATIC_EXPECT_EQ(streamed.finalize(), fnv1a(::std::string_view{"foobar"}));
+}
+
+/**
+ * @test Every split point of a message yields the one-shot digest.
+ */
+TEST(Fnv1aTest, StateSplitInvariant)
+{
+    ::std::string_view const message{"The quick brown fox jumps over the lazy dog, twice over."};
+    for (::std::size_t i = 0; i <= message.size(); ++i)
+    {
+        for (::std::size_t j = i; j <= message.size(); ++j)
+        {
+            auto state = fnv1a_hasher{}.make_state();
+            state.update(message.substr(0, i));
+            state.update(message.substr(i, j - i));
+            state.update(message.substr(j));
+            EXPECT_EQ(state.finalize(), fnv1a(message)) << "split " << i << "/" << j;
+        }
+    }
+}
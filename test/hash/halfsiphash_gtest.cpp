@@ -0,0 +1,116 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/halfsiphash.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+using namespace ::scl::hash;
+
+/// Reference-implementation test key (bytes 0x00..0x07, little-endian).
+inline constexpr halfsiphash_key test_key = halfsiphash_default_key;
+
+/// Reference-vector message of length N: bytes 0x00, 0x01, ..., N - 1.
+template <::std::size_t N>
+struct ref_message
+{
+    ::std::array<char, N> bytes{};
+
+    constexpr ref_message() noexcept
+    {
+        for (::std::size_t i = 0; i < N; ++i)
+            bytes[i] = static_cast<char>(i);
+    }
+
+    constexpr ::std::string_view view() const noexcept { return {bytes.data(), N}; }
+};
+
+/**
+ * @test Reference vectors for HalfSipHash-2-4 with a 32-bit digest.
+ *       Source: reference implementation by J.-P. Aumasson (vectors_hsip32).
+ */
+TEST(HalfSipHashTest, ReferenceVectors)
+{
+    STATIC_EXPECT_EQ(halfsiphash(::std::string_view{}, test_key), 0x5b9f35a9u);
+    STATIC_EXPECT_EQ(halfsiphash(ref_message<1>{}.view(), test_key), 0xb85a4727u);
+    STATIC_EXPECT_EQ(halfsiphash(ref_message<2>{}.view(), test_key), 0x03a662fau);
+    STATIC_EXPECT_EQ(halfsiphash(ref_message<3>{}.view(), test_key), 0x04e7fe8au);
+}
+
+/**
+ * @test Result type is std::uint32_t.
+ */
+TEST(HalfSipHashTest, ResultType)
+{
+    STATIC_EXPECT_TRUE((::std::is_same_v<decltype(halfsiphash("hello")), ::std::uint32_t>));
+    STATIC_EXPECT_TRUE((::std::is_same_v<halfsiphash_hasher<>::result_type, ::std::uint32_t>));
+}
+
+/**
+ * @test Different inputs and different keys produce different digests.
+ */
+TEST(HalfSipHashTest, DifferentInputsAndKeys)
+{
+    constexpr halfsiphash_key other_key{0xdeadbeefu, 0xcafebabeu};
+    STATIC_EXPECT_NE(halfsiphash("hello"), halfsiphash("world"));
+    STATIC_EXPECT_NE(halfsiphash("hello", test_key), halfsiphash("hello", other_key));
+}
+
+/**
+ * @test Round counts are part of the algorithm: HalfSipHash-1-3 differs from 2-4.
+ */
+TEST(HalfSipHashTest, RoundCounts)
+{
+    STATIC_EXPECT_NE((halfsiphash<1, 3>("hello")), halfsiphash("hello"));
+    STATIC_EXPECT_EQ((halfsiphash<2, 4>("hello")), halfsiphash("hello"));
+}
+
+/**
+ * @test Contiguous and non-contiguous ranges with the same bytes give the same
+ *       digest for every length and buffer misalignment.
+ */
+TEST(HalfSipHashTest, ContiguousMatchesNonContiguous)
+{
+    ::std::vector<char> buffer(40);
+    for (::std::size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = static_cast<char>(i * 37 + 11);
+
+    for (::std::size_t offset = 0; offset < 4; ++offset)
+    {
+        for (::std::size_t len = 0; len + offset <= buffer.size(); ++len)
+        {
+            ::std::string_view const view{buffer.data() + offset, len};
+            ::std::list<char> const list(view.begin(), view.end());
+            EXPECT_EQ(halfsiphash(view), halfsiphash(list)) << "len=" << len;
+        }
+    }
+}
+
+/**
+ * @test Every split point of a message yields the one-shot digest.
+ */
+TEST(HalfSipHashTest, StateSplitInvariant)
+{
+    ::std::string_view const message{"The quick brown fox jumps over the lazy dog."};
+    for (::std::size_t i = 0; i <= message.size(); ++i)
+    {
+        auto state = halfsiphash_hasher<>{}.make_state();
+        state.update(message.substr(0, i));
+        state.update(message.substr(i));
+        EXPECT_EQ(state.finalize(), halfsiphash(message)) << "split " << i;
+    }
+}
+
+/**
+ * @test halfsiphash_hasher callable produces the same result as the free function.
+ */
+TEST(HalfSipHashTest, HasherMatchesFreeFunction)
+{
+    STATIC_EXPECT_EQ(halfsiphash_hasher<>{}("hello"), halfsiphash("hello"));
+    STATIC_EXPECT_EQ((halfsiphash_hasher<test_key, 1, 3>{}("hello")), (halfsiphash<1, 3>("hello")));
+}
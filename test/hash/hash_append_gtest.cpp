@@ -0,0 +1,188 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/fnv1a.h>
+#include <scl/utility/hash/hash_append.h>
+#include <scl/utility/hash/siphash.h>
+#include <scl/utility/hash/xxh3.h>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace ::scl::hash;
+
+namespace app
+{
+    enum class color : ::std::uint16_t
+    {
+        red = 1,
+        green = 2,
+    };
+
+    struct route
+    {
+        ::std::string host;
+        ::std::uint16_t port{};
+        ::std::optional<::std::string> path;
+
+        friend bool operator==(route const &, route const &) = default;
+    };
+
+    template <concepts::hash_state State>
+    constexpr void hash_append(State & state, route const & r)
+    {
+        using ::scl::hash::hash_append;
+        hash_append(state, r.host);
+        hash_append(state, r.port);
+        hash_append(state, r.path);
+    }
+} // namespace app
+
+/// FNV-1a digest of @p value through the hash_append protocol.
+template <typename T>
+constexpr ::std::uint64_t appended(T const & value)
+{
+    fnv1a_state state;
+    hash_append(state, value);
+    return state.finalize();
+}
+
+/// FNV-1a digest of raw bytes.
+constexpr ::std::uint64_t bytes(::std::initializer_list<unsigned char> const list)
+{
+    return fnv1a(::std::span<unsigned char const>{list.begin(), list.size()});
+}
+
+/**
+ * @test Integers are appended as little-endian bytes of their width; enums as their underlying type.
+ */
+TEST(HashAppendTest, IntegralsAndEnums)
+{
+    STATIC_EXPECT_EQ(appended(::std::uint32_t{0x04030201}), bytes({1, 2, 3, 4}));
+    STATIC_EXPECT_EQ(appended(::std::int16_t{-2}), bytes({0xfe, 0xff}));
+    STATIC_EXPECT_EQ(appended(true), bytes({1}));
+    STATIC_EXPECT_EQ(appended(app::color::green), bytes({2, 0}));
+}
+
+#if defined(__SIZEOF_INT128__)
+/**
+ * @test 128-bit integers, where integral, are appended as all 16 little-endian bytes.
+ */
+TEST(HashAppendTest, Integrals128)
+{
+    __extension__ using u128 = unsigned __int128;
+    __extension__ using i128 = __int128;
+    []<typename U, typename I>() {
+        if constexpr (::std::integral<U>)
+        {
+            STATIC_EXPECT_NE(appended(U{1} << 100), appended(U{1} << 101));
+            STATIC_EXPECT_NE(appended(U{1} << 64), appended(U{1}));
+            STATIC_EXPECT_EQ(appended(U{0x0201} << 64 | 0x0807),
+                bytes({7, 8, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0}));
+            STATIC_EXPECT_EQ(appended(I{-2}),
+                bytes({0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff}));
+
+            // The one-update path for contiguous ranges writes the same bytes.
+            ::std::vector<U> const values{U{3} << 96, U{5}};
+            fnv1a_state state;
+            hash_append(state, values[0]);
+            hash_append(state, values[1]);
+            hash_append(state, ::std::uint64_t{2});
+            EXPECT_EQ(appended(values), state.finalize());
+        }
+    }.template operator()<u128, i128>();
+}
+#endif
+
+/**
+ * @test -0.0 and +0.0 hash equal; distinct values differ.
+ */
+TEST(HashAppendTest, FloatingPointNormalisesZero)
+{
+    STATIC_EXPECT_EQ(appended(-0.0), appended(0.0));
+    STATIC_EXPECT_EQ(appended(-0.0f), appended(0.0f));
+    STATIC_EXPECT_NE(appended(1.0), appended(-1.0));
+    STATIC_EXPECT_EQ(appended(1.0f), appended(::std::uint32_t{0x3f800000}));
+}
+
+/**
+ * @test Strings and contiguous containers append their elements, then the size as 8 bytes.
+ */
+TEST(HashAppendTest, ContiguousRanges)
+{
+    STATIC_EXPECT_EQ(appended(::std::string_view{"ab"}), bytes({'a', 'b', 2, 0, 0, 0, 0, 0, 0, 0}));
+    EXPECT_EQ(appended(::std::string{"ab"}), appended(::std::string_view{"ab"}));
+    EXPECT_EQ(appended(::std::vector<char>{'a', 'b'}), appended(::std::string_view{"ab"}));
+
+    // Runtime bulk path and constant-evaluated element path agree.
+    constexpr ::std::array<::std::uint32_t, 2> words{0x04030201, 0x08070605};
+    constexpr auto expected = bytes({1, 2, 3, 4, 5, 6, 7, 8, 2, 0, 0, 0, 0, 0, 0, 0});
+    STATIC_EXPECT_EQ(appended(words), expected);
+    EXPECT_EQ(appended(::std::vector<::std::uint32_t>(words.begin(), words.end())), expected);
+
+    // The trailing size separates different splits of the same characters.
+    using parts = ::std::vector<::std::string>;
+    EXPECT_NE(appended(parts{"ab", "c"}), appended(parts{"a", "bc"}));
+}
+
+/**
+ * @test Pairs and tuples append their elements in order; optionals a flag byte first.
+ */
+TEST(HashAppendTest, TuplesAndOptionals)
+{
+    STATIC_EXPECT_EQ(appended(::std::pair{::std::uint8_t{1}, ::std::uint8_t{2}}), bytes({1, 2}));
+    STATIC_EXPECT_EQ(appended(::std::tuple{::std::uint8_t{1}, ::std::uint8_t{2}}), bytes({1, 2}));
+    STATIC_EXPECT_EQ(appended(::std::optional<::std::uint8_t>{}), bytes({0}));
+    STATIC_EXPECT_EQ(appended(::std::optional<::std::uint8_t>{7}), bytes({1, 7}));
+    EXPECT_NE(appended(::std::pair{1, 2}), appended(::std::pair{2, 1}));
+}
+
+/**
+ * @test Standard containers of user types reach the user overload through ADL.
+ */
+TEST(HashAppendTest, NestedUserTypes)
+{
+    app::route const r{"example.org", 443, "/index"};
+    fnv1a_state manual;
+    hash_append(manual, ::std::string_view{"example.org"});
+    hash_append(manual, ::std::uint16_t{443});
+    hash_append(manual, ::std::optional<::std::string>{"/index"});
+    EXPECT_EQ(appended(r), manual.finalize());
+
+    using table = ::std::vector<::std::pair<int, app::route>>;
+    EXPECT_EQ(appended(table{{1, r}}), appended(table{{1, r}}));
+    EXPECT_NE(appended(table{{1, r}}), appended(table{{2, r}}));
+}
+
+/**
+ * @test hasher<State> works as the Hash of ::std::unordered_map and honours a keyed prototype.
+ */
+TEST(HashAppendTest, HasherAdapter)
+{
+    ::std::unordered_map<app::route, int, hasher<>> cache;
+    cache[{"a", 1, ::std::nullopt}] = 1;
+    cache[{"a", 1, "/x"}] = 2;
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ((cache.at({"a", 1, "/x"})), 2);
+
+    ::std::pair<::std::string, int> const value{"key", 42};
+    siphash13_state reference;
+    hash_append(reference, value);
+    EXPECT_EQ(hasher<>{}(value), reference.finalize());
+
+    constexpr siphash_key other_key{1, 2};
+    EXPECT_NE(hasher<siphash13_state>{siphash13_state{other_key}}(value), hasher<>{}(value));
+
+    // 128-bit and 32-bit digests are folded into ::std::size_t.
+    EXPECT_NE(hasher<xxh3_128_state>{}(value),
+        hasher<xxh3_128_state>{}(::std::pair<::std::string, int>{"key", 43}));
+    STATIC_EXPECT_EQ(
+        hasher<fnv1a_state>{}(::std::uint8_t{1}), static_cast<::std::size_t>(bytes({1})));
+}
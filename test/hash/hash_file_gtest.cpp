@@ -0,0 +1,169 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/crc32c.h>
+#include <scl/utility/hash/fnv1a.h>
+#include <scl/utility/hash/hash_file.h>
+#include <scl/utility/hash/rapidhash.h>
+#include <scl/utility/hash/siphash.h>
+#include <scl/utility/hash/xxh3.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if __has_include(<sys/stat.h>) && __has_include(<unistd.h>)
+#include <sys/stat.h>
+#include <unistd.h>
+#define SCL_TEST_HAS_FIFO 1
+#else
+#define SCL_TEST_HAS_FIFO 0
+#endif
+
+using namespace ::scl::hash;
+
+namespace
+{
+    /// Pseudo-random test buffer.
+    ::std::vector<unsigned char> make_buffer(::std::size_t const n)
+    {
+        ::std::vector<unsigned char> buffer(n);
+        ::std::uint64_t x = 0x9e3779b97f4a7c15ull;
+        for (auto & b : buffer)
+        {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            b = static_cast<unsigned char>(x);
+        }
+        return buffer;
+    }
+
+    /// A file in the temporary directory, removed on destruction.
+    struct temp_file
+    {
+        ::std::filesystem::path path;
+
+        explicit temp_file(::std::string const & name)
+            : path{::std::filesystem::temp_directory_path() / ("scl_hash_file_" + name)}
+        {}
+
+        temp_file(::std::string const & name, ::std::vector<unsigned char> const & bytes)
+            : temp_file{name}
+        {
+            ::std::ofstream out{path, ::std::ios::binary};
+            out.write(reinterpret_cast<char const *>(bytes.data()),
+                static_cast<::std::streamsize>(bytes.size()));
+        }
+
+        ~temp_file()
+        {
+            ::std::error_code ec;
+            ::std::filesystem::remove(path, ec);
+        }
+    };
+} // namespace
+
+/**
+ * @test A mapped file hashes to the same digest as its bytes in memory.
+ */
+TEST(HashFileTest, MatchesInMemoryDigest)
+{
+    for (::std::size_t const size : {1u, 7u, 64u, 4096u, 100000u, 3u << 20})
+    {
+        auto const bytes = make_buffer(size);
+        temp_file const file{"mapped", bytes};
+        EXPECT_EQ(hash_file<fnv1a_hasher>(file.path), fnv1a(bytes)) << size;
+        EXPECT_EQ(hash_file<siphash_hasher<>>(file.path), siphash(bytes)) << size;
+        EXPECT_EQ(hash_file<xxh3_128_hasher<>>(file.path), xxh3_128(bytes)) << size;
+        EXPECT_EQ(hash_file<crc32c_hasher>(file.path), crc32c(bytes)) << size;
+        EXPECT_EQ(hash_file<rapidhash_hasher<>>(file.path), rapidhash(bytes)) << size;
+    }
+}
+
+/**
+ * @test An empty file hashes like an empty range.
+ */
+TEST(HashFileTest, EmptyFile)
+{
+    temp_file const file{"empty", {}};
+    EXPECT_EQ(hash_file<fnv1a_hasher>(file.path), fnv1a(::std::vector<unsigned char>{}));
+    EXPECT_EQ(hash_file<rapidhash_hasher<>>(file.path), rapidhash(::std::vector<unsigned char>{}));
+}
+
+/**
+ * @test update_file feeds a file into a state; several files hash as their concatenation.
+ */
+TEST(HashFileTest, UpdateFileConcatenates)
+{
+    auto const bytes = make_buffer(5000);
+    ::std::vector<unsigned char> const head(bytes.begin(), bytes.begin() + 1234);
+    ::std::vector<unsigned char> const tail(bytes.begin() + 1234, bytes.end());
+    temp_file const first{"head", head};
+    temp_file const second{"tail", tail};
+
+    auto state = xxh3_hasher<>{}.make_state();
+    update_file(state, first.path);
+    update_file(state, second.path);
+    EXPECT_EQ(state.finalize(), xxh3_64(bytes));
+}
+
+/**
+ * @test A missing file reports an error code or throws filesystem_error.
+ */
+TEST(HashFileTest, MissingFile)
+{
+    auto const path = ::std::filesystem::temp_directory_path() / "scl_hash_file_missing";
+    ::std::error_code ec;
+    (void)hash_file<fnv1a_hasher>(path, ec);
+    EXPECT_EQ(ec, ::std::errc::no_such_file_or_directory);
+    EXPECT_THROW((void)hash_file<fnv1a_hasher>(path), ::std::filesystem::filesystem_error);
+
+    fnv1a_state state;
+    EXPECT_THROW(update_file(state, path), ::std::filesystem::filesystem_error);
+}
+
+#if SCL_TEST_HAS_FIFO
+/**
+ * @test A pipe cannot be mapped; it is read in blocks and gives the same digest.
+ */
+TEST(HashFileTest, PipeIsReadInBlocks)
+{
+    auto const bytes = make_buffer(3 * hash_file_block_size + 17);
+    temp_file const fifo{"fifo"};
+    ASSERT_EQ(::mkfifo(fifo.path.c_str(), 0600), 0);
+
+    for (int const round : {0, 1})
+    {
+        ::std::jthread writer{[&] {
+            ::std::ofstream out{fifo.path, ::std::ios::binary};
+            out.write(reinterpret_cast<char const *>(bytes.data()),
+                static_cast<::std::streamsize>(bytes.size()));
+        }};
+        if (round == 0)
+            EXPECT_EQ(hash_file<siphash_hasher<>>(fifo.path), siphash(bytes));
+        else
+            EXPECT_EQ(hash_file<rapidhash_hasher<>>(fifo.path), rapidhash(bytes));
+    }
+}
+#endif
+
+#if defined(__linux__)
+/**
+ * @test procfs files report size 0 but have contents; they are read, not mapped.
+ */
+TEST(HashFileTest, ProcfsFile)
+{
+    ::std::filesystem::path const path{"/proc/self/cmdline"};
+    ::std::ifstream in{path, ::std::ios::binary};
+    ::std::vector<unsigned char> const bytes{
+        ::std::istreambuf_iterator<char>{in}, ::std::istreambuf_iterator<char>{}};
+    ASSERT_FALSE(bytes.empty());
+    EXPECT_EQ(hash_file<xxh3_hasher<>>(path), xxh3_64(bytes));
+}
+#endif
@@ -0,0 +1,129 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/fnv1a.h>
+#include <scl/utility/hash/hashed_string.h>
+#include <scl/utility/hash/intern_pool.h>
+#include <scl/utility/hash/transparent.h>
+#include <scl/utility/hash/xxh3.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace ::scl::hash;
+using namespace ::std::literals;
+
+namespace
+{
+    /// Digest = length: every two strings of equal length collide.
+    struct length_hasher
+    {
+        using result_type = ::std::uint64_t;
+
+        template <::std::ranges::input_range Range>
+        constexpr result_type operator()(Range && range) const noexcept
+        {
+            return static_cast<result_type>(::std::ranges::distance(range));
+        }
+    };
+} // namespace
+
+/**
+ * @test Short strings are stored inline, long ones by pointer; both keep their text and key.
+ */
+TEST(HashedStringTest, Layout)
+{
+    EXPECT_EQ(sizeof(hashed_string<>), 24u);
+    EXPECT_EQ(sizeof(hashed_string<xxh3_128_hasher<>>), 32u);
+
+    ::std::string const long_text = "a string longer than twelve bytes";
+    for (auto const text :
+        {""sv, "ab"sv, "abcd"sv, "twelve bytes"sv, ::std::string_view{long_text}})
+    {
+        hashed_string<> const s{text};
+        EXPECT_EQ(s.view(), text);
+        EXPECT_EQ(s.size(), text.size());
+        EXPECT_EQ(s.key(), key<>{text});
+        EXPECT_EQ(s.prefix(), text.substr(0, 4));
+        EXPECT_EQ(s.is_inline(), text.size() <= 12);
+    }
+
+    ::std::string buffer = "short";
+    hashed_string<> const copy{::std::string_view{buffer}};
+    buffer = "other";
+    EXPECT_EQ(copy.view(), "short");
+    EXPECT_NE(hashed_string<>{long_text}.data(), nullptr);
+    EXPECT_EQ(hashed_string<>{long_text}.data(), long_text.data());
+    EXPECT_TRUE(hashed_string<>{}.empty());
+}
+
+/**
+ * @test Equality matches string equality for inline and pointer forms, and against string_view.
+ */
+TEST(HashedStringTest, Equality)
+{
+    ::std::string const a = "customer_region_europe";
+    ::std::string const b = "customer_region_europe";
+    ::std::string const c = "customer_region_asia__";
+
+    EXPECT_EQ(hashed_string<>{a}, hashed_string<>{b});
+    EXPECT_NE(hashed_string<>{a}, hashed_string<>{c});
+    EXPECT_EQ(hashed_string<>{"abc"sv}, hashed_string<>{"abc"sv});
+    EXPECT_NE(hashed_string<>{"abc"sv}, hashed_string<>{"abd"sv});
+    EXPECT_NE(hashed_string<>{"abcdefghijk"sv}, hashed_string<>{"abcdefghijl"sv});
+    EXPECT_NE(hashed_string<>{"abc"sv}, hashed_string<>{"abc\0"sv});
+
+    EXPECT_FALSE(hashed_string<>{a} == ""sv);
+    EXPECT_TRUE(hashed_string<>{a} == ::std::string_view{b});
+    EXPECT_FALSE(hashed_string<>{a} == ::std::string_view{c});
+    EXPECT_TRUE(::std::string_view{"x"} == hashed_string<>{"x"sv});
+    EXPECT_TRUE(hashed_string<>{} == ""sv);
+}
+
+/**
+ * @test When digests collide, the remaining bytes still decide equality.
+ */
+TEST(HashedStringTest, DigestCollision)
+{
+    ::std::string const a = "collision-left-side";
+    ::std::string const b = "collision-rght-side";
+    ASSERT_EQ(key<length_hasher>{a}, key<length_hasher>{b});
+    EXPECT_NE(hashed_string<length_hasher>{a}, hashed_string<length_hasher>{b});
+    EXPECT_NE(
+        hashed_string<length_hasher>{"inline-a"sv}, hashed_string<length_hasher>{"inline-b"sv});
+}
+
+/**
+ * @test std::hash uses the cached digest, and keyed text converts without re-hashing.
+ */
+TEST(HashedStringTest, HashAndKeyedText)
+{
+    hashed_string<fnv1a_hasher> const s{"group_by_column"sv};
+    EXPECT_EQ(::std::hash<hashed_string<fnv1a_hasher>>{}(s),
+        ::std::hash<key<fnv1a_hasher>>{}(s.key()));
+
+    // The given key is kept as is: it is not recomputed from the bytes.
+    key<fnv1a_hasher> const other{"other"sv};
+    EXPECT_EQ((hashed_string<fnv1a_hasher>{other, "text"sv}.key()), other);
+
+    intern_pool<> pool;
+    auto const h = pool.intern("interned label value");
+    hashed_string<> const from_handle{h};
+    EXPECT_EQ(from_handle.view().data(), h.view().data());
+    EXPECT_EQ(from_handle.key(), h.key());
+    EXPECT_EQ(hashed_string<>{key_view<>{"kv"sv}}.key(), key<>{"kv"sv});
+
+    ::std::unordered_map<hashed_string<>, int> groups;
+    ::std::string const rows[] = {"alpha-region-1", "beta", "alpha-region-1", "beta", "gamma"};
+    for (auto const & r : rows)
+        ++groups[hashed_string<>{r}];
+    EXPECT_EQ(groups.size(), 3u);
+    EXPECT_EQ(groups.at(hashed_string<>{"alpha-region-1"sv}), 2);
+
+    ::std::unordered_set<::std::string, transparent_hash<>, transparent_equal> names{"beta"};
+    EXPECT_TRUE(names.contains(hashed_string<>{"beta"sv}));
+}
@@ -0,0 +1,136 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/intern_pool.h>
+#include <scl/utility/hash/xxh3.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+using namespace ::scl::hash;
+using namespace ::std::literals;
+
+namespace
+{
+    /// Digest = length: every two strings of equal length collide.
+    struct length_hasher
+    {
+        using result_type = ::std::uint64_t;
+
+        template <::std::ranges::input_range Range>
+        constexpr result_type operator()(Range && range) const noexcept
+        {
+            return static_cast<result_type>(::std::ranges::distance(range));
+        }
+    };
+} // namespace
+
+/**
+ * @test Interning returns one handle per distinct string, with its key and a NUL-terminated copy.
+ */
+TEST(InternPoolTest, Basics)
+{
+    intern_pool<> pool;
+    EXPECT_EQ(pool.size(), 0u);
+    EXPECT_FALSE(pool.find("cpu"));
+
+    ::std::string text = "cpu";
+    auto const a = pool.intern(text);
+    text = "xyz";
+    auto const b = pool.intern("cpu");
+    auto const c = pool.intern("memory");
+    auto const empty = pool.intern("");
+
+    EXPECT_TRUE(a);
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+    EXPECT_EQ(a.view(), "cpu");
+    EXPECT_EQ(a.key(), key<>{"cpu"sv});
+    EXPECT_EQ(::std::strcmp(c.c_str(), "memory"), 0);
+    EXPECT_EQ(c.size(), 6u);
+    EXPECT_EQ(empty.view(), "");
+    EXPECT_EQ(*empty.c_str(), '\0');
+    EXPECT_EQ(pool.size(), 3u);
+
+    EXPECT_EQ(pool.find("memory"), c);
+    EXPECT_EQ(pool.find(key<>{"memory"sv}), c);
+    EXPECT_FALSE(pool.find("disk"));
+    EXPECT_EQ(::std::hash<interned<>>{}(a), ::std::hash<key<>>{}(key<>{"cpu"sv}));
+
+    ::std::unordered_set<interned<>> handles{a, b, c};
+    EXPECT_EQ(handles.size(), 2u);
+}
+
+/**
+ * @test Strings stay in place as the arena grows, including those larger than a chunk.
+ */
+TEST(InternPoolTest, StableViews)
+{
+    intern_pool<xxh3_128_hasher<>> pool;
+    ::std::vector<interned<xxh3_128_hasher<>>> handles;
+    ::std::vector<::std::string> texts;
+    for (::std::size_t i = 0; i < 20000; ++i)
+        texts.push_back("label/" + ::std::string(i % 97, 'x') + ::std::to_string(i));
+    texts.push_back(::std::string(intern_pool<>::chunk_size * 2, 'L'));
+    for (auto const & t : texts)
+        handles.push_back(pool.intern(t));
+
+    ASSERT_EQ(pool.size(), texts.size());
+    for (::std::size_t i = 0; i < texts.size(); ++i)
+    {
+        ASSERT_EQ(handles[i].view(), texts[i]);
+        ASSERT_EQ(handles[i].key(), key<xxh3_128_hasher<>>{texts[i]});
+        ASSERT_EQ(pool.intern(texts[i]), handles[i]);
+    }
+    EXPECT_GE(pool.arena_bytes(), texts.back().size());
+}
+
+/**
+ * @test A different string with an interned digest is rejected, and the pool is unchanged.
+ */
+TEST(InternPoolTest, Collision)
+{
+    intern_pool<length_hasher> pool;
+    auto const ab = pool.intern("ab");
+    EXPECT_THROW(static_cast<void>(pool.intern("cd")), ::std::invalid_argument);
+    EXPECT_FALSE(pool.find("cd"));
+    EXPECT_EQ(pool.find(key<length_hasher>{"cd"sv}), ab);
+    EXPECT_EQ(pool.intern("ab"), ab);
+    EXPECT_EQ(pool.size(), 1u);
+}
+
+/**
+ * @test Threads interning overlapping labels all receive the same handle per label.
+ */
+TEST(InternPoolTest, Concurrent)
+{
+    constexpr int threads = 8;
+    constexpr int labels = 5000;
+    intern_pool<> pool;
+    ::std::vector<::std::vector<interned<>>> seen(threads);
+    {
+        ::std::vector<::std::jthread> workers;
+        for (int t = 0; t < threads; ++t)
+            workers.emplace_back([&, t] {
+                for (int round = 0; round < 4; ++round)
+                    for (int i = 0; i < labels; ++i)
+                    {
+                        auto const label = (i + t * 7 + round) % labels;
+                        auto const h = pool.intern("metric." + ::std::to_string(label));
+                        if (round == 0)
+                            seen[t].push_back(h);
+                    }
+            });
+    }
+    EXPECT_EQ(pool.size(), static_cast<::std::size_t>(labels));
+    for (int t = 0; t < threads; ++t)
+        for (auto const h : seen[t])
+            ASSERT_EQ(pool.find(h.view()), h);
+}
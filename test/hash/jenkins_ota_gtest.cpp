@@ -2,6 +2,7 @@
 
 #include <scl/utility/hash/jenkins_ota.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <string_view>
 
@@ -53,3 +54,33 @@ TEST(JenkinsOtaTest, HasherMatchesFreeFunction)
 {
     STATIC_EXPECT_EQ(jenkins_ota_hasher{}("hello"), jenkins_ota("hello"));
 }
+
+/**
+ * @test Streaming state fed in pieces matches the one-shot digest at compile time.
+ */
+TEST(JenkinsOtaTest, StateMatchesOneShot)
+{
+    STATIC_EXPECT_EQ(jenkins_ota_state{}.finalize(), jenkins_ota(::std::string_view{}));
+    constexpr auto streamed =
+        jenkins_ota_state{}.update(::std::string_view{"foo"}).update(::std::string_view{"bar"});
+    STATIC_EXPECT_EQ(streamed.finalize(), jenkins_ota(::std::string_view{"foobar"}));
+}
+
+/**
+ * @test Every split point of a message yields the one-shot digest.
+ */
+TEST(JenkinsOtaTest, StateSplitInvariant)
+{
+    ::std::string_view const message{"The quick brown fox jumps over the lazy dog, twice over."};
+    for (::std::size_t i = 0; i <= message.size(); ++i)
+    {
+        for (::std::size_t j = i; j <= message.size(); ++j)
+        {
+            auto state = jenkins_ota_hasher{}.make_state();
+            state.update(message.substr(0, i));
+            state.update(message.substr(i, j - i));
+            state.update(message.substr(j));
+            EXPECT_EQ(state.finalize(), jenkins_ota(message)) << "split " << i << "/" << j;
+        }
+    }
+}
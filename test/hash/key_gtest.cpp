@@ -1,12 +1,19 @@
 #include <gtest_utils.h>
 
+#include <scl/utility/hash/crc32c.h>
 #include <scl/utility/hash/djb2.h>
 #include <scl/utility/hash/fnv1a.h>
+#include <scl/utility/hash/halfsiphash.h>
 #include <scl/utility/hash/jenkins_ota.h>
 #include <scl/utility/hash/key.h>
+#include <scl/utility/hash/murmur3.h>
+#include <scl/utility/hash/rapidhash.h>
 #include <scl/utility/hash/sdbm.h>
 #include <scl/utility/hash/siphash.h>
+#include <scl/utility/hash/xxh3.h>
+#include <scl/utility/hash/xxh64.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <string_view>
@@ -29,7 +36,16 @@ TEST(KeyTypeTest, ValueTypeDeduction)
     STATIC_EXPECT_TRUE((::std::is_same_v<key<djb2_hasher>::value_type, ::std::uint64_t>));
     STATIC_EXPECT_TRUE((::std::is_same_v<key<sdbm_hasher>::value_type, ::std::uint64_t>));
     STATIC_EXPECT_TRUE((::std::is_same_v<key<jenkins_ota_hasher>::value_type, ::std::uint32_t>));
+    STATIC_EXPECT_TRUE((::std::is_same_v<key<crc32c_hasher>::value_type, ::std::uint32_t>));
     STATIC_EXPECT_TRUE((::std::is_same_v<key<siphash_hasher<>>::value_type, ::std::uint64_t>));
+    STATIC_EXPECT_TRUE((::std::is_same_v<key<siphash13_hasher<>>::value_type, ::std::uint64_t>));
+    STATIC_EXPECT_TRUE((::std::is_same_v<key<halfsiphash_hasher<>>::value_type, ::std::uint32_t>));
+    STATIC_EXPECT_TRUE((::std::is_same_v<key<xxh64_hasher<>>::value_type, ::std::uint64_t>));
+    STATIC_EXPECT_TRUE((::std::is_same_v<key<xxh3_hasher<>>::value_type, ::std::uint64_t>));
+    STATIC_EXPECT_TRUE((::std::is_same_v<key<rapidhash_hasher<>>::value_type, ::std::uint64_t>));
+    STATIC_EXPECT_TRUE((::std::is_same_v<key<siphash128_hasher<>>::value_type, uint128>));
+    STATIC_EXPECT_TRUE((::std::is_same_v<key<xxh3_128_hasher<>>::value_type, uint128>));
+    STATIC_EXPECT_TRUE((::std::is_same_v<key<murmur3_x64_128_hasher<>>::value_type, uint128>));
 }
 
 /**
@@ -49,7 +65,28 @@ TEST(KeyTypeTest, ValueMatchesHasherFreeFunction)
     STATIC_EXPECT_EQ(key<djb2_hasher>{"hello"}.value, djb2("hello"));
     STATIC_EXPECT_EQ(key<sdbm_hasher>{"hello"}.value, sdbm("hello"));
     STATIC_EXPECT_EQ(key<jenkins_ota_hasher>{"hello"}.value, jenkins_ota("hello"));
+    STATIC_EXPECT_EQ(key<crc32c_hasher>{"hello"}.value, crc32c("hello"));
     STATIC_EXPECT_EQ(key<siphash_hasher<>>{"hello"}.value, siphash("hello"));
+    STATIC_EXPECT_EQ(key<siphash13_hasher<>>{"hello"}.value, (siphash<1, 3>("hello")));
+    STATIC_EXPECT_EQ(key<halfsiphash_hasher<>>{"hello"}.value, halfsiphash("hello"));
+    STATIC_EXPECT_EQ(key<xxh64_hasher<>>{"hello"}.value, xxh64("hello"));
+    STATIC_EXPECT_EQ(key<xxh3_hasher<>>{"hello"}.value, xxh3_64("hello"));
+    STATIC_EXPECT_EQ(key<rapidhash_hasher<>>{"hello"}.value, rapidhash("hello"));
+    STATIC_EXPECT_EQ(key<siphash128_hasher<>>{"hello"}.value, siphash128("hello"));
+    STATIC_EXPECT_EQ(key<xxh3_128_hasher<>>{"hello"}.value, xxh3_128("hello"));
+    STATIC_EXPECT_EQ(key<murmur3_x64_128_hasher<>>{"hello"}.value, murmur3_x64_128("hello"));
+}
+
+/**
+ * @test Only integral digests of at most 64 bits and uint128 satisfy the digest concept.
+ */
+TEST(KeyTypeTest, DigestConcept)
+{
+    STATIC_EXPECT_TRUE(concepts::digest<::std::uint32_t>);
+    STATIC_EXPECT_TRUE(concepts::digest<::std::uint64_t>);
+    STATIC_EXPECT_TRUE(concepts::digest<uint128>);
+    STATIC_EXPECT_FALSE(concepts::digest<double>);
+    STATIC_EXPECT_TRUE(concepts::byte_hasher<xxh3_128_hasher<>>);
 }
 
 // ============================================================================
@@ -297,3 +334,56 @@ TEST(KeyCrossAlgorithmTest, AllHashersDistinct)
     STATIC_EXPECT_NE(h_djb, h_sip);
     STATIC_EXPECT_NE(h_sdb, h_sip);
 }
+
+// ============================================================================
+// 128-bit digests
+// ============================================================================
+
+/// Tag type parameterized by a compile-time 128-bit content identifier.
+template <key<xxh3_128_hasher<>> K>
+struct content_tag
+{
+    static constexpr key<xxh3_128_hasher<>> id = K;
+};
+
+/**
+ * @test 128-bit keys compare, order and stay usable as NTTPs.
+ */
+TEST(Key128Test, ComparisonAndNttp)
+{
+    using id128 = key<xxh3_128_hasher<>>;
+    STATIC_EXPECT_EQ(id128{"object/1"}, id128{"object/1"});
+    STATIC_EXPECT_NE(id128{"object/1"}, id128{"object/2"});
+    STATIC_EXPECT_TRUE((id128{"object/1"} < id128{"object/2"}) !=
+        (id128{"object/2"} < id128{"object/1"}));
+    STATIC_EXPECT_FALSE(
+        (::std::is_same_v<content_tag<id128{"object/1"}>, content_tag<id128{"object/2"}>>));
+    STATIC_EXPECT_EQ(content_tag<id128{"object/1"}>::id, id128{"object/1"});
+}
+
+/**
+ * @test std::hash folds both halves of a 128-bit digest.
+ */
+TEST(Key128Test, StdHashFoldsDigest)
+{
+    using id128 = key<siphash128_hasher<>>;
+    constexpr ::std::hash<id128> h{};
+    constexpr id128 k{"content"};
+    STATIC_EXPECT_EQ(h(k), ::std::hash<uint128>{}(k.value));
+    STATIC_EXPECT_NE(h(k), static_cast<::std::size_t>(k.value.lo));
+    STATIC_EXPECT_NE(h(k), static_cast<::std::size_t>(k.value.hi));
+}
+
+/**
+ * @test 128-bit keys are usable in unordered containers.
+ */
+TEST(Key128Test, UnorderedMapKey)
+{
+    using id128 = key<murmur3_x64_128_hasher<>>;
+    ::std::unordered_map<id128, int> map;
+    map[id128{"blob_a"}] = 1;
+    map[id128{"blob_b"}] = 2;
+    EXPECT_EQ(map.at(id128{"blob_a"}), 1);
+    EXPECT_EQ(map.at(id128{"blob_b"}), 2);
+    EXPECT_EQ(map.size(), 2u);
+}
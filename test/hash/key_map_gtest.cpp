@@ -0,0 +1,226 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/fnv1a.h>
+#include <scl/utility/hash/key_map.h>
+#include <scl/utility/hash/mix.h>
+#include <scl/utility/hash/xxh3.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace ::scl::hash;
+
+namespace
+{
+    /// A key with digest @p d, bypassing the hasher.
+    key<> digest_key(::std::uint64_t const d)
+    {
+        key<> k{::std::string_view{}};
+        k.value = d;
+        return k;
+    }
+} // namespace
+
+/**
+ * @test Insertion, lookup, assignment and erasure behave as in std::unordered_map.
+ */
+TEST(KeyMapTest, Basics)
+{
+    key_map<int> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(key<>{"missing"}), map.end());
+    EXPECT_EQ(map.erase(key<>{"missing"}), 0u);
+
+    map[key<>{"one"}] = 1;
+    EXPECT_TRUE(map.insert({key<>{"two"}, 2}).second);
+    EXPECT_FALSE(map.insert({key<>{"two"}, 20}).second);
+    EXPECT_FALSE(map.try_emplace(key<>{"one"}, 10).second);
+    EXPECT_TRUE(map.insert_or_assign(key<>{"three"}, 3).second);
+    EXPECT_FALSE(map.insert_or_assign(key<>{"three"}, 30).second);
+
+    EXPECT_EQ(map.size(), 3u);
+    EXPECT_EQ(map.at(key<>{"one"}), 1);
+    EXPECT_EQ(map.find(key<>{"two"})->second, 2);
+    EXPECT_EQ(map[key<>{"three"}], 30);
+    EXPECT_TRUE(map.contains(key<>{"two"}));
+    EXPECT_THROW(static_cast<void>(map.at(key<>{"four"})), ::std::out_of_range);
+
+    EXPECT_EQ(map.erase(key<>{"two"}), 1u);
+    EXPECT_FALSE(map.contains(key<>{"two"}));
+    EXPECT_EQ(map.size(), 2u);
+
+    int sum = 0;
+    for (auto const & [k, v] : map)
+        sum += v;
+    EXPECT_EQ(sum, 31);
+
+    auto const copy = map;
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(copy.size(), 2u);
+    EXPECT_EQ(copy.at(key<>{"one"}), 1);
+
+    key_map<int> const init{{key<>{"a"}, 1}, {key<>{"b"}, 2}};
+    EXPECT_EQ(init.at(key<>{"b"}), 2);
+}
+
+/**
+ * @test Random inserts, lookups and erasures agree with std::unordered_map, including after growth.
+ */
+TEST(KeyMapTest, MatchesUnorderedMap)
+{
+    key_map<::std::uint64_t, fnv1a_hasher> map;
+    ::std::unordered_map<key<fnv1a_hasher>, ::std::uint64_t> reference;
+
+    ::std::uint64_t x = 1;
+    for (int step = 0; step < 200000; ++step)
+    {
+        x = splitmix64_mixer{}(x);
+        auto const k = key<fnv1a_hasher>{::std::to_string(x % 5000)};
+        switch (x >> 62)
+        {
+        case 0:
+        case 1:
+            map[k] = x;
+            reference[k] = x;
+            break;
+        case 2:
+            EXPECT_EQ(map.erase(k), reference.erase(k));
+            break;
+        default:
+        {
+            auto const it = map.find(k);
+            auto const ref = reference.find(k);
+            ASSERT_EQ(it == map.end(), ref == reference.end());
+            if (ref != reference.end())
+            {
+                EXPECT_EQ(it->second, ref->second);
+            }
+        }
+        }
+    }
+    EXPECT_EQ(map.size(), reference.size());
+    for (auto const & [k, v] : map)
+        EXPECT_EQ(reference.at(k), v);
+}
+
+/**
+ * @test Keys sharing a home group overflow into later groups; erasing them leaves no tombstones.
+ */
+TEST(KeyMapTest, Overflow)
+{
+    key_map<::std::uint64_t> map(1000);
+    auto const capacity = map.capacity();
+
+    // Identical low bits: every key has the same home group.
+    for (int round = 0; round < 50; ++round)
+    {
+        for (::std::uint64_t i = 0; i < 200; ++i)
+            map[digest_key((i + 1) << 40)] = i;
+        ASSERT_EQ(map.size(), 200u);
+        for (::std::uint64_t i = 0; i < 200; ++i)
+            ASSERT_EQ(map.at(digest_key((i + 1) << 40)), i);
+        EXPECT_FALSE(map.contains(digest_key(201ull << 40)));
+        for (::std::uint64_t i = 0; i < 200; i += 2)
+            ASSERT_EQ(map.erase(digest_key((i + 1) << 40)), 1u);
+        for (::std::uint64_t i = 1; i < 200; i += 2)
+            ASSERT_EQ(map.at(digest_key((i + 1) << 40)), i);
+        for (auto it = map.begin(); it != map.end();)
+            it = map.erase(it);
+        ASSERT_TRUE(map.empty());
+    }
+    EXPECT_EQ(map.capacity(), capacity);
+}
+
+/**
+ * @test Lookups of absent keys terminate when every group has a non-zero overflow count.
+ */
+TEST(KeyMapTest, TwoWayOverflow)
+{
+    key_set<> set;
+    set.reserve(20);
+    auto const capacity = set.capacity();
+    ASSERT_EQ(capacity, 2 * 15u);
+
+    // Even digests are homed in group 0, odd ones in group 1.
+    auto const in_a = [](::std::uint64_t const i) { return digest_key((i + 1) << 8); };
+    auto const in_b = [](::std::uint64_t const i) { return digest_key((i + 1) << 8 | 1); };
+
+    for (::std::uint64_t i = 0; i < 16; ++i)
+        set.insert(in_a(i)); // the 16th spills into group 1
+    for (::std::uint64_t i = 0; i < 16; ++i)
+        if (set.find(in_a(i)) != set.end() && set.erase(in_a(i)) == 1 && set.size() == 5)
+            break; // 11 erased; group 0 keeps its overflow count of 1
+    for (::std::uint64_t i = 0; i < 15; ++i)
+        set.insert(in_b(i)); // the 15th spills into group 0
+    ASSERT_EQ(set.capacity(), capacity);
+    ASSERT_EQ(set.size(), 20u);
+
+    EXPECT_FALSE(set.contains(in_a(100)));
+    EXPECT_FALSE(set.contains(in_b(100)));
+    EXPECT_EQ(set.erase(in_b(100)), 0u);
+    for (::std::uint64_t i = 0; i < 15; ++i)
+        EXPECT_TRUE(set.contains(in_b(i)));
+
+    for (auto it = set.begin(); it != set.end();)
+        it = set.erase(it);
+    EXPECT_TRUE(set.empty());
+    EXPECT_FALSE(set.contains(in_a(0)));
+}
+
+/**
+ * @test reserve, rehash and growth keep every entry; owned values move without copies or leaks.
+ */
+TEST(KeyMapTest, Rehash)
+{
+    auto const tracker = ::std::make_shared<int>(0);
+    {
+        key_map<::std::shared_ptr<int>, xxh3_128_hasher<>> map;
+        for (int i = 0; i < 10000; ++i)
+            map.try_emplace(key<xxh3_128_hasher<>>{::std::to_string(i)}, tracker);
+        EXPECT_EQ(tracker.use_count(), 10001);
+        EXPECT_LE(map.load_factor(), 7.0 / 8.0);
+
+        map.reserve(100000);
+        EXPECT_GE(map.capacity() * 7 / 8, 100000u);
+        EXPECT_EQ(map.size(), 10000u);
+        map.rehash(0);
+        EXPECT_LT(map.capacity(), 2 * 10000 * 8 / 7 + 15);
+        for (int i = 0; i < 10000; ++i)
+            ASSERT_TRUE(map.contains(key<xxh3_128_hasher<>>{::std::to_string(i)}));
+        EXPECT_EQ(tracker.use_count(), 10001);
+
+        auto moved = ::std::move(map);
+        EXPECT_EQ(moved.size(), 10000u);
+        EXPECT_EQ(tracker.use_count(), 10001);
+
+        key_map<::std::unique_ptr<int>> owners;
+        owners.try_emplace(key<>{"x"}, ::std::make_unique<int>(7));
+        owners.reserve(1000);
+        EXPECT_EQ(*owners.at(key<>{"x"}), 7);
+    }
+    EXPECT_EQ(tracker.use_count(), 1);
+}
+
+/**
+ * @test key_set stores each key once.
+ */
+TEST(KeyMapTest, Set)
+{
+    key_set<> set{key<>{"a"}, key<>{"b"}, key<>{"a"}};
+    EXPECT_EQ(set.size(), 2u);
+    EXPECT_FALSE(set.insert(key<>{"b"}).second);
+    EXPECT_TRUE(set.insert(key<>{"c"}).second);
+    EXPECT_TRUE(set.contains(key<>{"c"}));
+    EXPECT_EQ(*set.find(key<>{"a"}), key<>{"a"});
+    EXPECT_EQ(set.erase(key<>{"a"}), 1u);
+    EXPECT_EQ(set.count(key<>{"a"}), 0u);
+
+    ::std::vector<key<>> keys(set.begin(), set.end());
+    EXPECT_EQ(keys.size(), 2u);
+}
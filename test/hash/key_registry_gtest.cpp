@@ -0,0 +1,109 @@
+#define SCL_HASH_KEY_SECTION 1
+
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/fnv1a.h>
+#include <scl/utility/hash/key_registry.h>
+#include <scl/utility/hash/xxh3.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+
+namespace registry_test
+{
+    struct commands : ::scl::hash::key_domain<>
+    {};
+
+    struct fields : ::scl::hash::key_domain<::scl::hash::xxh3_128_hasher<>>
+    {};
+} // namespace registry_test
+
+SCL_KEY_REGISTER(registry_test::commands, "start")
+SCL_KEY_REGISTER(registry_test::commands, "stop")
+SCL_KEY_REGISTER(registry_test::commands, "status")
+// The same literal again is the same key, not a collision.
+SCL_KEY_REGISTER(registry_test::commands, "stop")
+
+SCL_KEY_REGISTER(registry_test::fields, "id")
+SCL_KEY_REGISTER(registry_test::fields, "start")
+
+using namespace ::scl::hash;
+
+namespace
+{
+    int handle(registry_test::commands::key_type const cmd)
+    {
+        switch (cmd)
+        {
+        case SCL_KEY(registry_test::commands, "start"):
+            return 1;
+        case SCL_KEY(registry_test::commands, "stop"):
+            return 2;
+        case SCL_KEY(registry_test::commands, "status"):
+            return 3;
+        default:
+            return 0;
+        }
+    }
+} // namespace
+
+/**
+ * @test SCL_KEY yields the key of a registered literal, usable as a case label.
+ */
+TEST(KeyRegistryTest, Keys)
+{
+    STATIC_EXPECT_EQ(SCL_KEY(registry_test::commands, "start"), key<>{::std::string_view{"start"}});
+    STATIC_EXPECT_EQ(SCL_KEY(registry_test::fields, "id"),
+        key<xxh3_128_hasher<>>{::std::string_view{"id"}});
+
+    EXPECT_EQ(handle(key<>{::std::string_view{"start"}}), 1);
+    EXPECT_EQ(handle(key<>{::std::string_view{"stop"}}), 2);
+    EXPECT_EQ(handle(key<>{::std::string_view{"status"}}), 3);
+    EXPECT_EQ(handle(key<>{::std::string_view{"restart"}}), 0);
+}
+
+/**
+ * @test Each registration is recorded in the scl_keys section, tagged with its domain.
+ */
+TEST(KeyRegistryTest, Section)
+{
+    auto const records = key_section();
+    ASSERT_EQ(records.size(), 6u);
+    EXPECT_TRUE(key_section_collisions().empty());
+
+    auto const count = [&](::std::string_view const name) {
+        return ::std::count_if(
+            records.begin(), records.end(), [&](auto const & r) { return r.text() == name; });
+    };
+    EXPECT_EQ(count("stop"), 2);
+    // "start" is registered in both domains, with different domain ids.
+    EXPECT_EQ(count("start"), 2);
+    auto const is_start = [](auto const & r) { return r.text() == "start"; };
+    auto const start = ::std::find_if(records.begin(), records.end(), is_start);
+    auto const other = ::std::find_if(start + 1, records.end(), is_start);
+    EXPECT_NE(start->domain, other->domain);
+}
+
+/**
+ * @test The cross-TU checker reports equal digests of different names within one domain only.
+ */
+TEST(KeyRegistryTest, Collisions)
+{
+    constexpr key_section_record records[]{
+        {1, {42, 0}, "alpha", 5},
+        {1, {42, 0}, "alpha", 5},
+        {1, {42, 0}, "beta", 4},
+        {2, {42, 0}, "gamma", 5},
+        {1, {43, 0}, "delta", 5},
+        {1, {42, 1}, "omega", 5},
+    };
+    auto const found = key_section_collisions(records);
+    ASSERT_EQ(found.size(), 2u);
+    for (auto const & [a, b] : found)
+    {
+        EXPECT_EQ(a.domain, 1u);
+        EXPECT_EQ(a.digest[0], b.digest[0]);
+        EXPECT_NE(a.text(), b.text());
+    }
+}
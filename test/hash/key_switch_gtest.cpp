@@ -0,0 +1,121 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/fnv1a.h>
+#include <scl/utility/hash/halfsiphash.h>
+#include <scl/utility/hash/key.h>
+#include <scl/utility/hash/key_switch.h>
+#include <scl/utility/hash/xxh3.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <utility>
+
+using namespace ::scl::hash;
+
+namespace
+{
+    using cmd = key<>;
+
+    constexpr int dispatch(cmd const c)
+    {
+        return key_switch<cmd{::std::string_view{"start"}}, cmd{::std::string_view{"stop"}},
+            cmd{::std::string_view{"status"}}>(
+            c, [] { return 1; }, [] { return 2; }, [] { return 3; }, [] { return 0; });
+    }
+
+    /// Label "c<i>" as a compile-time key of @p Hasher.
+    template <typename Hasher>
+    constexpr key<Hasher> label(::std::size_t const i)
+    {
+        ::std::array<char, 4> const name{'c', static_cast<char>('0' + i / 100),
+            static_cast<char>('0' + i / 10 % 10), static_cast<char>('0' + i % 10)};
+        return key<Hasher>{name};
+    }
+
+    constexpr ::std::size_t many = 300;
+
+    /// A 32-bit hasher that declares no mixer: the upper half of its key words is zero.
+    struct unmixed32_hasher
+    {
+        using result_type = ::std::uint32_t;
+
+        template <::std::ranges::input_range Range>
+        constexpr result_type operator()(Range && range) const noexcept
+        {
+            return halfsiphash(range);
+        }
+    };
+
+    /// Handler returning @p V.
+    template <int V>
+    struct returns
+    {
+        constexpr int operator()() const noexcept { return V; }
+    };
+
+    /// Dispatches over `many` labels; handler i returns i, the default returns -1.
+    template <typename Hasher, ::std::size_t... I>
+    constexpr int dispatch_many(key<Hasher> const k, ::std::index_sequence<I...>)
+    {
+        return key_switch<label<Hasher>(I)...>(k, returns<static_cast<int>(I)>{}..., returns<-1>{});
+    }
+} // namespace
+
+/**
+ * @test Each label reaches its handler and anything else the default, at compile and run time.
+ */
+TEST(KeySwitchTest, Dispatch)
+{
+    STATIC_EXPECT_EQ(dispatch(cmd{::std::string_view{"start"}}), 1);
+    STATIC_EXPECT_EQ(dispatch(cmd{::std::string_view{"stop"}}), 2);
+    STATIC_EXPECT_EQ(dispatch(cmd{::std::string_view{"status"}}), 3);
+    STATIC_EXPECT_EQ(dispatch(cmd{::std::string_view{"restart"}}), 0);
+
+    ::std::string const input = "status";
+    EXPECT_EQ(dispatch(cmd{input}), 3);
+    EXPECT_EQ(dispatch(cmd{input + "!"}), 0);
+    EXPECT_EQ(dispatch(cmd{::std::string{}}), 0);
+}
+
+/**
+ * @test Hundreds of labels map to their own handlers for weak, strong and unmixed 32-bit hashers.
+ */
+TEST(KeySwitchTest, ManyLabels)
+{
+    constexpr auto seq = ::std::make_index_sequence<many>{};
+    for (::std::size_t i = 0; i < many; ++i)
+    {
+        EXPECT_EQ(dispatch_many(label<fnv1a_hasher>(i), seq), static_cast<int>(i));
+        EXPECT_EQ(dispatch_many(label<xxh3_hasher<>>(i), seq), static_cast<int>(i));
+        EXPECT_EQ(dispatch_many(label<unmixed32_hasher>(i), seq), static_cast<int>(i));
+    }
+    EXPECT_EQ(dispatch_many(label<fnv1a_hasher>(many), seq), -1);
+    EXPECT_EQ(dispatch_many(label<xxh3_hasher<>>(999), seq), -1);
+    STATIC_EXPECT_EQ(dispatch_many(label<fnv1a_hasher>(123), seq), 123);
+}
+
+/**
+ * @test Handlers may be stateful lvalues and return void or mixed arithmetic types.
+ */
+TEST(KeySwitchTest, Handlers)
+{
+    int hits = 0;
+    auto count = [&hits] { ++hits; };
+    auto miss = [&hits] { hits += 100; };
+    for (char const * const name : {"a", "b", "c"})
+    {
+        using id = key<fnv1a_hasher>;
+        key_switch<id{::std::string_view{"a"}}, id{::std::string_view{"b"}}>(
+            id{::std::string_view{name}}, count, count, miss);
+    }
+    EXPECT_EQ(hits, 102);
+
+    auto const value = key_switch<cmd{::std::string_view{"half"}}>(
+        cmd{::std::string_view{"half"}}, [] { return 0.5; }, [] { return 0; });
+    static_assert(::std::is_same_v<decltype(value), double const>);
+    EXPECT_EQ(value, 0.5);
+}
@@ -0,0 +1,154 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/crc32c.h>
+#include <scl/utility/hash/fnv1a.h>
+#include <scl/utility/hash/halfsiphash.h>
+#include <scl/utility/hash/key.h>
+#include <scl/utility/hash/mix.h>
+#include <scl/utility/hash/siphash.h>
+#include <scl/utility/hash/xxh3.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace ::scl::hash;
+
+namespace
+{
+    enum class order_id : ::std::uint32_t
+    {
+    };
+
+    /// Longest bucket when @p keys are placed by the low @p bits bits of @p hash.
+    template <typename Hash, typename Keys>
+    ::std::size_t longest_bucket(Hash const hash, Keys const & keys, unsigned const bits)
+    {
+        ::std::vector<::std::size_t> buckets(::std::size_t{1} << bits);
+        for (auto const & k : keys)
+            ++buckets[hash(k) & (buckets.size() - 1)];
+        return *::std::max_element(buckets.begin(), buckets.end());
+    }
+} // namespace
+
+/**
+ * @test Mixers match their reference definitions.
+ */
+TEST(MixTest, ReferenceValues)
+{
+    // First output of SplitMix64 seeded with 0.
+    STATIC_EXPECT_EQ(splitmix64_mixer{}(0), 0xe220a8397b1dcdafull);
+    STATIC_EXPECT_EQ(fmix64_mixer{}(0), 0ull);
+    STATIC_EXPECT_EQ(identity_mixer{}(42), 42ull);
+    STATIC_EXPECT_EQ(multiply_shift_mixer{}(1), 0x9e3779b97f4a7c15ull ^ 0x9e3779b9ull);
+
+    STATIC_EXPECT_EQ(hash_int(42), fmix64_mixer{}(42));
+    STATIC_EXPECT_EQ(hash_int(-1), fmix64_mixer{}(~0ull));
+    STATIC_EXPECT_EQ(
+        hash_int<splitmix64_mixer>(::std::uint8_t{7}), hash_int<splitmix64_mixer>(7ll));
+}
+
+/**
+ * @test Flipping any input bit flips about half of the output bits.
+ */
+TEST(MixTest, Avalanche)
+{
+    auto const average_flips = [](auto const mix) {
+        ::std::size_t flips = 0;
+        ::std::uint64_t x = 0x0123456789abcdefull;
+        for (int sample = 0; sample < 256; ++sample, x = splitmix64_mixer{}(x))
+            for (int bit = 0; bit < 64; ++bit)
+                flips +=
+                    static_cast<::std::size_t>(::std::popcount(mix(x) ^ mix(x ^ (1ull << bit))));
+        return static_cast<double>(flips) / (256 * 64);
+    };
+    EXPECT_NEAR(average_flips(fmix64_mixer{}), 32.0, 0.5);
+    EXPECT_NEAR(average_flips(splitmix64_mixer{}), 32.0, 0.5);
+}
+
+/**
+ * @test fast_range maps the full hash range onto [0, n) without division.
+ */
+TEST(MixTest, FastRange)
+{
+    STATIC_EXPECT_EQ(fast_range(0ull, 1000ull), 0ull);
+    STATIC_EXPECT_EQ(fast_range(~0ull, 1000ull), 999ull);
+    STATIC_EXPECT_EQ(fast_range(1ull << 63, 1000ull), 500ull);
+    STATIC_EXPECT_EQ(fast_range32(0xffffffffu, 10u), 9u);
+    STATIC_EXPECT_EQ(fast_range32(0x80000000u, 10u), 5u);
+
+    ::std::vector<::std::size_t> buckets(7);
+    for (::std::uint64_t i = 0; i < 70000; ++i)
+        ++buckets[fast_range(hash_int(i), buckets.size())];
+    for (auto const count : buckets)
+        EXPECT_NEAR(static_cast<double>(count), 10000.0, 400.0);
+}
+
+/**
+ * @test int_hash spreads strided integers and enums over power-of-two buckets.
+ */
+TEST(MixTest, IntHash)
+{
+    ::std::vector<::std::uint64_t> strided;
+    for (::std::uint64_t i = 0; i < 4096; ++i)
+        strided.push_back(i << 12);
+
+    // Identity keeps only the low bits, which are all zero here.
+    EXPECT_EQ(longest_bucket(::std::hash<::std::uint64_t>{}, strided, 10), ::std::size_t{4096});
+    EXPECT_LE(longest_bucket(int_hash<>{}, strided, 10), ::std::size_t{16});
+    EXPECT_LE(longest_bucket(int_hash<multiply_shift_mixer>{}, strided, 10), ::std::size_t{16});
+
+    STATIC_EXPECT_EQ(int_hash<>{}(order_id{5}), int_hash<>{}(5u));
+
+    ::std::unordered_map<order_id, int, int_hash<>> orders;
+    orders[order_id{1}] = 1;
+    EXPECT_EQ(orders.at(order_id{1}), 1);
+}
+
+/**
+ * @test std::hash<key> mixes the digests of hashers that declare a mixer and passes others through.
+ */
+TEST(MixTest, KeyHashPolicy)
+{
+    constexpr key<fnv1a_hasher> weak{"weak"};
+    STATIC_EXPECT_EQ(::std::hash<key<fnv1a_hasher>>{}(weak),
+        static_cast<::std::size_t>(fmix64_mixer{}(weak.value)));
+    constexpr key<crc32c_hasher> crc{"crc"};
+    STATIC_EXPECT_EQ(::std::hash<key<crc32c_hasher>>{}(crc),
+        static_cast<::std::size_t>(fmix64_mixer{}(crc.value)));
+
+    // Every 32-bit digest gets a mixer: unmixed, its upper half is empty, so
+    // fast_range and key_map tags, which read the high bits, would see zeros.
+    ::std::size_t high = 0;
+    ::std::uint64_t ranges = 0;
+    for (int i = 0; i < 64; ++i)
+    {
+        key<halfsiphash_hasher<>> const k{::std::to_string(i)};
+        auto const h = ::std::hash<key<halfsiphash_hasher<>>>{}(k);
+        EXPECT_EQ(h, static_cast<::std::size_t>(fmix64_mixer{}(k.value)));
+        high |= h >> 32;
+        ranges |= ::std::uint64_t{1} << fast_range(h, 64);
+    }
+    EXPECT_NE(high, 0u);
+    EXPECT_GE(::std::popcount(ranges), 32);
+
+    constexpr key<xxh3_hasher<>> strong{"strong"};
+    STATIC_EXPECT_EQ(
+        ::std::hash<key<xxh3_hasher<>>>{}(strong), static_cast<::std::size_t>(strong.value));
+
+    STATIC_EXPECT_EQ(key_hash<identity_mixer>{}(weak), static_cast<::std::size_t>(weak.value));
+    STATIC_EXPECT_EQ(key_hash<splitmix64_mixer>{}(strong),
+        static_cast<::std::size_t>(splitmix64_mixer{}(strong.value)));
+
+    // Sequential names: FNV-1a's low digest bits repeat, fmix64 spreads them.
+    ::std::vector<key<fnv1a_hasher>> names;
+    for (int i = 0; i < 4096; ++i)
+        names.emplace_back(::std::string{"k"} + static_cast<char>('a' + i % 26)
+            + static_cast<char>('a' + i / 26 % 26) + static_cast<char>('a' + i / 676));
+    EXPECT_LE(longest_bucket(::std::hash<key<fnv1a_hasher>>{}, names, 12), ::std::size_t{12});
+}
@@ -0,0 +1,150 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/murmur3.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+using namespace ::scl::hash;
+
+/// Seed used for the seeded reference vectors.
+inline constexpr ::std::uint32_t test_seed = 0x9747b28cu;
+
+/// Reference-vector message of length N: bytes 0x00, 0x01, ..., (N - 1) mod 256.
+template <::std::size_t N>
+struct ref_message
+{
+    ::std::array<char, N> bytes{};
+
+    constexpr ref_message() noexcept
+    {
+        for (::std::size_t i = 0; i < N; ++i)
+            bytes[i] = static_cast<char>(i);
+    }
+
+    constexpr ::std::string_view view() const noexcept { return {bytes.data(), N}; }
+};
+
+/**
+ * @test Reference vectors around the 8- and 16-byte tail and block boundaries.
+ *       Source: `mmh3.hash128(data, seed, signed=False)`, low and high 64 bits.
+ */
+TEST(Murmur3Test, ReferenceVectors)
+{
+    STATIC_EXPECT_EQ(murmur3_x64_128(::std::string_view{}), (uint128{.lo = 0, .hi = 0}));
+    STATIC_EXPECT_EQ(murmur3_x64_128(::std::string_view{"hello"}),
+        (uint128{.lo = 0xcbd8a7b341bd9b02ull, .hi = 0x5b1e906a48ae1d19ull}));
+    STATIC_EXPECT_EQ(murmur3_x64_128(ref_message<1>{}.view()),
+        (uint128{.lo = 0x4610abe56eff5cb5ull, .hi = 0x51622daa78f83583ull}));
+    STATIC_EXPECT_EQ(murmur3_x64_128(ref_message<7>{}.view()),
+        (uint128{.lo = 0xbd4c6987ca4b0d68ull, .hi = 0x613addd4bd25c787ull}));
+    STATIC_EXPECT_EQ(murmur3_x64_128(ref_message<8>{}.view()),
+        (uint128{.lo = 0x47a7e1bdd68e2fc8ull, .hi = 0x60e6ee02ec31dcc7ull}));
+    STATIC_EXPECT_EQ(murmur3_x64_128(ref_message<15>{}.view()),
+        (uint128{.lo = 0x47231598fd4925e9ull, .hi = 0xcd846dee88c67de9ull}));
+    STATIC_EXPECT_EQ(murmur3_x64_128(ref_message<16>{}.view()),
+        (uint128{.lo = 0x444924b591903f30ull, .hi = 0xab906456762fe845ull}));
+    STATIC_EXPECT_EQ(murmur3_x64_128(ref_message<17>{}.view()),
+        (uint128{.lo = 0x5c76f40f9fe7c20eull, .hi = 0xc15f026b9edaa824ull}));
+    STATIC_EXPECT_EQ(murmur3_x64_128(ref_message<31>{}.view()),
+        (uint128{.lo = 0x053dd3e1a32cd094ull, .hi = 0x9ee59aefb4005490ull}));
+    STATIC_EXPECT_EQ(murmur3_x64_128(ref_message<32>{}.view()),
+        (uint128{.lo = 0xc66d9022b62f500full, .hi = 0x1c050a6e34c31151ull}));
+    STATIC_EXPECT_EQ(murmur3_x64_128(ref_message<100>{}.view()),
+        (uint128{.lo = 0xb06f9999c14051caull, .hi = 0x0fbd6d93c8340799ull}));
+    STATIC_EXPECT_EQ(murmur3_x64_128(ref_message<255>{}.view()),
+        (uint128{.lo = 0x03b09a824269589dull, .hi = 0x85fb67610eedda83ull}));
+}
+
+/**
+ * @test Reference vectors with a non-zero seed.
+ *       Source: `mmh3.hash128(data, 0x9747b28c, signed=False)`.
+ */
+TEST(Murmur3Test, SeededReferenceVectors)
+{
+    STATIC_EXPECT_EQ(murmur3_x64_128(::std::string_view{}, test_seed),
+        (uint128{.lo = 0x392b208a1daabbb3ull, .hi = 0x93b0608fe302957aull}));
+    STATIC_EXPECT_EQ(murmur3_x64_128(ref_message<5>{}.view(), test_seed),
+        (uint128{.lo = 0x41724c40188a9ce9ull, .hi = 0x05ee7fa2eae3fde4ull}));
+    STATIC_EXPECT_EQ(murmur3_x64_128(ref_message<16>{}.view(), test_seed),
+        (uint128{.lo = 0xcdf6e14cac2326c9ull, .hi = 0xe054cade187bd2d1ull}));
+    STATIC_EXPECT_EQ(murmur3_x64_128(ref_message<40>{}.view(), test_seed),
+        (uint128{.lo = 0x765c282e0b14b822ull, .hi = 0xc7efc703241787f2ull}));
+}
+
+/**
+ * @test Contiguous and non-contiguous ranges with the same bytes give the same
+ *       digest for every tail length and buffer misalignment.
+ */
+TEST(Murmur3Test, ContiguousMatchesNonContiguous)
+{
+    ::std::vector<char> buffer(200);
+    for (::std::size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = static_cast<char>(i * 37 + 11);
+
+    for (::std::size_t offset = 0; offset < 8; ++offset)
+    {
+        for (::std::size_t len = 0; len + offset <= buffer.size(); ++len)
+        {
+            ::std::string_view const view{buffer.data() + offset, len};
+            ::std::list<char> const list(view.begin(), view.end());
+            EXPECT_EQ(murmur3_x64_128(view), murmur3_x64_128(list)) << "len=" << len;
+        }
+    }
+}
+
+/**
+ * @test Result type is uint128.
+ */
+TEST(Murmur3Test, ResultType)
+{
+    STATIC_EXPECT_TRUE((::std::is_same_v<decltype(murmur3_x64_128("hello")), uint128>));
+    STATIC_EXPECT_TRUE((::std::is_same_v<murmur3_x64_128_hasher<>::result_type, uint128>));
+}
+
+/**
+ * @test murmur3_x64_128_hasher callable produces the same result as the free function.
+ */
+TEST(Murmur3Test, HasherMatchesFreeFunction)
+{
+    STATIC_EXPECT_EQ(murmur3_x64_128_hasher<>{}("hello"), murmur3_x64_128("hello"));
+    STATIC_EXPECT_EQ(
+        murmur3_x64_128_hasher<test_seed>{}("hello"), murmur3_x64_128("hello", test_seed));
+    STATIC_EXPECT_FALSE(
+        (::std::is_same_v<murmur3_x64_128_hasher<>, murmur3_x64_128_hasher<test_seed>>));
+}
+
+/**
+ * @test Streaming state fed in pieces matches the one-shot digest at compile time.
+ */
+TEST(Murmur3Test, StateMatchesOneShot)
+{
+    STATIC_EXPECT_EQ(murmur3_x64_128_state{}.finalize(), murmur3_x64_128(::std::string_view{}));
+    constexpr auto streamed = murmur3_x64_128_state{test_seed}
+                                  .update(::std::string_view{"a message "})
+                                  .update(::std::string_view{"in two parts"});
+    STATIC_EXPECT_EQ(streamed.finalize(),
+        murmur3_x64_128(::std::string_view{"a message in two parts"}, test_seed));
+}
+
+/**
+ * @test Splitting a message into equal chunks yields the one-shot digest.
+ */
+TEST(Murmur3Test, StateSplitInvariant)
+{
+    ::std::string const message = "The quick brown fox jumps over the lazy dog, twice over.";
+    for (::std::size_t chunk = 1; chunk <= 20; ++chunk)
+    {
+        auto state = murmur3_x64_128_hasher<>{}.make_state();
+        for (::std::size_t i = 0; i < message.size(); i += chunk)
+            state.update(::std::string_view{message}.substr(i, chunk));
+        EXPECT_EQ(state.finalize(), murmur3_x64_128(::std::string_view{message}))
+            << "chunk=" << chunk;
+    }
+}
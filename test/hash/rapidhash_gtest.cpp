@@ -0,0 +1,139 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/key.h>
+#include <scl/utility/hash/rapidhash.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+using namespace ::scl::hash;
+
+/// Reference-vector message of length N: bytes 0x00, 0x01, ..., N - 1.
+template <::std::size_t N>
+struct ref_message
+{
+    ::std::array<char, N> bytes{};
+
+    constexpr ref_message() noexcept
+    {
+        for (::std::size_t i = 0; i < N; ++i)
+            bytes[i] = static_cast<char>(i);
+    }
+
+    constexpr ::std::string_view view() const noexcept { return {bytes.data(), N}; }
+};
+
+/**
+ * @test Vectors for every length class: empty, 1–3, 4–16, 17–48 and the
+ *       48-byte block loop. Source: rapidhash v1 reference `rapidhash()`.
+ */
+TEST(RapidhashTest, ReferenceVectors)
+{
+    STATIC_EXPECT_EQ(rapidhash(::std::string_view{}), 0x5a6ef77074ebc84bull);
+    STATIC_EXPECT_EQ(rapidhash(::std::string_view{"hello"}), 0x1e5eabe786f5dbbaull);
+    STATIC_EXPECT_EQ(rapidhash(ref_message<1>{}.view()), 0x48dfce108249b3f8ull);
+    STATIC_EXPECT_EQ(rapidhash(ref_message<3>{}.view()), 0x4a25c2969d7e2f6aull);
+    STATIC_EXPECT_EQ(rapidhash(ref_message<4>{}.view()), 0xb4ee98f29eebfc4full);
+    STATIC_EXPECT_EQ(rapidhash(ref_message<8>{}.view()), 0xec1570c82e51623eull);
+    STATIC_EXPECT_EQ(rapidhash(ref_message<12>{}.view()), 0x3d5ee1574f581163ull);
+    STATIC_EXPECT_EQ(rapidhash(ref_message<16>{}.view()), 0xdf7f47a6f1034c55ull);
+    STATIC_EXPECT_EQ(rapidhash(ref_message<17>{}.view()), 0x6e168b32dd992016ull);
+    STATIC_EXPECT_EQ(rapidhash(ref_message<33>{}.view()), 0xe1e8623c0fe1afc6ull);
+    STATIC_EXPECT_EQ(rapidhash(ref_message<48>{}.view()), 0xde39ec8d0e6155a0ull);
+    STATIC_EXPECT_EQ(rapidhash(ref_message<49>{}.view()), 0x5935302eea87371full);
+    STATIC_EXPECT_EQ(rapidhash(ref_message<96>{}.view()), 0x353d32eeed935304ull);
+    STATIC_EXPECT_EQ(rapidhash(ref_message<200>{}.view()), 0x807b03940b66ff32ull);
+}
+
+/**
+ * @test Contiguous and non-contiguous ranges with the same bytes give the same
+ *       digest for every length and buffer misalignment.
+ */
+TEST(RapidhashTest, ContiguousMatchesNonContiguous)
+{
+    ::std::vector<char> buffer(160);
+    for (::std::size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = static_cast<char>(i * 37 + 11);
+
+    for (::std::size_t offset = 0; offset < 8; ++offset)
+    {
+        for (::std::size_t len = 0; len + offset <= buffer.size(); ++len)
+        {
+            ::std::string_view const view{buffer.data() + offset, len};
+            ::std::list<char> const list(view.begin(), view.end());
+            EXPECT_EQ(rapidhash(view), rapidhash(list)) << "len=" << len;
+        }
+    }
+}
+
+/**
+ * @test Every input length of an identifier-sized key changes the digest, and
+ *       flipping any single bit of a 4–16 byte input changes it too.
+ */
+TEST(RapidhashTest, ShortInputsSensitiveToEveryBit)
+{
+    ::std::string key(16, '\0');
+    for (::std::size_t len = 4; len <= key.size(); ++len)
+    {
+        ::std::string_view const view{key.data(), len};
+        auto const base = rapidhash(view);
+        EXPECT_NE(base, rapidhash(::std::string_view{key.data(), len - 1})) << "len=" << len;
+        for (::std::size_t bit = 0; bit < len * 8; ++bit)
+        {
+            key[bit / 8] = static_cast<char>(key[bit / 8] ^ (1 << (bit % 8)));
+            EXPECT_NE(rapidhash(view), base) << "len=" << len << " bit=" << bit;
+            key[bit / 8] = static_cast<char>(key[bit / 8] ^ (1 << (bit % 8)));
+        }
+    }
+}
+
+/**
+ * @test Different seeds produce different digests.
+ */
+TEST(RapidhashTest, DifferentSeeds)
+{
+    STATIC_EXPECT_NE(rapidhash("hello"), rapidhash("hello", 0));
+    STATIC_EXPECT_NE(rapidhash("hello", 1), rapidhash("hello", 2));
+}
+
+/**
+ * @test Result type is std::uint64_t.
+ */
+TEST(RapidhashTest, ResultType)
+{
+    STATIC_EXPECT_TRUE((::std::is_same_v<decltype(rapidhash("hello")), ::std::uint64_t>));
+    STATIC_EXPECT_TRUE((::std::is_same_v<rapidhash_hasher<>::result_type, ::std::uint64_t>));
+}
+
+/**
+ * @test rapidhash_hasher callable produces the same result as the free function.
+ */
+TEST(RapidhashTest, HasherMatchesFreeFunction)
+{
+    STATIC_EXPECT_EQ(rapidhash_hasher<>{}("hello"), rapidhash("hello"));
+    STATIC_EXPECT_EQ(rapidhash_hasher<42>{}("hello"), rapidhash("hello", 42));
+    STATIC_EXPECT_FALSE((::std::is_same_v<rapidhash_hasher<>, rapidhash_hasher<42>>));
+}
+
+/**
+ * @test rapidhash_hasher hashes sized random-access ranges in place and is
+ *       noexcept; ranges it would have to gather are rejected at compile time.
+ */
+TEST(RapidhashTest, HasherTakesSizedRandomAccessRanges)
+{
+    ::std::string const text = "a non-contiguous range of more than sixteen bytes";
+    ::std::deque<char> const deque(text.begin(), text.end());
+    EXPECT_EQ(rapidhash_hasher<>{}(deque), rapidhash(text));
+    EXPECT_EQ(key<rapidhash_hasher<>>{deque}.value, rapidhash(text));
+
+    STATIC_EXPECT_TRUE((::std::is_nothrow_invocable_v<rapidhash_hasher<>, ::std::string_view>));
+    STATIC_EXPECT_TRUE((::std::is_nothrow_invocable_v<rapidhash_hasher<>, ::std::deque<char> &>));
+    STATIC_EXPECT_FALSE((::std::is_invocable_v<rapidhash_hasher<>, ::std::list<char> &>));
+}
@@ -0,0 +1,179 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/crc32c.h>
+#include <scl/utility/hash/fnv1a.h>
+#include <scl/utility/hash/halfsiphash.h>
+#include <scl/utility/hash/key.h>
+#include <scl/utility/hash/murmur3.h>
+#include <scl/utility/hash/rapidhash.h>
+#include <scl/utility/hash/siphash.h>
+#include <scl/utility/hash/xxh3.h>
+#include <scl/utility/hash/xxh64.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace ::scl::hash;
+
+namespace
+{
+    /// Pseudo-random printable test string.
+    ::std::string make_text(::std::size_t const n)
+    {
+        ::std::string text(n, '\0');
+        ::std::uint64_t x = 0x9e3779b97f4a7c15ull;
+        for (auto & c : text)
+        {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            c = static_cast<char>('!' + x % 90);
+        }
+        return text;
+    }
+
+    /// Minimal rope: iterable byte by byte, and lists its chunks through `segments()`.
+    struct rope
+    {
+        explicit rope(::std::vector<::std::string> c)
+            : chunks{::std::move(c)}
+        {}
+        rope(rope const &) = delete;
+
+        auto begin() const { return bytes.begin(); }
+        auto end() const { return bytes.end(); }
+        ::std::vector<::std::string> const & segments() const { return chunks; }
+
+        ::std::vector<::std::string> chunks;
+        decltype(chunks | ::std::views::join) bytes{chunks | ::std::views::join};
+    };
+
+    /// Splits @p text into chunks of irregular sizes, including empty ones.
+    ::std::vector<::std::string> split(::std::string_view text)
+    {
+        ::std::vector<::std::string> chunks;
+        for (::std::size_t size = 0; !text.empty(); size = (size * 7 + 3) % 5000)
+        {
+            auto const n = (::std::min)(size, text.size());
+            chunks.emplace_back(text.substr(0, n));
+            text.remove_prefix(n);
+        }
+        return chunks;
+    }
+
+    /// Checks that every streaming hasher gives @p range the digest of @p text.
+    template <typename Range>
+    void expect_same_digests(::std::string const & text, Range && range)
+    {
+        EXPECT_EQ(crc32c(range), crc32c(text)) << text.size();
+        EXPECT_EQ(fnv1a(range), fnv1a(text)) << text.size();
+        EXPECT_EQ(halfsiphash(range), halfsiphash(text)) << text.size();
+        EXPECT_EQ(murmur3_x64_128(range), murmur3_x64_128(text)) << text.size();
+        EXPECT_EQ(siphash(range), siphash(text)) << text.size();
+        EXPECT_EQ(xxh64(range), xxh64(text)) << text.size();
+        EXPECT_EQ(xxh3_64(range), xxh3_64(text)) << text.size();
+        EXPECT_EQ(xxh3_128(range), xxh3_128(text)) << text.size();
+        EXPECT_EQ(rapidhash(range), rapidhash(text)) << text.size();
+    }
+
+    constexpr ::std::size_t sizes[] = {0, 1, 15, 240, 4095, 4096, 4097, 20000};
+} // namespace
+
+/**
+ * @test A deque is gathered block by block and hashes like the same bytes in a string.
+ */
+TEST(SegmentsTest, Deque)
+{
+    for (auto const size : sizes)
+    {
+        auto const text = make_text(size);
+        ::std::deque<char> const bytes(text.begin(), text.end());
+        expect_same_digests(text, bytes);
+    }
+}
+
+/**
+ * @test A join view over strings is hashed one string at a time.
+ */
+TEST(SegmentsTest, JoinView)
+{
+    for (auto const size : sizes)
+    {
+        auto const text = make_text(size);
+        auto const chunks = split(text);
+        expect_same_digests(text, chunks | ::std::views::join);
+    }
+    using joined_strings =
+        decltype(::std::declval<::std::vector<::std::string> const &>() | ::std::views::join);
+    STATIC_EXPECT_TRUE(detail::segmented_byte_range<joined_strings>);
+}
+
+/**
+ * @test A type with a segments() member is hashed one segment at a time.
+ */
+TEST(SegmentsTest, CustomSegments)
+{
+    for (auto const size : sizes)
+    {
+        auto const text = make_text(size);
+        expect_same_digests(text, rope{split(text)});
+    }
+    STATIC_EXPECT_TRUE(detail::segmented_byte_range<rope const &>);
+}
+
+/**
+ * @test Input-only and non-const-iterable views are accepted and hashed without a copy.
+ */
+TEST(SegmentsTest, InputViews)
+{
+    for (auto const size : sizes)
+    {
+        auto const text = make_text(size);
+
+        ::std::list<char> const list(text.begin(), text.end());
+        expect_same_digests(text, list);
+
+        // filter_view caches its begin, so it can only be iterated as non-const.
+        auto filtered = text | ::std::views::filter([](char) { return true; });
+        expect_same_digests(text, filtered);
+
+        // istream_view is single-pass: each hash needs a fresh stream.
+        auto const from_stream = [&text](auto const hash) {
+            ::std::istringstream in{text};
+            in >> ::std::noskipws;
+            return hash(::std::views::istream<char>(in));
+        };
+        EXPECT_EQ(from_stream([](auto && r) { return xxh3_64(r); }), xxh3_64(text)) << size;
+        EXPECT_EQ(from_stream([](auto && r) { return rapidhash(r); }), rapidhash(text)) << size;
+        EXPECT_EQ(from_stream([](auto && r) { return fnv1a(r); }), fnv1a(text)) << size;
+    }
+}
+
+/**
+ * @test Views hash at compile time, and keys can be built from them.
+ */
+TEST(SegmentsTest, CompileTimeAndKeys)
+{
+    constexpr ::std::array<::std::string_view, 3> parts{"metric", ".", "name"};
+    STATIC_EXPECT_EQ(
+        xxh3_64(parts | ::std::views::join), xxh3_64(::std::string_view{"metric.name"}));
+    STATIC_EXPECT_EQ(
+        siphash(parts | ::std::views::join), siphash(::std::string_view{"metric.name"}));
+    STATIC_EXPECT_EQ(
+        rapidhash(parts | ::std::views::join), rapidhash(::std::string_view{"metric.name"}));
+
+    ::std::deque<char> const bytes{'m', 'e', 't', 'r', 'i', 'c', '.', 'n', 'a', 'm', 'e'};
+    EXPECT_EQ(key<xxh3_hasher<>>{bytes}, key<xxh3_hasher<>>{::std::string_view{"metric.name"}});
+    EXPECT_EQ(key<fnv1a_hasher>{parts | ::std::views::join},
+        key<fnv1a_hasher>{::std::string_view{"metric.name"}});
+}
@@ -0,0 +1,96 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/siphash.h>
+#include <scl/utility/hash/siphash_batch.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace ::scl::hash;
+
+namespace
+{
+    /// Deterministic inputs of pseudo-random lengths in [0, max_len].
+    ::std::vector<::std::string> make_inputs(::std::size_t const count, ::std::size_t const max_len)
+    {
+        ::std::vector<::std::string> inputs;
+        ::std::uint64_t x = 0x9e3779b97f4a7c15ull;
+        for (::std::size_t i = 0; i < count; ++i)
+        {
+            x = x * 6364136223846793005ull + 1442695040888963407ull;
+            ::std::string s((x >> 33) % (max_len + 1), '\0');
+            for (auto & c : s)
+            {
+                x = x * 6364136223846793005ull + 1442695040888963407ull;
+                c = static_cast<char>(x >> 56);
+            }
+            inputs.push_back(::std::move(s));
+        }
+        return inputs;
+    }
+
+    template <::std::size_t C = 2, ::std::size_t D = 4>
+    void expect_batch_matches_scalar(
+        ::std::vector<::std::string> const & inputs, siphash_key const key)
+    {
+        ::std::vector<::std::string_view> const views(inputs.begin(), inputs.end());
+        ::std::vector<::std::uint64_t> out(views.size());
+        siphash_batch<C, D>(views, out, key);
+        for (::std::size_t i = 0; i < views.size(); ++i)
+            EXPECT_EQ(out[i], (siphash<C, D>(views[i], key))) << "input " << i;
+    }
+} // namespace
+
+/**
+ * @test Empty batch is a no-op.
+ */
+TEST(SipHashBatchTest, EmptyBatch)
+{
+    ::std::vector<::std::uint64_t> out;
+    siphash_batch({}, out);
+    EXPECT_TRUE(out.empty());
+}
+
+/**
+ * @test Every batch size (full SIMD groups plus remainders) matches the scalar digest.
+ */
+TEST(SipHashBatchTest, AllBatchSizesMatchScalar)
+{
+    for (::std::size_t count = 0; count <= 37; ++count)
+        expect_batch_matches_scalar(make_inputs(count, 24), siphash_default_key);
+}
+
+/**
+ * @test Lanes of very different lengths within one group match the scalar digest.
+ */
+TEST(SipHashBatchTest, MixedLengthsMatchScalar)
+{
+    constexpr siphash_key key{0xdeadbeefcafe0000ull, 0x0000cafebabe0001ull};
+    expect_batch_matches_scalar(make_inputs(1000, 300), key);
+}
+
+/**
+ * @test Equal-length inputs across block boundaries (0..64 bytes) match the scalar digest.
+ */
+TEST(SipHashBatchTest, UniformLengthsMatchScalar)
+{
+    for (::std::size_t len = 0; len <= 64; ++len)
+    {
+        ::std::vector<::std::string> inputs(16, ::std::string(len, 'x'));
+        for (::std::size_t i = 0; i < inputs.size(); ++i)
+            if (len > 0)
+                inputs[i][i % len] = static_cast<char>(i);
+        expect_batch_matches_scalar(inputs, siphash_default_key);
+    }
+}
+
+/**
+ * @test Non-default round counts are honoured.
+ */
+TEST(SipHashBatchTest, RoundCountsMatchScalar)
+{
+    expect_batch_matches_scalar<1, 3>(make_inputs(29, 40), siphash_default_key);
+}
@@ -2,15 +2,35 @@
 
 #include <scl/utility/hash/siphash.h>
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <list>
+#include <string>
 #include <string_view>
 #include <type_traits>
+#include <vector>
 
 using namespace ::scl::hash;
 
 /// Standard test key from the SipHash paper (bytes 0x00..0x0f, little-endian).
 inline constexpr siphash_key test_key = siphash_default_key;
 
+/// Reference-vector message of length N: bytes 0x00, 0x01, ..., N - 1.
+template <::std::size_t N>
+struct ref_message
+{
+    ::std::array<char, N> bytes{};
+
+    constexpr ref_message() noexcept
+    {
+        for (::std::size_t i = 0; i < N; ++i)
+            bytes[i] = static_cast<char>(i);
+    }
+
+    constexpr ::std::string_view view() const noexcept { return {bytes.data(), N}; }
+};
+
 /**
  * @test Reference vector: empty string with the standard test key.
  *       Source: SipHash-2-4 reference implementation, Aumasson & Bernstein (2012).
@@ -29,6 +49,52 @@ TEST(SipHashTest, ReferenceVectorOneByte)
     STATIC_EXPECT_EQ(siphash(::std::string_view{bytes, 1}, test_key), 0x74f839c593dc67fdull);
 }
 
+/**
+ * @test Reference vectors around the 8-byte block boundary.
+ *       Exercises both the compile-time loop and the runtime word-at-a-time path.
+ */
+TEST(SipHashTest, ReferenceVectorsBlockBoundaries)
+{
+    STATIC_EXPECT_EQ(siphash(ref_message<2>{}.view(), test_key), 0x0d6c8009d9a94f5aull);
+    STATIC_EXPECT_EQ(siphash(ref_message<7>{}.view(), test_key), 0xab0200f58b01d137ull);
+    STATIC_EXPECT_EQ(siphash(ref_message<8>{}.view(), test_key), 0x93f5f5799a932462ull);
+    STATIC_EXPECT_EQ(siphash(ref_message<15>{}.view(), test_key), 0xa129ca6149be45e5ull);
+    STATIC_EXPECT_EQ(siphash(ref_message<63>{}.view(), test_key), 0x958a324ceb064572ull);
+}
+
+/**
+ * @test Contiguous and non-contiguous ranges with the same bytes give the same
+ *       digest for every length and buffer misalignment.
+ */
+TEST(SipHashTest, ContiguousMatchesNonContiguous)
+{
+    ::std::vector<char> buffer(80);
+    for (::std::size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = static_cast<char>(i * 37 + 11);
+
+    for (::std::size_t offset = 0; offset < 8; ++offset)
+    {
+        for (::std::size_t len = 0; len + offset <= buffer.size(); ++len)
+        {
+            ::std::string_view const view{buffer.data() + offset, len};
+            ::std::list<char> const list(view.begin(), view.end());
+            EXPECT_EQ(siphash(view, test_key), siphash(list, test_key)) << "len=" << len;
+        }
+    }
+}
+
+/**
+ * @test Contiguous containers of different byte-sized element types agree.
+ */
+TEST(SipHashTest, ContiguousElementTypes)
+{
+    ::std::string const s{"\x01\x80\xffhello, world"};
+    ::std::vector<unsigned char> const u(s.begin(), s.end());
+    ::std::vector<signed char> const c(s.begin(), s.end());
+    EXPECT_EQ(siphash(s, test_key), siphash(u, test_key));
+    EXPECT_EQ(siphash(s, test_key), siphash(c, test_key));
+}
+
 /**
  * @test Identical inputs and keys produce identical results (determinism).
  */
@@ -88,3 +154,166 @@ TEST(SipHashTest, DifferentKeysDifferentHasherTypes)
     constexpr siphash_key key_b{3ull, 4ull};
     STATIC_EXPECT_FALSE((::std::is_same_v<siphash_hasher<key_a>, siphash_hasher<key_b>>));
 }
+
+/**
+ * @test Streaming state fed in pieces matches the one-shot digest at compile time.
+ */
+TEST(SipHashTest, StateMatchesOneShot)
+{
+    STATIC_EXPECT_EQ(siphash_state{}.finalize(), siphash(::std::string_view{}));
+    constexpr auto streamed =
+        siphash_state{}.update(::std::string_view{"foo"}).update(::std::string_view{"bar"});
+    STATIC_EXPECT_EQ(streamed.finalize(), siphash(::std::string_view{"foobar"}));
+}
+
+/**
+ * @test Every split point of a message yields the one-shot digest.
+ */
+TEST(SipHashTest, StateSplitInvariant)
+{
+    ::std::string_view const message{"The quick brown fox jumps over the lazy dog, twice over."};
+    for (::std::size_t i = 0; i <= message.size(); ++i)
+    {
+        for (::std::size_t j = i; j <= message.size(); ++j)
+        {
+            auto state = siphash_hasher<>{}.make_state();
+            state.update(message.substr(0, i));
+            state.update(message.substr(i, j - i));
+            state.update(message.substr(j));
+            EXPECT_EQ(state.finalize(), siphash(message)) << "split " << i << "/" << j;
+        }
+    }
+}
+
+/**
+ * @test Mixing contiguous and element-wise updates keeps the buffered block intact.
+ */
+TEST(SipHashTest, StateMixedRangeKinds)
+{
+    ::std::string const message{"0123456789abcdefghijklmnopqrstuvwxyz"};
+    for (::std::size_t i = 0; i <= message.size(); ++i)
+    {
+        ::std::list<char> const head(message.begin(), message.begin() + static_cast<long>(i));
+        siphash_state state{test_key};
+        state.update(head).update(::std::string_view{message}.substr(i));
+        EXPECT_EQ(state.finalize(), siphash(::std::string_view{message}, test_key))
+            << "split " << i;
+    }
+}
+
+/**
+ * @test SipHash-1-3 reference digests with an all-zero key.
+ *       Source: CPython >= 3.11 `hash(bytes)` with PYTHONHASHSEED=0.
+ */
+TEST(SipHashTest, SipHash13ReferenceVectors)
+{
+    constexpr siphash_key zero_key{};
+    STATIC_EXPECT_EQ((siphash<1, 3>(::std::string_view{"a"}, zero_key)), 0x407448d2b89b1813ull);
+    STATIC_EXPECT_EQ((siphash<1, 3>(::std::string_view{"hello"}, zero_key)), 0xe2e77b41cb4e1f9eull);
+    STATIC_EXPECT_EQ((siphash<1, 3>(ref_message<63>{}.view(), zero_key)), 0x385d3e39e5f37359ull);
+}
+
+/**
+ * @test Default round counts are SipHash-2-4; other counts change the digest.
+ */
+TEST(SipHashTest, RoundCounts)
+{
+    STATIC_EXPECT_EQ((siphash<2, 4>("hello", test_key)), siphash("hello", test_key));
+    STATIC_EXPECT_NE((siphash<1, 3>("hello", test_key)), siphash("hello", test_key));
+    STATIC_EXPECT_EQ(siphash13_hasher<test_key>{}("hello"), (siphash<1, 3>("hello", test_key)));
+    STATIC_EXPECT_EQ(siphash13_state{test_key}.update("hello").finalize(),
+        (siphash<1, 3>("hello", test_key)));
+}
+
+/**
+ * @test Round counts are part of the hasher type.
+ */
+TEST(SipHashTest, RoundCountsDistinctHasherTypes)
+{
+    using explicit_13 = siphash_hasher<siphash_default_key, 1, 3>;
+    STATIC_EXPECT_TRUE((::std::is_same_v<siphash13_hasher<>, explicit_13>));
+    STATIC_EXPECT_FALSE((::std::is_same_v<siphash13_hasher<>, siphash_hasher<>>));
+    STATIC_EXPECT_TRUE((::std::is_same_v<siphash13_hasher<>::state_type, siphash13_state>));
+}
+
+// ============================================================================
+// SipHash-128
+// ============================================================================
+
+/**
+ * @test SipHash-2-4-128 reference vectors with the standard test key.
+ *       Source: SipHash reference implementation `vectors_sip128`.
+ */
+TEST(SipHash128Test, ReferenceVectors)
+{
+    STATIC_EXPECT_EQ(siphash128(::std::string_view{}, test_key),
+        (uint128{.lo = 0xe6a825ba047f81a3ull, .hi = 0x930255c71472f66dull}));
+    STATIC_EXPECT_EQ(siphash128(ref_message<1>{}.view(), test_key),
+        (uint128{.lo = 0x44af996bd8c187daull, .hi = 0x45fc229b11597634ull}));
+    STATIC_EXPECT_EQ(siphash128(ref_message<7>{}.view(), test_key),
+        (uint128{.lo = 0x53c1dbd8beebf1a1ull, .hi = 0x3982f01fa64ab8c0ull}));
+    STATIC_EXPECT_EQ(siphash128(ref_message<8>{}.view(), test_key),
+        (uint128{.lo = 0x61f55862baa9623bull, .hi = 0xb49714f364e2830full}));
+    STATIC_EXPECT_EQ(siphash128(ref_message<15>{}.view(), test_key),
+        (uint128{.lo = 0x11a8b03399e99354ull, .hi = 0xd9c3cf970fec087eull}));
+    STATIC_EXPECT_EQ(siphash128(ref_message<16>{}.view(), test_key),
+        (uint128{.lo = 0xbb54b067caa4e26eull, .hi = 0x77052385bf1533fdull}));
+    STATIC_EXPECT_EQ(siphash128(ref_message<63>{}.view(), test_key),
+        (uint128{.lo = 0x4a83502f77d15051ull, .hi = 0x7cbd3f979a063e50ull}));
+}
+
+/**
+ * @test Contiguous and non-contiguous ranges with the same bytes give the same digest.
+ */
+TEST(SipHash128Test, ContiguousMatchesNonContiguous)
+{
+    ::std::string const message = "a message spanning several SipHash blocks";
+    for (::std::size_t len = 0; len <= message.size(); ++len)
+    {
+        ::std::string_view const view{message.data(), len};
+        ::std::list<char> const list(view.begin(), view.end());
+        EXPECT_EQ(siphash128(view, test_key), siphash128(list, test_key)) << "len=" << len;
+    }
+}
+
+/**
+ * @test Streaming state fed in pieces matches the one-shot digest.
+ */
+TEST(SipHash128Test, StateMatchesOneShot)
+{
+    constexpr auto streamed = siphash128_state<>{test_key}
+                                  .update(::std::string_view{"foo"})
+                                  .update(::std::string_view{"barbazqux"});
+    STATIC_EXPECT_EQ(streamed.finalize(), siphash128(::std::string_view{"foobarbazqux"}, test_key));
+
+    ::std::string const message(100, 'x');
+    for (::std::size_t chunk = 1; chunk <= 17; ++chunk)
+    {
+        auto state = siphash128_hasher<>{}.make_state();
+        for (::std::size_t i = 0; i < message.size(); i += chunk)
+            state.update(::std::string_view{message}.substr(i, chunk));
+        EXPECT_EQ(state.finalize(), siphash128(::std::string_view{message})) << "chunk=" << chunk;
+    }
+}
+
+/**
+ * @test The 128-bit digest differs from the 64-bit one in both halves.
+ */
+TEST(SipHash128Test, DistinctFromSipHash64)
+{
+    STATIC_EXPECT_NE(siphash128("hello", test_key).lo, siphash("hello", test_key));
+    STATIC_EXPECT_NE(siphash128("hello", test_key).hi, siphash("hello", test_key));
+    STATIC_EXPECT_NE((siphash128<1, 3>("hello", test_key)), siphash128("hello", test_key));
+}
+
+/**
+ * @test Result types and the hasher wrapper.
+ */
+TEST(SipHash128Test, Hasher)
+{
+    STATIC_EXPECT_TRUE((::std::is_same_v<decltype(siphash128("hello")), uint128>));
+    STATIC_EXPECT_TRUE((::std::is_same_v<siphash128_hasher<>::result_type, uint128>));
+    STATIC_EXPECT_EQ(siphash128_hasher<>{}("hello"), siphash128("hello"));
+    STATIC_EXPECT_EQ((siphash128_hasher<test_key, 1, 3>{}("hello")),
+        (siphash128<1, 3>("hello", test_key)));
+}
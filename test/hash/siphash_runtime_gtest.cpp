@@ -0,0 +1,94 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/key.h>
+#include <scl/utility/hash/siphash.h>
+#include <scl/utility/hash/siphash_runtime.h>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace ::scl::hash;
+
+namespace
+{
+    bool same_key(siphash_key const a, siphash_key const b) { return a.k0 == b.k0 && a.k1 == b.k1; }
+} // namespace
+
+/**
+ * @test Threads racing on the first use all observe the same key.
+ */
+TEST(SiphashRuntimeTest, ConcurrentFirstUse)
+{
+    ::std::vector<siphash_key> seen(8);
+    {
+        ::std::vector<::std::thread> threads;
+        for (auto & k : seen)
+            threads.emplace_back([&k] { k = runtime_siphash_key(); });
+        for (auto & t : threads)
+            t.join();
+    }
+    for (auto const k : seen)
+        EXPECT_TRUE(same_key(k, seen.front()));
+    EXPECT_TRUE(same_key(runtime_siphash_key(), seen.front()));
+    EXPECT_FALSE(same_key(seen.front(), siphash_default_key));
+}
+
+/**
+ * @test Default-constructed hashers share the process key; with_random_key draws a new one.
+ */
+TEST(SiphashRuntimeTest, Keys)
+{
+    siphash_runtime_hasher<> const a;
+    siphash_runtime_hasher<> const b;
+    EXPECT_TRUE(same_key(a.secret(), runtime_siphash_key()));
+    EXPECT_TRUE(same_key(a.secret(), b.secret()));
+
+    auto const own = siphash_runtime_hasher<>::with_random_key();
+    EXPECT_FALSE(same_key(own.secret(), a.secret()));
+    EXPECT_FALSE(same_key(random_siphash_key(), random_siphash_key()));
+
+    ::std::string_view const text = "attacker-controlled";
+    EXPECT_NE(a(text), siphash(text));
+    EXPECT_NE(own(text), a(text));
+}
+
+/**
+ * @test Digests match siphash with the hasher's key, one-shot and streaming.
+ */
+TEST(SiphashRuntimeTest, MatchesSiphash)
+{
+    constexpr ::std::string_view text = "The quick brown fox jumps over the lazy dog";
+    constexpr siphash_runtime_hasher<> fixed{siphash_key{1, 2}};
+    STATIC_EXPECT_EQ(fixed(text), siphash(text, siphash_key{1, 2}));
+
+    siphash13_runtime_hasher const h;
+    EXPECT_EQ(h(text), (siphash<1, 3>(text, h.secret())));
+    auto state = h.make_state();
+    state.update(text.substr(0, 10)).update(text.substr(10));
+    EXPECT_EQ(state.finalize(), h(text));
+}
+
+/**
+ * @test Works as the hash function of std::unordered_map and as a key hasher.
+ */
+TEST(SiphashRuntimeTest, Containers)
+{
+    using hasher = siphash_runtime_hasher<>;
+    ::std::unordered_map<::std::string, int, hasher> shared;
+    ::std::unordered_map<::std::string, int, hasher> own{0, hasher::with_random_key()};
+    for (int i = 0; i < 100; ++i)
+    {
+        shared[::std::to_string(i)] = i;
+        own[::std::to_string(i)] = i;
+    }
+    EXPECT_EQ(shared.at("42"), 42);
+    EXPECT_EQ(own.at("42"), 42);
+    EXPECT_FALSE(same_key(shared.hash_function().secret(), own.hash_function().secret()));
+
+    ::std::string const name = "session";
+    EXPECT_EQ(key<hasher>{name}.value, hasher{}(name));
+}
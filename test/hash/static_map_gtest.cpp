@@ -0,0 +1,130 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/fnv1a.h>
+#include <scl/utility/hash/halfsiphash.h>
+#include <scl/utility/hash/jenkins_ota.h>
+#include <scl/utility/hash/key.h>
+#include <scl/utility/hash/static_map.h>
+#include <scl/utility/hash/xxh3.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <set>
+#include <string>
+#include <string_view>
+
+using namespace ::scl::hash;
+
+namespace
+{
+    enum class mime : int
+    {
+        html,
+        png,
+        json,
+        css,
+        js,
+    };
+
+    constexpr auto mime_types = make_static_map<mime>({
+        {"text/html", mime::html},
+        {"image/png", mime::png},
+        {"application/json", mime::json},
+        {"text/css", mime::css},
+        {"text/javascript", mime::js},
+    });
+
+    constexpr ::std::string_view opcode_names[] = {"nop", "ld", "st", "add", "sub", "mul", "div",
+        "and", "or", "xor", "shl", "shr", "jmp", "jz", "jnz", "call", "ret", "push", "pop", "cmp",
+        "inc", "dec", "neg", "not", "mov", "lea", "test", "halt", "in", "out", "int", "iret", "cli",
+        "sti", "hlt", "wait", "sync", "fence", "load", "store", "swap", "cas", "xchg", "bt", "bts",
+        "btr", "rol", "ror", "sar", "sal", "adc", "sbb", "imul", "idiv", "movzx", "movsx", "cmov",
+        "setcc", "loop", "enter", "leave", "bound", "lock", "rep"};
+
+    /// A 32-bit hasher that declares no mixer: the upper half of its key words is zero.
+    struct unmixed32_hasher
+    {
+        using result_type = ::std::uint32_t;
+
+        template <::std::ranges::input_range Range>
+        constexpr result_type operator()(Range && range) const noexcept
+        {
+            return halfsiphash(range);
+        }
+    };
+
+    template <typename Hasher>
+    constexpr auto make_opcodes()
+    {
+        return [&]<::std::size_t... I>(::std::index_sequence<I...>) {
+            return make_static_map<int, Hasher>({{opcode_names[I], static_cast<int>(I)}...});
+        }(::std::make_index_sequence<::std::size(opcode_names)>{});
+    }
+} // namespace
+
+/**
+ * @test Every entry is found by name and by key, at compile time and at run time.
+ */
+TEST(StaticMapTest, Find)
+{
+    STATIC_EXPECT_EQ(mime_types.size(), ::std::size_t{5});
+    STATIC_EXPECT_TRUE(mime_types.find("image/png")->value == mime::png);
+    STATIC_EXPECT_TRUE(mime_types.find(key<>{::std::string_view{"text/css"}})->value == mime::css);
+    STATIC_EXPECT_TRUE(mime_types.find("image/gif") == mime_types.end());
+    STATIC_EXPECT_TRUE(!mime_types.contains("TEXT/HTML"));
+
+    ::std::string const name = "application/json";
+    auto const it = mime_types.find(name);
+    ASSERT_NE(it, mime_types.end());
+    EXPECT_EQ(it->name, "application/json");
+    EXPECT_EQ(it->value, mime::json);
+    EXPECT_FALSE(mime_types.contains(name + "x"));
+    EXPECT_FALSE(mime_types.contains(""));
+}
+
+/**
+ * @test The placement is a bijection: iteration visits each input entry once.
+ */
+TEST(StaticMapTest, MinimalPerfectHash)
+{
+    auto const check = [](auto const & map) {
+        ::std::set<int> values;
+        for (auto const & entry : map)
+        {
+            EXPECT_EQ(map.find(entry.name), &entry) << entry.name;
+            EXPECT_EQ(entry.name, opcode_names[static_cast<::std::size_t>(entry.value)]);
+            values.insert(entry.value);
+        }
+        EXPECT_EQ(values.size(), ::std::size(opcode_names));
+    };
+    static constexpr auto sip = make_opcodes<siphash_hasher<>>();
+    static constexpr auto fnv = make_opcodes<fnv1a_hasher>();
+    static constexpr auto xxh = make_opcodes<xxh3_hasher<>>();
+    static constexpr auto jenkins = make_opcodes<jenkins_ota_hasher>();
+    static constexpr auto unmixed = make_opcodes<unmixed32_hasher>();
+    check(sip);
+    check(fnv);
+    check(xxh);
+    check(jenkins);
+    check(unmixed);
+    STATIC_EXPECT_EQ(sip.find("movzx")->value, 54);
+    STATIC_EXPECT_EQ(jenkins.find("rep")->value, 63);
+}
+
+/**
+ * @test Small maps, including a single entry, and iteration order.
+ */
+TEST(StaticMapTest, SmallMaps)
+{
+    constexpr auto one = make_static_map<int>({{"only", 7}});
+    STATIC_EXPECT_EQ(one.find("only")->value, 7);
+    STATIC_EXPECT_TRUE(one.find("other") == one.end());
+
+    constexpr auto two = make_static_map<char, fnv1a_hasher>({{"yes", 'y'}, {"no", 'n'}});
+    STATIC_EXPECT_EQ(two.find("no")->value, 'n');
+    STATIC_EXPECT_EQ(two.find("yes")->value, 'y');
+    STATIC_EXPECT_TRUE(!two.empty());
+}
@@ -0,0 +1,103 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/fnv1a.h>
+#include <scl/utility/hash/intern_pool.h>
+#include <scl/utility/hash/transparent.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace ::scl::hash;
+using namespace ::std::literals;
+
+namespace
+{
+    using routes = ::std::unordered_map<::std::string, int, transparent_hash<>, transparent_equal>;
+
+    /// A key with digest @p d, bypassing the hasher.
+    key<fnv1a_hasher> digest_key(::std::uint64_t const d)
+    {
+        key<fnv1a_hasher> k{::std::string_view{}};
+        k.value = d;
+        return k;
+    }
+} // namespace
+
+/**
+ * @test Every kind of argument hashes like key<Hasher> of its text.
+ */
+TEST(TransparentTest, ConsistentHash)
+{
+    transparent_hash<> const hash;
+    auto const expected = ::std::hash<key<>>{}(key<>{"/api/v1/users"sv});
+    ::std::string const text = "/api/v1/users";
+
+    EXPECT_EQ(hash(text), expected);
+    EXPECT_EQ(hash("/api/v1/users"sv), expected);
+    EXPECT_EQ(hash("/api/v1/users"), expected);
+    EXPECT_EQ(hash(text.c_str()), expected);
+    EXPECT_EQ(hash(key<>{text}), expected);
+    EXPECT_EQ(hash(key_view<>{text}), expected);
+
+    intern_pool<> pool;
+    EXPECT_EQ(hash(pool.intern(text)), expected);
+
+    STATIC_EXPECT_EQ(transparent_hash<fnv1a_hasher>{}("abc"sv),
+        ::std::hash<key<fnv1a_hasher>>{}(key<fnv1a_hasher>{"abc"sv}));
+}
+
+/**
+ * @test Equality compares text with text, keys with keys, and keys with text through its digest.
+ */
+TEST(TransparentTest, Equality)
+{
+    transparent_equal const eq;
+    ::std::string const text = "host";
+
+    STATIC_EXPECT_TRUE(eq("host"sv, "host"));
+    EXPECT_TRUE(eq(text, "host"sv));
+    EXPECT_FALSE(eq(text, "port"));
+    EXPECT_TRUE(eq(key<>{"host"sv}, text));
+    EXPECT_TRUE(eq(text, key<>{"host"sv}));
+    EXPECT_FALSE(eq(key<>{"port"sv}, text));
+    EXPECT_TRUE(eq(key_view<>{"host"sv}, text));
+    EXPECT_TRUE(eq(text, key_view<>{"host"sv}));
+    EXPECT_TRUE(eq(key_view<>{"host"sv}, key<>{"host"sv}));
+    EXPECT_TRUE(eq(key_view<>{"host"sv}, key_view<>{text}));
+
+    // A key_view compares the bytes, even when the digests agree.
+    auto const forged = key_view<fnv1a_hasher>{key<fnv1a_hasher>{"host"sv}, "port"sv};
+    EXPECT_FALSE(eq(forged, "host"sv));
+    EXPECT_TRUE(eq(forged, key<fnv1a_hasher>{"host"sv}));
+    EXPECT_FALSE(eq(digest_key(1), "host"sv));
+}
+
+/**
+ * @test std::unordered_map<std::string, V> finds entries by every argument kind.
+ */
+TEST(TransparentTest, HeterogeneousLookup)
+{
+    routes table{{"/health", 1}, {"/api/v1/users", 2}};
+    ::std::string_view const path = "/api/v1/users";
+
+    EXPECT_EQ(table.find(path)->second, 2);
+    EXPECT_EQ(table.find("/health")->second, 1);
+    EXPECT_EQ(table.find(key<>{path})->second, 2);
+    EXPECT_EQ(table.find(key_view<>{path})->second, 2);
+    EXPECT_EQ(table.find("/missing"sv), table.end());
+    EXPECT_TRUE(table.contains(key_view<>{"/health"sv}));
+    EXPECT_EQ(table.count(key<>{"/missing"sv}), 0u);
+
+    intern_pool<> pool;
+    EXPECT_EQ(table.find(pool.intern("/health"))->second, 1);
+
+    using fnv1a_names =
+        ::std::unordered_set<::std::string, transparent_hash<fnv1a_hasher>, transparent_equal>;
+    fnv1a_names names{"a", "b"};
+    EXPECT_TRUE(names.contains("a"sv));
+    EXPECT_FALSE(names.contains(key_view<fnv1a_hasher>{"c"sv}));
+}
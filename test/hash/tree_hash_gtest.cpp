@@ -0,0 +1,138 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/fnv1a.h>
+#include <scl/utility/hash/jenkins_ota.h>
+#include <scl/utility/hash/siphash.h>
+#include <scl/utility/hash/tree_hash.h>
+#include <scl/utility/hash/xxh3.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+using namespace ::scl::hash;
+
+/// Pseudo-random test buffer.
+inline ::std::vector<unsigned char> make_buffer(::std::size_t const n)
+{
+    ::std::vector<unsigned char> buffer(n);
+    ::std::uint64_t x = 0x9e3779b97f4a7c15ull;
+    for (auto & b : buffer)
+    {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        b = static_cast<unsigned char>(x);
+    }
+    return buffer;
+}
+
+/// Appends @p v as @p bytes little-endian bytes.
+inline void put_le(::std::string & out, ::std::uint64_t const v, ::std::size_t const bytes)
+{
+    for (::std::size_t i = 0; i < bytes; ++i)
+        out.push_back(static_cast<char>(v >> (8 * i)));
+}
+
+/**
+ * @test The root matches the documented format, built by hand.
+ */
+TEST(TreeHashTest, MatchesDocumentedFormat)
+{
+    auto const buffer = make_buffer(2500);
+    ::std::string_view const bytes{reinterpret_cast<char const *>(buffer.data()), buffer.size()};
+
+    ::std::string root;
+    for (::std::size_t offset = 0; offset < bytes.size(); offset += 1000)
+        put_le(root, fnv1a(bytes.substr(offset, 1000)), 8);
+    put_le(root, 2500, 8);
+    put_le(root, 1000, 8);
+    EXPECT_EQ(tree_hash<fnv1a_hasher>(buffer, 1000, 1), fnv1a(::std::string_view{root}));
+}
+
+/**
+ * @test 32- and 128-bit leaf digests are serialised in little-endian order.
+ */
+TEST(TreeHashTest, DigestWidths)
+{
+    auto const buffer = make_buffer(300);
+    ::std::span<unsigned char const> const bytes{buffer};
+
+    ::std::string root32;
+    ::std::string root128;
+    for (::std::size_t offset = 0; offset < bytes.size(); offset += 128)
+    {
+        ::std::size_t const len = bytes.size() - offset < 128 ? bytes.size() - offset : 128;
+        auto const chunk = bytes.subspan(offset, len);
+        put_le(root32, jenkins_ota(chunk), 4);
+        auto const d = xxh3_128(chunk);
+        put_le(root128, d.lo, 8);
+        put_le(root128, d.hi, 8);
+    }
+    for (auto * root : {&root32, &root128})
+    {
+        put_le(*root, 300, 8);
+        put_le(*root, 128, 8);
+    }
+    EXPECT_EQ(
+        tree_hash<jenkins_ota_hasher>(bytes, 128, 1), jenkins_ota(::std::string_view{root32}));
+    EXPECT_EQ(tree_hash<xxh3_128_hasher<>>(bytes, 128, 1), xxh3_128(::std::string_view{root128}));
+}
+
+/**
+ * @test The digest does not depend on the number of threads.
+ */
+TEST(TreeHashTest, IndependentOfThreadCount)
+{
+    auto const buffer = make_buffer(100000);
+    for (::std::size_t const chunk : {1u, 4096u, 33333u, 100000u, 1000000u})
+    {
+        auto const ref = tree_hash<siphash_hasher<>>(buffer, chunk, 1);
+        for (unsigned const threads : {0u, 2u, 3u, 8u, 64u})
+            EXPECT_EQ(tree_hash<siphash_hasher<>>(buffer, chunk, threads), ref)
+                << "chunk=" << chunk << " threads=" << threads;
+    }
+}
+
+/**
+ * @test Empty input hashes one empty chunk.
+ */
+TEST(TreeHashTest, EmptyInput)
+{
+    ::std::vector<unsigned char> const empty;
+    ::std::string root;
+    put_le(root, xxh3_64(::std::string_view{}), 8);
+    put_le(root, 0, 8);
+    put_le(root, tree_hash_default_chunk_size, 8);
+    EXPECT_EQ(tree_hash<xxh3_hasher<>>(empty), xxh3_64(::std::string_view{root}));
+}
+
+/**
+ * @test Chunk size is part of the digest; the tree digest differs from the flat one.
+ */
+TEST(TreeHashTest, ChunkSizeIsPartOfDigest)
+{
+    auto const buffer = make_buffer(5000);
+    EXPECT_NE(tree_hash<xxh3_hasher<>>(buffer, 1024), tree_hash<xxh3_hasher<>>(buffer, 2048));
+    // A single chunk still differs from hashing the bytes directly.
+    EXPECT_NE(tree_hash<xxh3_hasher<>>(buffer, 8192), xxh3_64(buffer));
+}
+
+/**
+ * @test Contiguous ranges of any byte-sized element type give the same digest.
+ */
+TEST(TreeHashTest, ByteElementTypes)
+{
+    auto const buffer = make_buffer(3000);
+    ::std::string const chars(buffer.begin(), buffer.end());
+    auto const bytes = ::std::as_bytes(::std::span{buffer});
+    auto const ref = tree_hash<xxh3_hasher<>>(buffer, 512, 2);
+    EXPECT_EQ(tree_hash<xxh3_hasher<>>(chars, 512, 2), ref);
+    EXPECT_EQ(tree_hash<xxh3_hasher<>>(bytes, 512, 2), ref);
+    STATIC_EXPECT_TRUE(
+        (::std::is_same_v<decltype(tree_hash<xxh3_128_hasher<>>(chars)), uint128>));
+}
@@ -0,0 +1,73 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/uint128.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <unordered_set>
+
+using namespace ::scl::hash;
+
+/**
+ * @test Equality compares both halves.
+ */
+TEST(Uint128Test, Equality)
+{
+    STATIC_EXPECT_EQ((uint128{.lo = 1, .hi = 2}), (uint128{.lo = 1, .hi = 2}));
+    STATIC_EXPECT_NE((uint128{.lo = 1, .hi = 2}), (uint128{.lo = 2, .hi = 1}));
+    STATIC_EXPECT_EQ(uint128{}, (uint128{.lo = 0, .hi = 0}));
+}
+
+/**
+ * @test Ordering matches unsigned 128-bit integer order: the high half dominates.
+ */
+TEST(Uint128Test, OrderingHighHalfFirst)
+{
+    STATIC_EXPECT_LT((uint128{.lo = ~0ull, .hi = 0}), (uint128{.lo = 0, .hi = 1}));
+    STATIC_EXPECT_LT((uint128{.lo = 1, .hi = 7}), (uint128{.lo = 2, .hi = 7}));
+    STATIC_EXPECT_GT((uint128{.lo = 0, .hi = ~0ull}), (uint128{.lo = ~0ull, .hi = 1}));
+}
+
+/// Tag type parameterized by a 128-bit digest.
+template <uint128 V>
+struct tagged
+{
+    static constexpr uint128 value = V;
+};
+
+/**
+ * @test uint128 is a structural type usable as a non-type template parameter.
+ */
+TEST(Uint128Test, NonTypeTemplateParameter)
+{
+    STATIC_EXPECT_TRUE((::std::is_same_v<tagged<uint128{.lo = 1}>, tagged<uint128{.lo = 1}>>));
+    STATIC_EXPECT_FALSE((::std::is_same_v<tagged<uint128{.lo = 1}>, tagged<uint128{.hi = 1}>>));
+    STATIC_EXPECT_EQ((tagged<uint128{.lo = 5, .hi = 6}>::value), (uint128{.lo = 5, .hi = 6}));
+}
+
+/**
+ * @test std::hash uses both halves and does not collapse equal halves.
+ */
+TEST(Uint128Test, StdHashFoldsBothHalves)
+{
+    constexpr ::std::hash<uint128> h{};
+    STATIC_EXPECT_NE(h(uint128{.lo = 1, .hi = 0}), h(uint128{.lo = 1, .hi = 1}));
+    STATIC_EXPECT_NE(h(uint128{.lo = 0, .hi = 1}), h(uint128{.lo = 0, .hi = 2}));
+    STATIC_EXPECT_NE(h(uint128{.lo = 7, .hi = 7}), h(uint128{.lo = 9, .hi = 9}));
+    STATIC_EXPECT_NE(h(uint128{.lo = 7, .hi = 7}), ::std::size_t{0});
+}
+
+/**
+ * @test Raw digests are usable in unordered containers.
+ */
+TEST(Uint128Test, UnorderedSet)
+{
+    ::std::unordered_set<uint128> set;
+    set.insert(uint128{.lo = 1, .hi = 2});
+    set.insert(uint128{.lo = 2, .hi = 1});
+    set.insert(uint128{.lo = 1, .hi = 2});
+    EXPECT_EQ(set.size(), 2u);
+    EXPECT_TRUE(set.contains(uint128{.lo = 2, .hi = 1}));
+}
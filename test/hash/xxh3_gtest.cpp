@@ -0,0 +1,291 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/xxh3.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+using namespace ::scl::hash;
+
+/// Seed used for the seeded reference vectors.
+inline constexpr ::std::uint64_t test_seed = 0x9e3779b97f4a7c15ull;
+
+/// Reference-vector message of length N: bytes 0x00, 0x01, ..., (N - 1) mod 256.
+template <::std::size_t N>
+struct ref_message
+{
+    ::std::array<char, N> bytes{};
+
+    constexpr ref_message() noexcept
+    {
+        for (::std::size_t i = 0; i < N; ++i)
+            bytes[i] = static_cast<char>(i);
+    }
+
+    constexpr ::std::string_view view() const noexcept { return {bytes.data(), N}; }
+};
+
+/**
+ * @test Reference vectors covering every length class (0–16, 17–128,
+ *       129–240 and the striped long path across block boundaries).
+ *       Source: reference xxHash 0.8.1 `XXH3_64bits_withSeed()`.
+ */
+TEST(Xxh3Test, ReferenceVectors)
+{
+    STATIC_EXPECT_EQ(xxh3_64(::std::string_view{}), 0x2d06800538d394c2ull);
+    STATIC_EXPECT_EQ(xxh3_64(::std::string_view{"hello"}), 0x9555e8555c62dcfdull);
+    STATIC_EXPECT_EQ(xxh3_64(ref_message<1>{}.view()), 0xc44bdff4074eecdbull);
+    STATIC_EXPECT_EQ(xxh3_64(ref_message<3>{}.view()), 0x5f4299fc161c9cbbull);
+    STATIC_EXPECT_EQ(xxh3_64(ref_message<8>{}.view()), 0x3a1c2d7c85af88f8ull);
+    STATIC_EXPECT_EQ(xxh3_64(ref_message<16>{}.view()), 0x8355e3a6f61770dbull);
+    STATIC_EXPECT_EQ(xxh3_64(ref_message<17>{}.view()), 0x9ef341a99de37328ull);
+    STATIC_EXPECT_EQ(xxh3_64(ref_message<128>{}.view()), 0x85c6174c7ff4c46bull);
+    STATIC_EXPECT_EQ(xxh3_64(ref_message<129>{}.view()), 0xec7642b431ba3e5aull);
+    STATIC_EXPECT_EQ(xxh3_64(ref_message<240>{}.view()), 0x375a384d957fe865ull);
+    STATIC_EXPECT_EQ(xxh3_64(ref_message<241>{}.view()), 0x02e8cd95421c6d02ull);
+    STATIC_EXPECT_EQ(xxh3_64(ref_message<1024>{}.view()), 0xa870f92984398d22ull);
+    STATIC_EXPECT_EQ(xxh3_64(ref_message<1025>{}.view()), 0x78c86e91ee939852ull);
+    STATIC_EXPECT_EQ(xxh3_64(ref_message<4096>{}.view()), 0xeb4b7c3707879151ull);
+}
+
+/**
+ * @test Reference vectors with a non-zero seed, which also derives a custom
+ *       secret for inputs above 240 bytes.
+ *       Source: reference xxHash 0.8.1 `XXH3_64bits_withSeed()`.
+ */
+TEST(Xxh3Test, SeededReferenceVectors)
+{
+    STATIC_EXPECT_EQ(xxh3_64(::std::string_view{}, test_seed), 0x602b0e2cd6662c8bull);
+    STATIC_EXPECT_EQ(xxh3_64(ref_message<4>{}.view(), test_seed), 0x89878861fce0da55ull);
+    STATIC_EXPECT_EQ(xxh3_64(ref_message<9>{}.view(), test_seed), 0xfe11eeff350b91efull);
+    STATIC_EXPECT_EQ(xxh3_64(ref_message<100>{}.view(), test_seed), 0x19cf762902c5f037ull);
+    STATIC_EXPECT_EQ(xxh3_64(ref_message<200>{}.view(), test_seed), 0xb913db1647edd288ull);
+    STATIC_EXPECT_EQ(xxh3_64(ref_message<2048>{}.view(), test_seed), 0x7f738d385e516426ull);
+}
+
+/**
+ * @test Contiguous and non-contiguous ranges with the same bytes give the same
+ *       digest for every length class and buffer misalignment.
+ */
+TEST(Xxh3Test, ContiguousMatchesNonContiguous)
+{
+    ::std::vector<char> buffer(2200);
+    for (::std::size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = static_cast<char>(i * 37 + 11);
+
+    for (::std::size_t offset = 0; offset < 8; ++offset)
+    {
+        for (::std::size_t len = 0; len + offset <= buffer.size(); len += len < 300 ? 1 : 61)
+        {
+            ::std::string_view const view{buffer.data() + offset, len};
+            ::std::list<char> const list(view.begin(), view.end());
+            EXPECT_EQ(xxh3_64(view), xxh3_64(list)) << "len=" << len;
+            EXPECT_EQ(xxh3_64(view, test_seed), xxh3_64(list, test_seed)) << "len=" << len;
+        }
+    }
+}
+
+/**
+ * @test Result type is std::uint64_t.
+ */
+TEST(Xxh3Test, ResultType)
+{
+    STATIC_EXPECT_TRUE((::std::is_same_v<decltype(xxh3_64("hello")), ::std::uint64_t>));
+    STATIC_EXPECT_TRUE((::std::is_same_v<xxh3_hasher<>::result_type, ::std::uint64_t>));
+}
+
+/**
+ * @test xxh3_hasher callable produces the same result as the free function.
+ */
+TEST(Xxh3Test, HasherMatchesFreeFunction)
+{
+    STATIC_EXPECT_EQ(xxh3_hasher<>{}("hello"), xxh3_64("hello"));
+    STATIC_EXPECT_EQ(xxh3_hasher<test_seed>{}("hello"), xxh3_64("hello", test_seed));
+    STATIC_EXPECT_FALSE((::std::is_same_v<xxh3_hasher<>, xxh3_hasher<test_seed>>));
+}
+
+/**
+ * @test Streaming state fed in pieces matches the one-shot digest at compile
+ *       time, for both the buffered short path and the striped long path.
+ */
+TEST(Xxh3Test, StateMatchesOneShot)
+{
+    STATIC_EXPECT_EQ(xxh3_64_state{}.finalize(), xxh3_64(::std::string_view{}));
+    constexpr auto streamed =
+        xxh3_64_state{}.update(::std::string_view{"foo"}).update(::std::string_view{"bar"});
+    STATIC_EXPECT_EQ(streamed.finalize(), xxh3_64(::std::string_view{"foobar"}));
+
+    constexpr ref_message<1500> long_message{};
+    constexpr auto long_streamed = xxh3_64_state{test_seed}
+                                       .update(long_message.view().substr(0, 700))
+                                       .update(long_message.view().substr(700));
+    STATIC_EXPECT_EQ(long_streamed.finalize(), xxh3_64(long_message.view(), test_seed));
+}
+
+/**
+ * @test Splitting a message into equal chunks yields the one-shot digest for
+ *       chunk sizes around the stripe and internal-buffer sizes.
+ */
+TEST(Xxh3Test, StateSplitInvariant)
+{
+    ::std::vector<char> buffer(3000);
+    for (::std::size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = static_cast<char>(i * 131 + 7);
+
+    for (::std::size_t len : {0u, 16u, 200u, 240u, 241u, 256u, 257u, 1024u, 1025u, 3000u})
+    {
+        ::std::string_view const message{buffer.data(), len};
+        for (::std::size_t chunk : {1u, 7u, 63u, 64u, 65u, 255u, 256u, 257u, 1100u})
+        {
+            auto state = xxh3_hasher<>{}.make_state();
+            for (::std::size_t i = 0; i < len; i += chunk)
+                state.update(message.substr(i, chunk));
+            EXPECT_EQ(state.finalize(), xxh3_64(message)) << "len=" << len << " chunk=" << chunk;
+        }
+    }
+}
+
+/**
+ * @test Mixing contiguous and element-wise updates keeps the buffered input intact.
+ */
+TEST(Xxh3Test, StateMixedRangeKinds)
+{
+    ::std::string message(700, '\0');
+    for (::std::size_t i = 0; i < message.size(); ++i)
+        message[i] = static_cast<char>(i * 13 + 5);
+
+    for (::std::size_t i = 0; i <= message.size(); i += 23)
+    {
+        ::std::list<char> const head(message.begin(), message.begin() + static_cast<long>(i));
+        xxh3_64_state state{test_seed};
+        state.update(head).update(::std::string_view{message}.substr(i));
+        EXPECT_EQ(state.finalize(), xxh3_64(::std::string_view{message}, test_seed))
+            << "split " << i;
+    }
+}
+
+// ============================================================================
+// XXH3-128
+// ============================================================================
+
+/**
+ * @test XXH3-128 reference vectors covering every length class.
+ *       Source: reference xxHash 0.8.1 `XXH3_128bits_withSeed()`.
+ */
+TEST(Xxh3_128Test, ReferenceVectors)
+{
+    STATIC_EXPECT_EQ(xxh3_128(::std::string_view{}),
+        (uint128{.lo = 0x6001c324468d497full, .hi = 0x99aa06d3014798d8ull}));
+    STATIC_EXPECT_EQ(xxh3_128(::std::string_view{"hello"}),
+        (uint128{.lo = 0xc779cfaa5e523818ull, .hi = 0xb5e9c1ad071b3e7full}));
+    STATIC_EXPECT_EQ(xxh3_128(ref_message<3>{}.view()),
+        (uint128{.lo = 0x5f4299fc161c9cbbull, .hi = 0xe3b55f57945a17cfull}));
+    STATIC_EXPECT_EQ(xxh3_128(ref_message<4>{}.view()),
+        (uint128{.lo = 0xa6111d53e80a3db5ull, .hi = 0xeb70bf5fc779e9e6ull}));
+    STATIC_EXPECT_EQ(xxh3_128(ref_message<9>{}.view()),
+        (uint128{.lo = 0x907931979dca3746ull, .hi = 0x16c769d83e4aebceull}));
+    STATIC_EXPECT_EQ(xxh3_128(ref_message<16>{}.view()),
+        (uint128{.lo = 0x842812cc870dcae2ull, .hi = 0x72950631827607e2ull}));
+    STATIC_EXPECT_EQ(xxh3_128(ref_message<17>{}.view()),
+        (uint128{.lo = 0xc06e233df7729217ull, .hi = 0x685bc458b37d057full}));
+    STATIC_EXPECT_EQ(xxh3_128(ref_message<128>{}.view()),
+        (uint128{.lo = 0x05321a0b64d67b41ull, .hi = 0x14792fc3af88dc6cull}));
+    STATIC_EXPECT_EQ(xxh3_128(ref_message<129>{}.view()),
+        (uint128{.lo = 0xbc30b63382b09a3bull, .hi = 0xdd5e74ac6b45f54eull}));
+    STATIC_EXPECT_EQ(xxh3_128(ref_message<240>{}.view()),
+        (uint128{.lo = 0xc92b68e16f83bbb6ull, .hi = 0x65b5be86da5540e7ull}));
+    STATIC_EXPECT_EQ(xxh3_128(ref_message<241>{}.view()),
+        (uint128{.lo = 0x02e8cd95421c6d02ull, .hi = 0x1da1cb61bcb8a2a1ull}));
+    STATIC_EXPECT_EQ(xxh3_128(ref_message<1025>{}.view()),
+        (uint128{.lo = 0x78c86e91ee939852ull, .hi = 0xe1e508f110763b46ull}));
+    STATIC_EXPECT_EQ(xxh3_128(ref_message<4096>{}.view()),
+        (uint128{.lo = 0xeb4b7c3707879151ull, .hi = 0x03916578969f7a66ull}));
+}
+
+/**
+ * @test XXH3-128 reference vectors with a non-zero seed.
+ *       Source: reference xxHash 0.8.1 `XXH3_128bits_withSeed()`.
+ */
+TEST(Xxh3_128Test, SeededReferenceVectors)
+{
+    STATIC_EXPECT_EQ(xxh3_128(::std::string_view{}, test_seed),
+        (uint128{.lo = 0x4ca5176998171787ull, .hi = 0xd142977a2cca554bull}));
+    STATIC_EXPECT_EQ(xxh3_128(ref_message<2>{}.view(), test_seed),
+        (uint128{.lo = 0xde1284c84d99e533ull, .hi = 0xc962775d067b7eb2ull}));
+    STATIC_EXPECT_EQ(xxh3_128(ref_message<5>{}.view(), test_seed),
+        (uint128{.lo = 0xd88543ce5e9cb7eaull, .hi = 0x861c4b5e304bb80dull}));
+    STATIC_EXPECT_EQ(xxh3_128(ref_message<12>{}.view(), test_seed),
+        (uint128{.lo = 0xac094f0be2b4662aull, .hi = 0x86a39a2bb17cfe29ull}));
+    STATIC_EXPECT_EQ(xxh3_128(ref_message<100>{}.view(), test_seed),
+        (uint128{.lo = 0xc1261462170637e1ull, .hi = 0x1eb1d3a770ea43c9ull}));
+    STATIC_EXPECT_EQ(xxh3_128(ref_message<200>{}.view(), test_seed),
+        (uint128{.lo = 0x0a31e86625aca984ull, .hi = 0x28d3352d0ecfe294ull}));
+    STATIC_EXPECT_EQ(xxh3_128(ref_message<2048>{}.view(), test_seed),
+        (uint128{.lo = 0x7f738d385e516426ull, .hi = 0x8e5b02ecd3734d0cull}));
+}
+
+/**
+ * @test Contiguous and non-contiguous ranges give the same 128-bit digest.
+ */
+TEST(Xxh3_128Test, ContiguousMatchesNonContiguous)
+{
+    ::std::vector<char> buffer(1100);
+    for (::std::size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = static_cast<char>(i * 37 + 11);
+
+    for (::std::size_t len = 0; len <= buffer.size(); len += len < 300 ? 1 : 53)
+    {
+        ::std::string_view const view{buffer.data(), len};
+        ::std::list<char> const list(view.begin(), view.end());
+        EXPECT_EQ(xxh3_128(view, test_seed), xxh3_128(list, test_seed)) << "len=" << len;
+    }
+}
+
+/**
+ * @test The 128-bit streaming state matches the one-shot digest, at compile
+ *       time and for chunked runtime input.
+ */
+TEST(Xxh3_128Test, StateMatchesOneShot)
+{
+    constexpr auto streamed =
+        xxh3_128_state{}.update(::std::string_view{"foo"}).update(::std::string_view{"bar"});
+    STATIC_EXPECT_EQ(streamed.finalize(), xxh3_128(::std::string_view{"foobar"}));
+
+    constexpr ref_message<1500> long_message{};
+    constexpr auto long_streamed = xxh3_128_state{test_seed}
+                                       .update(long_message.view().substr(0, 700))
+                                       .update(long_message.view().substr(700));
+    STATIC_EXPECT_EQ(long_streamed.finalize(), xxh3_128(long_message.view(), test_seed));
+
+    ::std::vector<char> buffer(2000);
+    for (::std::size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = static_cast<char>(i * 131 + 7);
+    for (::std::size_t len : {0u, 100u, 240u, 241u, 1025u, 2000u})
+    {
+        ::std::string_view const message{buffer.data(), len};
+        for (::std::size_t chunk : {1u, 64u, 257u})
+        {
+            auto state = xxh3_128_hasher<>{}.make_state();
+            for (::std::size_t i = 0; i < len; i += chunk)
+                state.update(message.substr(i, chunk));
+            EXPECT_EQ(state.finalize(), xxh3_128(message)) << "len=" << len << " chunk=" << chunk;
+        }
+    }
+}
+
+/**
+ * @test Result types and the hasher wrapper.
+ */
+TEST(Xxh3_128Test, Hasher)
+{
+    STATIC_EXPECT_TRUE((::std::is_same_v<decltype(xxh3_128("hello")), uint128>));
+    STATIC_EXPECT_TRUE((::std::is_same_v<xxh3_128_hasher<>::result_type, uint128>));
+    STATIC_EXPECT_TRUE((::std::is_same_v<xxh3_128_hasher<>::state_type, xxh3_128_state>));
+    STATIC_EXPECT_EQ(xxh3_128_hasher<test_seed>{}("hello"), xxh3_128("hello", test_seed));
+}
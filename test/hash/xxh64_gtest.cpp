@@ -0,0 +1,150 @@
+#include <gtest_utils.h>
+
+#include <scl/utility/hash/xxh64.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+using namespace ::scl::hash;
+
+/// Seed used for the seeded reference vectors.
+inline constexpr ::std::uint64_t test_seed = 0x9e3779b97f4a7c15ull;
+
+/// Reference-vector message of length N: bytes 0x00, 0x01, ..., (N - 1) mod 256.
+template <::std::size_t N>
+struct ref_message
+{
+    ::std::array<char, N> bytes{};
+
+    constexpr ref_message() noexcept
+    {
+        for (::std::size_t i = 0; i < N; ++i)
+            bytes[i] = static_cast<char>(i);
+    }
+
+    constexpr ::std::string_view view() const noexcept { return {bytes.data(), N}; }
+};
+
+/**
+ * @test Reference vectors around the 8-, 32-byte lane and stripe boundaries.
+ *       Source: reference xxHash 0.8.1 `XXH64()`.
+ */
+TEST(Xxh64Test, ReferenceVectors)
+{
+    STATIC_EXPECT_EQ(xxh64(::std::string_view{}), 0xef46db3751d8e999ull);
+    STATIC_EXPECT_EQ(xxh64(::std::string_view{"hello"}), 0x26c7827d889f6da3ull);
+    STATIC_EXPECT_EQ(xxh64(ref_message<1>{}.view()), 0xe934a84adb052768ull);
+    STATIC_EXPECT_EQ(xxh64(ref_message<4>{}.view()), 0xffced8604453cc1eull);
+    STATIC_EXPECT_EQ(xxh64(ref_message<9>{}.view()), 0x67d85784a7c78c5bull);
+    STATIC_EXPECT_EQ(xxh64(ref_message<31>{}.view()), 0xc346d2b59b4d8ee1ull);
+    STATIC_EXPECT_EQ(xxh64(ref_message<32>{}.view()), 0xcbf59c5116ff32b4ull);
+    STATIC_EXPECT_EQ(xxh64(ref_message<33>{}.view()), 0x0c535d1acafb8eadull);
+    STATIC_EXPECT_EQ(xxh64(ref_message<100>{}.view()), 0x6ac1e58032166597ull);
+    STATIC_EXPECT_EQ(xxh64(ref_message<1025>{}.view()), 0x0614c40149130943ull);
+}
+
+/**
+ * @test Reference vectors with a non-zero seed.
+ *       Source: reference xxHash 0.8.1 `XXH64()`.
+ */
+TEST(Xxh64Test, SeededReferenceVectors)
+{
+    STATIC_EXPECT_EQ(xxh64(::std::string_view{}, test_seed), 0xc4349fc93c010000ull);
+    STATIC_EXPECT_EQ(xxh64(ref_message<17>{}.view(), test_seed), 0xfa8565ae182d775cull);
+    STATIC_EXPECT_EQ(xxh64(ref_message<64>{}.view(), test_seed), 0x2589245e62a1969bull);
+    STATIC_EXPECT_EQ(xxh64(ref_message<241>{}.view(), test_seed), 0x0e02b15133270828ull);
+}
+
+/**
+ * @test Contiguous and non-contiguous ranges with the same bytes give the same
+ *       digest for every length and buffer misalignment.
+ */
+TEST(Xxh64Test, ContiguousMatchesNonContiguous)
+{
+    ::std::vector<char> buffer(140);
+    for (::std::size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = static_cast<char>(i * 37 + 11);
+
+    for (::std::size_t offset = 0; offset < 8; ++offset)
+    {
+        for (::std::size_t len = 0; len + offset <= buffer.size(); ++len)
+        {
+            ::std::string_view const view{buffer.data() + offset, len};
+            ::std::list<char> const list(view.begin(), view.end());
+            EXPECT_EQ(xxh64(view, test_seed), xxh64(list, test_seed)) << "len=" << len;
+        }
+    }
+}
+
+/**
+ * @test Result type is std::uint64_t.
+ */
+TEST(Xxh64Test, ResultType)
+{
+    STATIC_EXPECT_TRUE((::std::is_same_v<decltype(xxh64("hello")), ::std::uint64_t>));
+    STATIC_EXPECT_TRUE((::std::is_same_v<xxh64_hasher<>::result_type, ::std::uint64_t>));
+}
+
+/**
+ * @test xxh64_hasher callable produces the same result as the free function.
+ */
+TEST(Xxh64Test, HasherMatchesFreeFunction)
+{
+    STATIC_EXPECT_EQ(xxh64_hasher<>{}("hello"), xxh64("hello"));
+    STATIC_EXPECT_EQ(xxh64_hasher<test_seed>{}("hello"), xxh64("hello", test_seed));
+    STATIC_EXPECT_FALSE((::std::is_same_v<xxh64_hasher<>, xxh64_hasher<test_seed>>));
+}
+
+/**
+ * @test Streaming state fed in pieces matches the one-shot digest at compile time.
+ */
+TEST(Xxh64Test, StateMatchesOneShot)
+{
+    STATIC_EXPECT_EQ(xxh64_state{}.finalize(), xxh64(::std::string_view{}));
+    constexpr auto streamed = xxh64_state{test_seed}
+                                  .update(::std::string_view{"The quick brown fox "})
+                                  .update(::std::string_view{"jumps over the lazy dog"});
+    STATIC_EXPECT_EQ(streamed.finalize(),
+        xxh64(::std::string_view{"The quick brown fox jumps over the lazy dog"}, test_seed));
+}
+
+/**
+ * @test Every split point of a message yields the one-shot digest.
+ */
+TEST(Xxh64Test, StateSplitInvariant)
+{
+    ::std::string_view const message{"The quick brown fox jumps over the lazy dog, twice over."};
+    for (::std::size_t i = 0; i <= message.size(); ++i)
+    {
+        for (::std::size_t j = i; j <= message.size(); ++j)
+        {
+            auto state = xxh64_hasher<>{}.make_state();
+            state.update(message.substr(0, i));
+            state.update(message.substr(i, j - i));
+            state.update(message.substr(j));
+            EXPECT_EQ(state.finalize(), xxh64(message)) << "split " << i << "/" << j;
+        }
+    }
+}
+
+/**
+ * @test Mixing contiguous and element-wise updates keeps the buffered stripe intact.
+ */
+TEST(Xxh64Test, StateMixedRangeKinds)
+{
+    ::std::string const message{"0123456789abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMN"};
+    for (::std::size_t i = 0; i <= message.size(); ++i)
+    {
+        ::std::list<char> const head(message.begin(), message.begin() + static_cast<long>(i));
+        xxh64_state state{test_seed};
+        state.update(head).update(::std::string_view{message}.substr(i));
+        EXPECT_EQ(state.finalize(), xxh64(::std::string_view{message}, test_seed))
+            << "split " << i;
+    }
+}